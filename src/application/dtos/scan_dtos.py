@@ -14,6 +14,17 @@ class Scan2DConfigDTO:
     """Configuration for a 2D scan (from UI).
 
     Units: positions in mm, speed in mm/s.
+
+    Adaptive averaging: when adaptive_target_std_error_volts is set, each
+    point stops once its standard error reaches the target, after at least
+    adaptive_min_samples and at most averaging_per_position samples
+    (adaptive_min_samples is capped to averaging_per_position; with fewer
+    than 2 samples per point the averaging stays fixed).
+
+    Multi-resolution: when refinement_levels > 0, the x/y grid is a coarse
+    pass; cells whose response varies by more than
+    refinement_threshold_fraction of the largest coarse-cell variation are
+    subdivided by 2, up to refinement_levels times.
     """
     x_min: float
     x_max: float
@@ -26,6 +37,10 @@ class Scan2DConfigDTO:
     averaging_per_position: int
     uncertainty_volts: float
     motion_speed_mm_s: Optional[float] = None
+    adaptive_target_std_error_volts: Optional[float] = None
+    adaptive_min_samples: int = 10
+    refinement_levels: int = 0
+    refinement_threshold_fraction: float = 0.2
 
 
 @dataclass(frozen=True)
@@ -35,7 +50,7 @@ class ExportConfigDTO:
     output_directory: str
     filename_base: str
     include_metadata: bool = True
-    format: str = "CSV"
+    format: str = "BINARY"  # "BINARY" | "HDF5" | "CSV"
 
 
 @dataclass(frozen=True)
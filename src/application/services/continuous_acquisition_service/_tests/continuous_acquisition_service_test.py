@@ -1,5 +1,4 @@
 import time
-from typing import List
 
 from tool.diagram_friendly_test import DiagramFriendlyTest
 from infrastructure.events.in_memory_event_bus import InMemoryEventBus
@@ -19,10 +18,6 @@ from infrastructure.execution.continuous_acquisition_executor import (
 )
 from infrastructure.mocks.adapter_mock_i_acquisition_port import MockAcquisitionPort
 
-from domain.events.continuous_acquisition_events import (
-    ContinuousAcquisitionSampleAcquired,
-)
-
 
 class TestContinuousAcquisitionService(DiagramFriendlyTest):
     """
@@ -30,7 +25,7 @@ class TestContinuousAcquisitionService(DiagramFriendlyTest):
 
     Goal:
     - Show a short continuous acquisition burst with a noisy/synthetic signal.
-    - Verify that SampleAcquired events are published and received.
+    - Verify that samples are buffered and drained through the service.
     """
 
     def setUp(self) -> None:
@@ -46,32 +41,6 @@ class TestContinuousAcquisitionService(DiagramFriendlyTest):
         # Infrastructure mocks / adapters
         self.acquisition_port = MockAcquisitionPort()
         self.event_bus = InMemoryEventBus()
-        self.samples: List[ContinuousAcquisitionSampleAcquired] = []
-
-        # Subscribe to continuous acquisition events
-        def on_sample(event: ContinuousAcquisitionSampleAcquired) -> None:
-            data = {
-                "acquisition_id": str(event.acquisition_id),
-                "index": event.sample_index,
-                "vx": event.sample.voltage_x_in_phase,
-            }
-            self.log_interaction(
-                "EventBus",
-                "RECEIVE",
-                "Test",
-                "Received ContinuousAcquisitionSampleAcquired",
-                data=data,
-            )
-            self.samples.append(event)
-
-        self.log_interaction(
-            "Test",
-            "SUBSCRIBE",
-            "EventBus",
-            "Subscribe to continuousacquisitionsampleacquired",
-        )
-        self.event_bus.subscribe("continuousacquisitionsampleacquired", on_sample)
-
         # Real executor wired on mocks
         self.executor = ContinuousAcquisitionExecutor(
             acquisition_port=self.acquisition_port,
@@ -113,8 +82,16 @@ class TestContinuousAcquisitionService(DiagramFriendlyTest):
         )
         self.service.stop_acquisition()
 
+        self.log_interaction(
+            "Test",
+            "CALL",
+            "ContinuousAcquisitionService",
+            "drain_samples()",
+        )
+        records = self.service.drain_samples()
+
         # Assertions
-        nb_samples = len(self.samples)
+        nb_samples = len(records)
         self.log_interaction(
             "Test",
             "ASSERT",
@@ -8,8 +8,11 @@ Responsibility:
 
 from __future__ import annotations
 
+from typing import Optional
+from uuid import UUID
+
 from .i_continuous_acquisition_executor import IContinuousAcquisitionExecutor
-from .dtos.continuous_acquisition_dtos import ContinuousAcquisitionConfig
+from .dtos.continuous_acquisition_dtos import ContinuousAcquisitionConfig, ContinuousAcquisitionTimingStats
 from application.services.scan_application_service.i_acquisition_port import IAcquisitionPort
 
 
@@ -41,4 +44,15 @@ class ContinuousAcquisitionService:
              pass
         self._executor.update_config(config)
 
+    def drain_samples(self, max_samples: Optional[int] = None):
+        """Buffered sample records since the last call (see IContinuousAcquisitionExecutor)."""
+        return self._executor.drain_samples(max_samples)
+
+    def get_sample_overruns(self) -> int:
+        return self._executor.get_sample_overruns()
+
+    def get_current_acquisition_id(self) -> Optional[UUID]:
+        return self._executor.get_current_acquisition_id()
 
+    def get_timing_stats(self) -> Optional[ContinuousAcquisitionTimingStats]:
+        return self._executor.get_timing_stats()
@@ -17,3 +17,22 @@ class ContinuousAcquisitionConfig:
     sample_rate_hz: Optional[float] = None
     max_duration_s: Optional[float] = None
     target_uncertainty: Optional[MeasurementUncertainty] = None
+
+
+@dataclass(frozen=True)
+class ContinuousAcquisitionTimingStats:
+    """
+    Pacing quality of a continuous acquisition.
+
+    - target_rate_hz / achieved_rate_hz: requested vs measured tick rate.
+    - ticks: samples scheduled on time (or caught up); skipped_ticks: deadlines dropped.
+    - jitter_*_us: lateness of each tick against its absolute deadline.
+    """
+
+    target_rate_hz: float
+    achieved_rate_hz: float
+    ticks: int
+    skipped_ticks: int
+    jitter_mean_us: float
+    jitter_std_us: float
+    jitter_max_us: float
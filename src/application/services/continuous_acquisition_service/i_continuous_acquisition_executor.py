@@ -7,11 +7,21 @@ Responsibility:
 Rationale:
 - Application layer depends on this port instead of direct threading or
   hardware code. Infrastructure implements the actual worker.
+
+Design:
+- Samples are buffered by the executor (fixed-layout records) and drained
+  in blocks by consumers; only lifecycle events (failed, stopped) go through
+  the event bus. Executors without a buffer keep the defaults below.
 """
 
 from abc import ABC, abstractmethod
+from typing import Optional
+from uuid import UUID
 
-from application.services.continuous_acquisition_service.dtos.continuous_acquisition_dtos import ContinuousAcquisitionConfig
+from application.services.continuous_acquisition_service.dtos.continuous_acquisition_dtos import (
+    ContinuousAcquisitionConfig,
+    ContinuousAcquisitionTimingStats,
+)
 from application.services.scan_application_service.i_acquisition_port import IAcquisitionPort
 
 # Re-export so existing callers that imported from here continue to work
@@ -37,4 +47,30 @@ class IContinuousAcquisitionExecutor(ABC):
         Dynamically update configuration of running acquisition.
         """
 
+    # ------------------------------------------------------------------ #
+    # Sample buffer (optional capability)
+    # ------------------------------------------------------------------ #
+
+    def drain_samples(self, max_samples: Optional[int] = None):
+        """
+        Remove and return buffered samples, oldest first.
+
+        Returns:
+            numpy structured array with fields timestamp_ns, monotonic_ns,
+            mcu_counter (-1 if unknown), index, values (6 voltages,
+            X I/Q, Y I/Q, Z I/Q), possibly empty;
+            or None if this executor does not buffer samples.
+        """
+        return None
+
+    def get_sample_overruns(self) -> int:
+        """Samples dropped because no consumer drained the buffer in time."""
+        return 0
+
+    def get_current_acquisition_id(self) -> Optional[UUID]:
+        """Identifier of the running (or last) acquisition, if any."""
+        return None
 
+    def get_timing_stats(self) -> Optional[ContinuousAcquisitionTimingStats]:
+        """Achieved rate and jitter of the running (or last) acquisition, if measured."""
+        return None
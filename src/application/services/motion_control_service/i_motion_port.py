@@ -17,8 +17,9 @@ Design:
 """
 
 from abc import ABC, abstractmethod
-from typing import Optional
+from typing import Callable, Optional, Sequence
 from domain.value_objects.geometric.position_2d import Position2D
+from application.services.motion_control_service.i_planned_trajectory_run import IPlannedTrajectoryRun
 
 
 class IMotionPort(ABC):
@@ -47,6 +48,22 @@ class IMotionPort(ABC):
         """
         pass
     
+    def move_to_within(self, position: Position2D, timeout_s: float) -> str:
+        """
+        Move to the specified 2D position, allowing up to timeout_s to complete.
+
+        Used for long moves (e.g. a whole fly-scan row at low speed) that
+        would exceed the adapter's default motion timeout.
+
+        Args:
+            position: Target position in 2D space
+            timeout_s: Maximum duration of the move before it is reported ended.
+
+        Returns:
+            motion_id: Unique identifier for the motion command.
+        """
+        return self.move_to(position)  # Adapters without a motion timeout
+
     @abstractmethod
     def get_current_position(self) -> Position2D:
         """
@@ -138,4 +155,38 @@ class IMotionPort(ABC):
         Returns:
             tuple (max_x_mm, max_y_mm)
         """
-        pass
\ No newline at end of file
+        pass
+
+    # ------------------------------------------------------------------ #
+    # Optional capability: pre-planned trajectory
+    # ------------------------------------------------------------------ #
+
+    def supports_planned_trajectory(self) -> bool:
+        """
+        Check if the adapter can drive a whole point list (start_planned_trajectory).
+
+        Returns:
+            False by default; adapters opt in by overriding.
+        """
+        return False
+
+    def start_planned_trajectory(
+        self,
+        points: Sequence[Position2D],
+        on_arrived: Optional[Callable[[int, Position2D], None]] = None,
+    ) -> IPlannedTrajectoryRun:
+        """
+        Hand the full point list to the adapter and start moving to the first point.
+
+        Args:
+            points: Ordered target positions (e.g. a serpentine trajectory).
+            on_arrived: Optional callback (point_index, actual_position),
+                called from the adapter thread on each arrival.
+
+        Returns:
+            Handle used to wait for arrivals and release the next move.
+
+        Raises:
+            NotImplementedError: If supports_planned_trajectory() is False.
+        """
+        raise NotImplementedError(f"{type(self).__name__} does not support planned trajectories")
@@ -0,0 +1,63 @@
+"""
+Planned Trajectory Run Interface
+
+Responsibility:
+- Define the handle returned by IMotionPort.start_planned_trajectory()
+- Let the scan executor block on per-point arrivals and release the next move
+
+Rationale:
+- With one motion command per point, every point pays a full round trip:
+  move_to() -> command queue -> worker -> MotionCompleted on the event bus
+  -> executor wakeup. A planned trajectory hands the whole point list to the
+  adapter once; the only per-point interaction left is arrival/release.
+
+Design:
+- Abstract Base Class (ABC), implemented in the infrastructure layer
+- Handshake: wait_for_arrival() -> (acquire) -> release() -> next move
+- No domain events on the per-point path
+"""
+
+from abc import ABC, abstractmethod
+from typing import Optional, Tuple
+
+from domain.value_objects.geometric.position_2d import Position2D
+
+
+class IPlannedTrajectoryRun(ABC):
+    """
+    Handle on a planned trajectory being driven by a motion adapter.
+
+    The adapter moves to point 0 immediately, then to point i+1 only after
+    release() has been called for point i.
+    """
+
+    @abstractmethod
+    def wait_for_arrival(self, timeout: float) -> Optional[Tuple[int, Position2D]]:
+        """
+        Block until the next point is reached.
+
+        Args:
+            timeout: Maximum wait in seconds.
+
+        Returns:
+            (point_index, actual_position), or None on timeout, abort or
+            after the last point. Check `finished` / `error` to tell them apart.
+        """
+
+    @abstractmethod
+    def release(self) -> None:
+        """Allow the adapter to start the move to the next point."""
+
+    @abstractmethod
+    def abort(self) -> None:
+        """Stop driving the trajectory (pending moves are dropped)."""
+
+    @property
+    @abstractmethod
+    def finished(self) -> bool:
+        """True once every point has been reached and released, or after abort."""
+
+    @property
+    @abstractmethod
+    def error(self) -> Optional[str]:
+        """Error message if the trajectory stopped on a motion failure."""
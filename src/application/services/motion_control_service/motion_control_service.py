@@ -6,6 +6,7 @@ from domain.shared.operation_result import OperationResult
 from domain.events.i_domain_event_bus import IDomainEventBus
 from domain.events.motion_events import PositionUpdated
 from domain.events.motion_events import PositionUpdated, EmergencyStopTriggered
+from domain.events.event_topics import EMERGENCY_STOP_TRIGGERED
 
 
 class MotionControlService:
@@ -159,7 +160,7 @@ class MotionControlService:
         try:
             self._motion_port.emergency_stop()
             self._reset_target() # Stop invalidates target
-            self._event_bus.publish("emergencystoptriggered", EmergencyStopTriggered())
+            self._event_bus.publish(EMERGENCY_STOP_TRIGGERED, EmergencyStopTriggered())
             return OperationResult.ok(None)
         except Exception as e:
             error_msg = f"Emergency stop failed: {str(e)}"
@@ -0,0 +1,51 @@
+import unittest
+from unittest.mock import MagicMock
+
+from application.services.scan_application_service.scan_application_service import ScanApplicationService
+from application.dtos.scan_dtos import Scan2DConfigDTO
+from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+
+
+class TestScanConfigMapping(unittest.TestCase):
+    """Scan2DConfigDTO -> StepScanConfig, as handed to the executor."""
+
+    def _executed_config(self, **overrides):
+        scan_executor = MagicMock()
+        scan_executor.execute.return_value = True
+        service = ScanApplicationService(MagicMock(), MagicMock(), InMemoryEventBus(), scan_executor)
+        values = dict(
+            x_min=0, x_max=10, x_nb_points=3,
+            y_min=0, y_max=10, y_nb_points=3,
+            scan_pattern="RASTER",
+            stabilization_delay_ms=0,
+            averaging_per_position=5,
+            uncertainty_volts=0.001,
+        )
+        values.update(overrides)
+
+        self.assertTrue(service.execute_scan(Scan2DConfigDTO(**values)))
+        _scan, _trajectory, config = scan_executor.execute.call_args.args
+        return config
+
+    def test_adaptive_minimum_capped_to_averaging_per_position(self):
+        config = self._executed_config(averaging_per_position=5, adaptive_target_std_error_volts=1e-4)
+
+        self.assertEqual(config.adaptive_averaging.min_samples, 5)
+        self.assertEqual(config.adaptive_averaging.max_samples, 5)
+
+    def test_adaptive_minimum_kept_when_below_averaging(self):
+        config = self._executed_config(averaging_per_position=50, adaptive_target_std_error_volts=1e-4,
+                                       adaptive_min_samples=4)
+
+        self.assertEqual(config.adaptive_averaging.min_samples, 4)
+        self.assertEqual(config.adaptive_averaging.max_samples, 50)
+
+    def test_single_sample_scan_keeps_fixed_averaging(self):
+        config = self._executed_config(averaging_per_position=1, adaptive_target_std_error_volts=1e-4)
+
+        self.assertIsNone(config.adaptive_averaging)
+        self.assertEqual(config.averaging_per_position, 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,137 @@
+import io
+import unittest
+from contextlib import redirect_stdout
+from datetime import datetime
+from uuid import uuid4
+
+from application.dtos.scan_dtos import ExportConfigDTO
+from application.services.scan_application_service.i_scan_export_port import IScanExportPort, ScanPointRow
+from application.services.scan_application_service.scan_export_service import ScanExportService
+from domain.events.scan_events import (
+    ScanCompleted,
+    ScanPointAcquired,
+    ScanPointRawSamplesAcquired,
+    ScanStarted,
+)
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+from domain.value_objects.geometric.position_2d import Position2D
+from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+from domain.value_objects.scan.scan_pattern import ScanPattern
+from domain.value_objects.scan.scan_zone import ScanZone
+from domain.value_objects.scan.step_scan_config import StepScanConfig
+from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+
+
+class DictExportPort(IScanExportPort):
+    """Row-oriented port: relies on the default write_row -> write_point."""
+
+    def __init__(self):
+        self.metadata = None
+        self.points = []
+        self.stopped = False
+
+    def configure(self, directory, filename, metadata):
+        self.metadata = metadata
+
+    def start(self):
+        pass
+
+    def write_point(self, data):
+        self.points.append(data)
+
+    def stop(self):
+        self.stopped = True
+
+
+class RowExportPort(DictExportPort):
+    def __init__(self):
+        super().__init__()
+        self.raw = []
+
+    def write_row(self, row):
+        self.points.append(row)
+
+    def supports_raw_samples(self):
+        return True
+
+    def write_raw_samples(self, point_index, samples):
+        self.raw.append((point_index, len(samples)))
+
+
+class TestScanExportService(unittest.TestCase):
+    def _run(self, fmt, binary_port=None, raw_capture=False):
+        bus = InMemoryEventBus()
+        csv_port, hdf5_port = DictExportPort(), RowExportPort()
+        service = ScanExportService(bus, csv_port, hdf5_port, binary_port, raw_capture=raw_capture)
+        service.configure_export(ExportConfigDTO(enabled=True, output_directory="", filename_base="t", format=fmt))
+
+        scan_id = uuid4()
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=0, x_max=1, y_min=0, y_max=1),
+            x_nb_points=2,
+            y_nb_points=3,
+            scan_pattern=ScanPattern.RASTER,
+            stabilization_delay_ms=0,
+            averaging_per_position=1,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+        )
+        measurement = VoltageMeasurement(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, timestamp=datetime.now(),
+                                         std_dev_x_in_phase=0.1)
+        bus.publish("scanstarted", ScanStarted(scan_id=scan_id, config=config))
+        bus.publish("scanpointrawsamplesacquired", ScanPointRawSamplesAcquired(
+            scan_id=scan_id, point_index=0, samples=(measurement, measurement)))
+        bus.publish("scanpointacquired", ScanPointAcquired(scan_id=scan_id, point_index=0,
+                                                          position=Position2D(0.5, 0.25),
+                                                          measurement=measurement))
+        bus.publish("scancompleted", ScanCompleted(scan_id=scan_id, total_points=1))
+        return csv_port, hdf5_port, scan_id
+
+    def test_column_port_receives_typed_rows(self):
+        _, hdf5_port, scan_id = self._run("HDF5")
+        row = hdf5_port.points[0]
+        self.assertIsInstance(row, ScanPointRow)
+        self.assertEqual(row.voltages, (1.0, 2.0, 3.0, 4.0, 5.0, 6.0))
+        self.assertEqual(row.std_devs[:2], (0.1, None))
+        self.assertEqual((hdf5_port.metadata["x_nb_points"], hdf5_port.metadata["y_nb_points"]), (2, 3))
+        self.assertTrue(hdf5_port.stopped)
+        self.assertEqual(hdf5_port.raw, [(0, 2)])
+
+    def test_row_port_receives_flat_dicts(self):
+        csv_port, _, scan_id = self._run("CSV")
+        data = csv_port.points[0]
+        self.assertEqual(data["scan_id"], str(scan_id))
+        self.assertEqual((data["x"], data["y"]), (0.5, 0.25))
+        self.assertEqual(data["voltage_z_quadrature"], 6.0)
+        self.assertIsNone(data["std_dev_x_quadrature"])
+        self.assertEqual(ScanPointRow.from_dict(data).voltages[0], 1.0)
+        # Default write_raw_samples is a no-op for formats without raw layout
+        self.assertEqual(len(csv_port.points), 1)
+
+    def test_binary_format_selects_binary_port(self):
+        binary_port = RowExportPort()
+        csv_port, hdf5_port, _ = self._run("BINARY", binary_port)
+        self.assertEqual(len(binary_port.points), 1)
+        self.assertEqual((csv_port.points, hdf5_port.points), ([], []))
+
+    def test_raw_capture_on_format_without_raw_layout_warns_once(self):
+        binary_port = DictExportPort()
+        output = io.StringIO()
+        with redirect_stdout(output), self.assertLogs(
+            "application.services.scan_application_service.scan_export_service", level="WARNING"
+        ) as logs:
+            self._run("BINARY", binary_port, raw_capture=True)
+        self.assertEqual(len(logs.records), 1)
+        self.assertIn("BINARY export does not store raw samples", output.getvalue())
+        self.assertEqual(len(binary_port.points), 1)
+
+        with redirect_stdout(io.StringIO()), self.assertNoLogs(level="WARNING"):
+            _, hdf5_port, _ = self._run("HDF5", raw_capture=True)
+        self.assertEqual(hdf5_port.raw, [(0, 2)])
+
+    def test_binary_format_without_binary_port_falls_back_to_csv(self):
+        csv_port, _, _ = self._run("BINARY")
+        self.assertEqual(len(csv_port.points), 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
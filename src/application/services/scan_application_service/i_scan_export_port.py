@@ -6,7 +6,68 @@ Infrastructure layer will implement this (e.g., CSVExporter).
 """
 
 from abc import ABC, abstractmethod
-from typing import Dict, Any
+from dataclasses import dataclass
+from typing import Dict, Any, Optional, Sequence, Tuple
+
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+
+# Order of the 6 measurement components in ScanPointRow
+MEASUREMENT_COMPONENTS = (
+    "x_in_phase", "x_quadrature",
+    "y_in_phase", "y_quadrature",
+    "z_in_phase", "z_quadrature",
+)
+
+
+@dataclass(frozen=True)
+class ScanPointRow:
+    """
+    One exported scan point, typed.
+
+    - voltages: mean voltages, MEASUREMENT_COMPONENTS order.
+    - std_devs: standard deviations, same order (None if not computed).
+    - sample_count: samples averaged at this point (None if unknown).
+    - level: resolution level (0 = coarse grid, n = n-th refinement pass).
+    """
+    scan_id: str
+    point_index: int
+    x: float
+    y: float
+    voltages: Tuple[float, float, float, float, float, float]
+    std_devs: Tuple[Optional[float], ...]
+    sample_count: Optional[int] = None
+    level: int = 0
+
+    def as_dict(self) -> Dict[str, Any]:
+        """Flat dict (one key per column), for row-oriented formats such as CSV."""
+        data: Dict[str, Any] = {
+            "scan_id": self.scan_id,
+            "point_index": self.point_index,
+            "x": self.x,
+            "y": self.y,
+        }
+        for name, value in zip(MEASUREMENT_COMPONENTS, self.voltages):
+            data[f"voltage_{name}"] = value
+        for name, value in zip(MEASUREMENT_COMPONENTS, self.std_devs):
+            data[f"std_dev_{name}"] = value
+        data["sample_count"] = self.sample_count
+        data["level"] = self.level
+        return data
+
+    @classmethod
+    def from_dict(cls, data: Dict[str, Any]) -> "ScanPointRow":
+        """Inverse of as_dict() (missing std devs / sample count become None, missing level 0)."""
+        return cls(
+            scan_id=str(data.get("scan_id", "")),
+            point_index=int(data.get("point_index", -1)),
+            x=float(data["x"]),
+            y=float(data["y"]),
+            voltages=tuple(float(data[f"voltage_{name}"]) for name in MEASUREMENT_COMPONENTS),
+            std_devs=tuple(data.get(f"std_dev_{name}") for name in MEASUREMENT_COMPONENTS),
+            sample_count=None if data.get("sample_count") in (None, "") else int(data["sample_count"]),
+            level=0 if data.get("level") in (None, "") else int(data["level"]),
+        )
+
 
 class IScanExportPort(ABC):
     """Interface for data export."""
@@ -26,6 +87,33 @@ class IScanExportPort(ABC):
         """Write a single data point."""
         pass
     
+    def write_row(self, row: ScanPointRow) -> None:
+        """
+        Write a single typed point.
+
+        Default: flatten to the write_point() dict. Column-oriented
+        exporters override it to avoid the dict round trip.
+        """
+        self.write_point(row.as_dict())
+
+    def supports_raw_samples(self) -> bool:
+        """
+        Check if the format stores the individual samples (write_raw_samples).
+
+        Returns:
+            False by default; exporters with a per-sample layout opt in.
+        """
+        return False
+
+    def write_raw_samples(self, point_index: int, samples: Sequence[VoltageMeasurement]) -> None:
+        """
+        Write the individual samples of one point (raw capture mode).
+
+        Default: ignored (formats without a per-sample layout, see
+        supports_raw_samples()).
+        """
+        pass
+    
     @abstractmethod
     def stop(self) -> None:
         """Stop export and close file."""
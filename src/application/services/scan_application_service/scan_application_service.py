@@ -19,7 +19,11 @@ from datetime import datetime
 
 from application.dtos.scan_dtos import Scan2DConfigDTO, ExportConfigDTO, ScanStatusDTO
 from domain.services.scan_trajectory_factory import ScanTrajectoryFactory
+from domain.services.trajectory_optimizer import TrajectoryOptimizer
+from domain.value_objects.scan.scan_trajectory import ScanTrajectory
 from domain.value_objects.scan.step_scan_config import StepScanConfig
+from domain.value_objects.scan.adaptive_averaging import AdaptiveAveraging
+from domain.value_objects.scan.grid_refinement import GridRefinement
 from domain.value_objects.scan.scan_zone import ScanZone
 from domain.value_objects.scan.scan_pattern import ScanPattern
 from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
@@ -41,6 +45,16 @@ from .i_scan_output_port import IScanOutputPort
 from domain.events.scan_events import ScanStarted, ScanPointAcquired, ScanCompleted, ScanFailed, ScanCancelled, ScanPaused, ScanResumed
 from domain.events.domain_event import DomainEvent
 from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.events.event_topics import (
+    SCAN_CANCELLED,
+    SCAN_COMPLETED,
+    SCAN_FAILED,
+    SCAN_PAUSED,
+    SCAN_POINT_ACQUIRED,
+    SCAN_RESUMED,
+    SCAN_STARTED,
+    topic_of,
+)
 
 # ...
 
@@ -56,12 +70,15 @@ class ScanApplicationService:
         event_bus: IDomainEventBus,
         scan_executor: IScanExecutor,
         output_port: Optional[IScanOutputPort] = None, # Optional for backward compat/tests
+        trajectory_optimizer: Optional[TrajectoryOptimizer] = None,
     ):
         self._motion_port = motion_port
         self._acquisition_port = acquisition_port
         self._event_bus = event_bus
         self._scan_executor = scan_executor
         self._output_port = output_port
+        # Reorders grid points by stage move time (None: pattern order kept)
+        self._trajectory_optimizer = trajectory_optimizer
         
         self._current_scan: Optional[StepScan] = None
         self._status = ScanStatus.PENDING
@@ -70,13 +87,13 @@ class ScanApplicationService:
         
         # Subscribe myself to the bus to forward events to the output port
         # This ensures that even events from the Executor (which talks to the bus) get forwarded
-        self._event_bus.subscribe("scanstarted", self._on_domain_event)
-        self._event_bus.subscribe("scanpointacquired", self._on_domain_event)
-        self._event_bus.subscribe("scancompleted", self._on_domain_event)
-        self._event_bus.subscribe("scanfailed", self._on_domain_event)
-        self._event_bus.subscribe("scancancelled", self._on_domain_event)
-        self._event_bus.subscribe("scanpaused", self._on_domain_event)
-        self._event_bus.subscribe("scanresumed", self._on_domain_event)
+        self._event_bus.subscribe(SCAN_STARTED, self._on_domain_event)
+        self._event_bus.subscribe(SCAN_POINT_ACQUIRED, self._on_domain_event)
+        self._event_bus.subscribe(SCAN_COMPLETED, self._on_domain_event)
+        self._event_bus.subscribe(SCAN_FAILED, self._on_domain_event)
+        self._event_bus.subscribe(SCAN_CANCELLED, self._on_domain_event)
+        self._event_bus.subscribe(SCAN_PAUSED, self._on_domain_event)
+        self._event_bus.subscribe(SCAN_RESUMED, self._on_domain_event)
 
 
     def set_output_port(self, output_port: IScanOutputPort) -> None:
@@ -123,6 +140,8 @@ class ScanApplicationService:
             trajectory = ScanTrajectoryFactory.create_trajectory(config)
             total_points = len(trajectory)
             print(f"[ScanApplicationService] Trajectory generated with {total_points} points.")
+            if self._trajectory_optimizer is not None:
+                trajectory = self._optimize_trajectory(trajectory)
             
             # 4. Delegate execution to ScanExecutor (Infrastructure)
             # The executor is responsible for running this asynchronously (if needed)
@@ -193,12 +212,12 @@ class ScanApplicationService:
 
     def subscribe_to_scan_updates(self, callback: Callable[[DomainEvent], None]) -> None:
         """Subscribe to scan point acquired events."""
-        self._event_bus.subscribe("scanpointacquired", callback)
-        self._event_bus.subscribe("scanstarted", callback)
+        self._event_bus.subscribe(SCAN_POINT_ACQUIRED, callback)
+        self._event_bus.subscribe(SCAN_STARTED, callback)
 
     def subscribe_to_scan_completion(self, callback: Callable[[DomainEvent], None]) -> None:
         """Subscribe to scan completion events."""
-        self._event_bus.subscribe("scancompleted", callback)
+        self._event_bus.subscribe(SCAN_COMPLETED, callback)
 
     def _on_domain_event(self, event: DomainEvent):
         """
@@ -220,6 +239,7 @@ class ScanApplicationService:
             return
 
         if isinstance(event, ScanStarted):
+             refinement = event.config.refinement
              self._output_port.present_scan_started(str(event.scan_id), {
                 "pattern": event.config.scan_pattern.name,
                 "points": event.config.total_points(),
@@ -228,7 +248,10 @@ class ScanApplicationService:
                 "x_nb_points": event.config.x_nb_points,
                 "y_min": event.config.scan_zone.y_min,
                 "y_max": event.config.scan_zone.y_max,
-                "y_nb_points": event.config.y_nb_points
+                "y_nb_points": event.config.y_nb_points,
+                # Coarse grid above; refined points live on a finer lattice
+                "refinement_levels": refinement.levels if refinement else 0,
+                "refinement_subdivision": refinement.subdivision if refinement else 1,
             })
 
         elif isinstance(event, ScanPointAcquired):
@@ -244,7 +267,8 @@ class ScanApplicationService:
                     "z_in_phase": event.measurement.voltage_z_in_phase,
                     "z_quadrature": event.measurement.voltage_z_quadrature
                 },
-                "index": event.point_index
+                "index": event.point_index,
+                "level": event.level,
             }
             # We assume total_points is available via current scan or we pass 0 if unknown
             total = self._current_scan.expected_points if self._current_scan else 0
@@ -270,11 +294,42 @@ class ScanApplicationService:
     def _publish_events(self, events: List[DomainEvent]) -> None:
         """Publish domain events to EventBus."""
         for event in events:
-            event_type = type(event).__name__.lower()  # e.g., 'scanstarted'
+            event_type = topic_of(event)
             self._event_bus.publish(event_type, event)
 
 
+    def _optimize_trajectory(self, trajectory: ScanTrajectory) -> ScanTrajectory:
+        """Reorder the points by move time, starting from the current stage position."""
+        try:
+            start = self._motion_port.get_current_position()
+        except Exception as e:
+            print(f"[ScanApplicationService] Current position unavailable, optimizing without start: {e}")
+            start = None
+        optimizer = self._trajectory_optimizer
+        before = optimizer.total_move_time(trajectory, start)
+        optimized = optimizer.optimize(trajectory, start)
+        after = optimizer.total_move_time(optimized, start)
+        print(f"[ScanApplicationService] Trajectory move time: {before:.1f}s -> {after:.1f}s (estimated).")
+        return optimized
+
     def _to_domain_config(self, dto: Scan2DConfigDTO) -> StepScanConfig:
+        adaptive = None
+        if dto.adaptive_target_std_error_volts is not None and dto.averaging_per_position < 2:
+            print("[ScanApplicationService] Adaptive averaging needs at least 2 samples per point: fixed averaging used")
+        elif dto.adaptive_target_std_error_volts is not None:
+            # averaging_per_position becomes the upper bound of the adaptive dwell,
+            # the minimum is lowered to it if needed (std estimate needs 2 samples)
+            adaptive = AdaptiveAveraging.uniform(
+                dto.adaptive_target_std_error_volts,
+                min_samples=max(2, min(dto.adaptive_min_samples, dto.averaging_per_position)),
+                max_samples=dto.averaging_per_position,
+            )
+        refinement = None
+        if dto.refinement_levels > 0:
+            refinement = GridRefinement(
+                levels=dto.refinement_levels,
+                threshold_fraction=dto.refinement_threshold_fraction,
+            )
         return StepScanConfig(
             scan_zone=ScanZone(x_min=dto.x_min, x_max=dto.x_max, y_min=dto.y_min, y_max=dto.y_max),
             x_nb_points=dto.x_nb_points,
@@ -282,7 +337,9 @@ class ScanApplicationService:
             scan_pattern=ScanPattern[dto.scan_pattern],
             stabilization_delay_ms=dto.stabilization_delay_ms,
             averaging_per_position=dto.averaging_per_position,
-            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=dto.uncertainty_volts)
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=dto.uncertainty_volts),
+            adaptive_averaging=adaptive,
+            refinement=refinement,
         )
 
     def _extract_metadata(self, dto: Scan2DConfigDTO) -> dict:
@@ -4,7 +4,7 @@ Scan Export Service
 Responsibility:
 - Listen to scan-related domain events and drive an `IExportPort`
   to export step-scan point results (position + averaged value + std dev)
-  to an external format (e.g. CSV).
+  to an external format (binary, HDF5 or CSV).
 
 Rationale:
 - Keep export orchestration in the Application layer, decoupled from
@@ -17,17 +17,26 @@ import logging
 from typing import Optional, Dict, Any
 
 from application.dtos.scan_dtos import ExportConfigDTO
-from .i_scan_export_port import IScanExportPort
+from .i_scan_export_port import IScanExportPort, ScanPointRow
 
 from domain.events.scan_events import (
     ScanStarted,
     ScanPointAcquired,
+    ScanPointRawSamplesAcquired,
     ScanCompleted,
     ScanFailed,
     ScanCancelled,
 )
 from domain.events.domain_event import DomainEvent
 from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.events.event_topics import (
+    SCAN_CANCELLED,
+    SCAN_COMPLETED,
+    SCAN_FAILED,
+    SCAN_POINT_ACQUIRED,
+    SCAN_POINT_RAW_SAMPLES_ACQUIRED,
+    SCAN_STARTED,
+)
 
 
 logger = logging.getLogger(__name__)
@@ -39,9 +48,12 @@ class ScanExportService:
 
     Notes:
     - Works in an event-driven fashion: subscribes to `ScanStarted`,
-      `ScanPointAcquired`, `ScanCompleted`, `ScanFailed`, `ScanCancelled`.
+      `ScanPointAcquired`, `ScanCompleted`, `ScanFailed`, `ScanCancelled`,
+      and `ScanPointRawSamplesAcquired` (raw capture mode).
     - Uses `ExportConfigDTO` to know whether export is enabled and
       where to write files.
+    - Raw samples are only stored by formats that support them (HDF5):
+      with another format they are dropped, with a warning at scan start.
     """
 
     def __init__(
@@ -49,21 +61,32 @@ class ScanExportService:
         event_bus: IDomainEventBus,
         csv_export_port: IScanExportPort,
         hdf5_export_port: IScanExportPort,
+        binary_export_port: Optional[IScanExportPort] = None,
+        raw_capture: bool = False,
     ) -> None:
+        """
+        Args:
+            raw_capture: The executor publishes ScanPointRawSamplesAcquired
+                (checked against the selected format at scan start).
+        """
         self._event_bus = event_bus
         self._csv_export_port = csv_export_port
         self._hdf5_export_port = hdf5_export_port
+        self._binary_export_port = binary_export_port
         self._active_port: Optional[IScanExportPort] = None
+        self._raw_capture = raw_capture
+        self._raw_samples_warned = False
 
         self._config: Optional[ExportConfigDTO] = None
         self._export_active: bool = False  # True between ScanStarted and completion/failure/cancel
 
         # Subscribe to scan events
-        self._event_bus.subscribe("scanstarted", self._on_event)
-        self._event_bus.subscribe("scanpointacquired", self._on_event)
-        self._event_bus.subscribe("scancompleted", self._on_event)
-        self._event_bus.subscribe("scanfailed", self._on_event)
-        self._event_bus.subscribe("scancancelled", self._on_event)
+        self._event_bus.subscribe(SCAN_STARTED, self._on_event)
+        self._event_bus.subscribe(SCAN_POINT_ACQUIRED, self._on_event)
+        self._event_bus.subscribe(SCAN_POINT_RAW_SAMPLES_ACQUIRED, self._on_event)
+        self._event_bus.subscribe(SCAN_COMPLETED, self._on_event)
+        self._event_bus.subscribe(SCAN_FAILED, self._on_event)
+        self._event_bus.subscribe(SCAN_CANCELLED, self._on_event)
 
     # ------------------------------------------------------------------ #
     # Configuration API (called from UI / presenter)
@@ -94,6 +117,8 @@ class ScanExportService:
                 self._handle_scan_started(event)
             elif isinstance(event, ScanPointAcquired):
                 self._handle_scan_point_acquired(event)
+            elif isinstance(event, ScanPointRawSamplesAcquired):
+                self._handle_raw_samples(event)
             elif isinstance(event, (ScanCompleted, ScanFailed, ScanCancelled)):
                 self._handle_scan_finished(event)
         except Exception as exc:
@@ -108,12 +133,18 @@ class ScanExportService:
             return
 
         # Select the appropriate export port based on configuration.
-        fmt = (self._config.format or "CSV").upper()
+        fmt = (self._config.format or "BINARY").upper()
         if fmt == "HDF5":
             self._active_port = self._hdf5_export_port
+        elif fmt == "BINARY" and self._binary_export_port is not None:
+            self._active_port = self._binary_export_port
         else:
             self._active_port = self._csv_export_port
 
+        self._raw_samples_warned = False
+        if self._raw_capture and not self._active_port.supports_raw_samples():
+            self._warn_raw_samples_dropped(fmt)
+
         directory = self._config.output_directory
         # Base filename specific to exported scan data; actual timestamp
         # is applied inside the export port implementation.
@@ -137,9 +168,25 @@ class ScanExportService:
         if not self._export_active:
             return
 
-        data = self._flatten_point(event)
         if self._active_port is not None:
-            self._active_port.write_point(data)
+            self._active_port.write_row(self._to_row(event))
+
+    def _handle_raw_samples(self, event: ScanPointRawSamplesAcquired) -> None:
+        if not self._export_active or self._active_port is None:
+            return
+        if not self._active_port.supports_raw_samples():
+            self._warn_raw_samples_dropped((self._config.format or "BINARY").upper())
+            return
+        self._active_port.write_raw_samples(event.point_index, event.samples)
+
+    def _warn_raw_samples_dropped(self, fmt: str) -> None:
+        """Once per scan: raw capture is on but the selected format cannot store it."""
+        if self._raw_samples_warned:
+            return
+        self._raw_samples_warned = True
+        print(f"[ScanExportService] WARNING: raw sample capture is enabled but the {fmt} export "
+              f"does not store raw samples (use HDF5): they will be dropped")
+        logger.warning("Raw sample capture enabled with %s export: raw samples are dropped", fmt)
 
     def _handle_scan_finished(self, event: DomainEvent) -> None:
         if not self._export_active:
@@ -162,7 +209,7 @@ class ScanExportService:
         cfg = event.config
         zone = cfg.scan_zone
 
-        return {
+        metadata = {
             "scan_id": str(event.scan_id),
             "pattern": cfg.scan_pattern.name,
             "x_min": zone.x_min,
@@ -174,39 +221,57 @@ class ScanExportService:
             "stabilization_delay_ms": cfg.stabilization_delay_ms,
             "averaging_per_position": cfg.averaging_per_position,
         }
-
-    def _flatten_point(self, event: ScanPointAcquired) -> Dict[str, Any]:
+        adaptive = getattr(cfg, "adaptive_averaging", None)
+        if adaptive is not None:
+            metadata["adaptive_target_standard_error_volts"] = list(adaptive.target_standard_error_volts)
+            metadata["adaptive_min_samples"] = adaptive.min_samples
+            metadata["adaptive_max_samples"] = adaptive.max_samples
+        refinement = getattr(cfg, "refinement", None)
+        if refinement is not None:
+            metadata["refinement_levels"] = refinement.levels
+            metadata["refinement_subdivision"] = refinement.subdivision
+            metadata["refinement_threshold_fraction"] = refinement.threshold_fraction
+            if refinement.threshold_volts is not None:
+                metadata["refinement_threshold_volts"] = refinement.threshold_volts
+        return metadata
+
+    def _to_row(self, event: ScanPointAcquired) -> ScanPointRow:
         """
-        Flatten a `ScanPointAcquired` event into a dict suitable for CSV.
+        Convert a `ScanPointAcquired` event into a typed export row.
 
         Includes:
         - scan_id, point_index
         - x, y
         - mean voltages for each component
         - standard deviations for each component (if available)
+        - number of samples averaged (if available)
+        - resolution level of the point (multi-resolution scans)
         """
         pos = event.position
         m = event.measurement
 
-        return {
-            "scan_id": str(event.scan_id),
-            "point_index": event.point_index,
-            "x": pos.x,
-            "y": pos.y,
-            # Mean voltages
-            "voltage_x_in_phase": m.voltage_x_in_phase,
-            "voltage_x_quadrature": m.voltage_x_quadrature,
-            "voltage_y_in_phase": m.voltage_y_in_phase,
-            "voltage_y_quadrature": m.voltage_y_quadrature,
-            "voltage_z_in_phase": m.voltage_z_in_phase,
-            "voltage_z_quadrature": m.voltage_z_quadrature,
+        return ScanPointRow(
+            scan_id=str(event.scan_id),
+            point_index=event.point_index,
+            x=pos.x,
+            y=pos.y,
+            voltages=(
+                m.voltage_x_in_phase,
+                m.voltage_x_quadrature,
+                m.voltage_y_in_phase,
+                m.voltage_y_quadrature,
+                m.voltage_z_in_phase,
+                m.voltage_z_quadrature,
+            ),
             # Standard deviations (may be None if not provided)
-            "std_dev_x_in_phase": getattr(m, "std_dev_x_in_phase", None),
-            "std_dev_x_quadrature": getattr(m, "std_dev_x_quadrature", None),
-            "std_dev_y_in_phase": getattr(m, "std_dev_y_in_phase", None),
-            "std_dev_y_quadrature": getattr(m, "std_dev_y_quadrature", None),
-            "std_dev_z_in_phase": getattr(m, "std_dev_z_in_phase", None),
-            "std_dev_z_quadrature": getattr(m, "std_dev_z_quadrature", None),
-        }
-
-
+            std_devs=(
+                getattr(m, "std_dev_x_in_phase", None),
+                getattr(m, "std_dev_x_quadrature", None),
+                getattr(m, "std_dev_y_in_phase", None),
+                getattr(m, "std_dev_y_quadrature", None),
+                getattr(m, "std_dev_z_in_phase", None),
+                getattr(m, "std_dev_z_quadrature", None),
+            ),
+            sample_count=getattr(m, "sample_count", None),
+            level=event.level,
+        )
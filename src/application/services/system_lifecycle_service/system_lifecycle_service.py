@@ -24,6 +24,12 @@ from domain.events.system_events import (
     SystemShuttingDownEvent,
     SystemShutdownCompleteEvent,
 )
+from domain.events.event_topics import (
+    SYSTEM_READY,
+    SYSTEM_SHUTDOWN_COMPLETE,
+    SYSTEM_SHUTTING_DOWN,
+    SYSTEM_STARTUP_FAILED,
+)
 from .i_hardware_initialization_port import IHardwareInitializationPort
 from .i_system_lifecycle_output_port import ISystemLifecycleOutputPort
 
@@ -180,10 +186,10 @@ class SystemStartupApplicationService:
 
         if success:
             # We only publish a lightweight event (no heavy infra objects inside)
-            self._event_bus.publish("systemready", SystemReadyEvent())
+            self._event_bus.publish(SYSTEM_READY, SystemReadyEvent())
         else:
             reason = "; ".join(errors)
-            self._event_bus.publish("systemstartupfailed", SystemStartupFailedEvent(reason=reason))
+            self._event_bus.publish(SYSTEM_STARTUP_FAILED, SystemStartupFailedEvent(reason=reason))
 
         result = StartupResult(success=success, initialized_resources=resources, errors=errors)
         
@@ -235,7 +241,7 @@ class SystemShutdownApplicationService:
             self._output_port.present_shutdown_started()
 
         # 1. Notify start of shutdown
-        self._event_bus.publish("systemshuttingdown", SystemShuttingDownEvent())
+        self._event_bus.publish(SYSTEM_SHUTTING_DOWN, SystemShuttingDownEvent())
 
         # 2. Stop scan operations
         if self._scan_service is not None:
@@ -288,7 +294,7 @@ class SystemShutdownApplicationService:
         success = not errors and all(cleanup_status.values()) if cleanup_status else not errors
 
         self._event_bus.publish(
-            "systemshutdowncomplete",
+            SYSTEM_SHUTDOWN_COMPLETE,
             SystemShutdownCompleteEvent(success=success, details="; ".join(errors)),
         )
 
@@ -23,6 +23,17 @@ class TestTransformationService(DiagramFriendlyTest):
         self.assertAlmostEqual(y, 1.0, places=5)
         self.assertAlmostEqual(z, 0.0, places=5)
 
+    def test_rotation_matrix_matches_vector_transform(self):
+        self.assertEqual(self.service.get_rotation_matrix().tolist(),
+                         [[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]])
+        self.service.set_rotation_angles(10.0, -20.0, 30.0)
+        self.service.set_enabled(True)
+        vector = (0.3, -1.2, 2.0)
+        expected = self.service.transform_sensor_to_source(vector)
+        got = self.service.get_rotation_matrix() @ vector
+        for e, g in zip(expected, got):
+            self.assertAlmostEqual(e, g, places=12)
+
 
 if __name__ == "__main__":
     unittest.main()
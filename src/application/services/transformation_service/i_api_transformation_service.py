@@ -35,5 +35,8 @@ class IApiTransformationService(ABC):
     @abstractmethod
     def transform_source_to_sensor(self, vector: Tuple[float, float, float]) -> Tuple[float, float, float]: ...
 
+    @abstractmethod
+    def get_rotation_matrix(self) -> "numpy.ndarray": ...
+
     @abstractmethod
     def force_transform_sensor_to_source(self, vector: Tuple[float, float, float]) -> Tuple[float, float, float]: ...
@@ -4,6 +4,7 @@ from scipy.spatial.transform import Rotation as R
 
 from domain.events.i_domain_event_bus import IDomainEventBus
 from domain.events.transformation_events import SensorTransformationAnglesUpdated
+from domain.events.event_topics import SENSOR_TRANSFORMATION_ANGLES_UPDATED
 
 class TransformationService:
     """
@@ -25,7 +26,7 @@ class TransformationService:
         self._rotation = R.from_euler('XYZ', self._angles, degrees=True)
         
         if self._event_bus:
-            self._event_bus.publish("sensortransformationanglesupdated", SensorTransformationAnglesUpdated(
+            self._event_bus.publish(SENSOR_TRANSFORMATION_ANGLES_UPDATED, SensorTransformationAnglesUpdated(
                 theta_x=theta_x, 
                 theta_y=theta_y, 
                 theta_z=theta_z
@@ -42,6 +43,15 @@ class TransformationService:
     def is_enabled(self) -> bool:
         return self._enabled
 
+    def get_rotation_matrix(self) -> np.ndarray:
+        """
+        3x3 matrix of transform_sensor_to_source (identity when disabled).
+        For block processing: v_source = M @ v_sensor.
+        """
+        if not self._enabled:
+            return np.eye(3)
+        return self._rotation.as_matrix()
+
     def transform_sensor_to_source(self, vector: Tuple[float, float, float]) -> Tuple[float, float, float]:
         """
         Apply DIRECT rotation (Sensor -> Source).
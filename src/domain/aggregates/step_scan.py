@@ -44,6 +44,8 @@ class StepScan(SpatialScan):
         return self._expected_points
 
     _expected_points: int = 0
+    # Multi-resolution: more points are planned after the coarse grid
+    _refining: bool = False
     
     def start(self, config) -> None: # Added config for event
         super().start()
@@ -54,6 +56,7 @@ class StepScan(SpatialScan):
         else:
              # Fallback calculation if method doesn't exist directly on config object passed
              self._expected_points = config.x_nb_points * config.y_nb_points
+        self._refining = getattr(config, "refinement", None) is not None
              
         self._domain_events.append(ScanStarted(scan_id=self.id, config=config))
         
@@ -66,13 +69,20 @@ class StepScan(SpatialScan):
             scan_id=self.id,
             point_index=result.point_index,
             position=result.position,
-            measurement=result.measurement
+            measurement=result.measurement,
+            level=result.level,
         ))
         
-        # Auto-complete if we reached expected points
-        if self._expected_points > 0 and len(self._points) >= self._expected_points:
+        # Auto-complete if we reached expected points (refined scans are completed by the executor)
+        if not self._refining and self._expected_points > 0 and len(self._points) >= self._expected_points:
             self.complete()
             
+    def extend_expected_points(self, count: int) -> None:
+        """Add the points of a refinement level to the expected total (progress)."""
+        if count < 0:
+            raise ValueError(f"count must be >= 0, got {count}")
+        self._expected_points += count
+            
     def complete(self) -> None:
         if self.status == ScanStatus.COMPLETED:
             return # Already completed
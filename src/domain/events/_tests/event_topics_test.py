@@ -0,0 +1,54 @@
+import unittest
+
+from domain.events.domain_event import DomainEvent
+from domain.events.event_topics import (
+    EVENT_TOPICS,
+    EventTopicRegistry,
+    SCAN_STARTED,
+    SYSTEM_READY,
+    UnknownEventTopicError,
+    topic_of,
+)
+from domain.events.scan_events import ScanStarted
+from domain.events.system_events import SystemReadyEvent
+
+
+class _AdHocEvent(DomainEvent):
+    pass
+
+
+class TestEventTopics(unittest.TestCase):
+
+    def test_default_topic_is_lowercase_class_name(self):
+        self.assertEqual(SCAN_STARTED, "scanstarted")
+        self.assertEqual(EVENT_TOPICS.topic_of(ScanStarted(scan_id="s", config=None)), "scanstarted")
+
+    def test_explicit_topic(self):
+        self.assertEqual(SYSTEM_READY, "systemready")
+        self.assertEqual(topic_of(SystemReadyEvent()), "systemready")
+
+    def test_topics_are_interned(self):
+        self.assertIs(EVENT_TOPICS.resolve("".join(["scan", "started"])), SCAN_STARTED)
+
+    def test_unknown_topic_rejected(self):
+        with self.assertRaises(UnknownEventTopicError):
+            EVENT_TOPICS.resolve("ScanStarted")
+        with self.assertRaises(UnknownEventTopicError):
+            EVENT_TOPICS.resolve("scanstarted_typo")
+
+    def test_unregistered_event_class_registered_on_first_use(self):
+        registry = EventTopicRegistry()
+        self.assertFalse(registry.is_known("_adhocevent"))
+        self.assertEqual(registry.topic_of(_AdHocEvent()), "_adhocevent")
+        self.assertTrue(registry.is_known("_adhocevent"))
+
+    def test_conflicting_registration_rejected(self):
+        registry = EventTopicRegistry()
+        registry.register(_AdHocEvent, "adhoc")
+        self.assertEqual(registry.register(_AdHocEvent, "adhoc"), "adhoc")
+        with self.assertRaises(ValueError):
+            registry.register(_AdHocEvent, "other")
+
+
+if __name__ == "__main__":
+    unittest.main()
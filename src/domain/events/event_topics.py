@@ -0,0 +1,152 @@
+"""
+Event Topics - Domain Layer
+
+Responsibility:
+- Single registry of the event bus topics: event class <-> topic string.
+- Resolve the topic of an event in O(1) (cached per class), instead of
+  `type(event).__name__.lower()` on every publish.
+- Reject unknown topics (typos, wrong case) when a handler subscribes.
+
+Design:
+- Topics stay strings (the `IDomainEventBus` contract is string-keyed), but
+  are interned once here: bus dictionaries hash and compare them by identity
+  fast path. Existing string literals ("scanstarted") remain valid keys.
+- Default topic = lowercase class name; explicit topics where the system
+  historically publishes another name (e.g. SystemReadyEvent -> "systemready").
+- `EVENT_TOPICS` is the registry of the domain events; modules import the
+  topic constants (SCAN_STARTED, ...) rather than writing literals.
+"""
+
+import sys
+import threading
+from typing import Dict, FrozenSet, Optional, Type
+
+from domain.events.continuous_acquisition_events import (
+    ContinuousAcquisitionSampleAcquired,
+    ContinuousAcquisitionFailed,
+    ContinuousAcquisitionStopped,
+)
+from domain.events.motion_events import (
+    MotionStarted,
+    MotionCompleted,
+    MotionFailed,
+    PositionUpdated,
+    MotionStopped,
+    EmergencyStopTriggered,
+)
+from domain.events.scan_events import (
+    ScanStarted,
+    ScanPointAcquired,
+    ScanPointRawSamplesAcquired,
+    ScanCompleted,
+    ScanFailed,
+    ScanCancelled,
+    ScanPaused,
+    ScanResumed,
+)
+from domain.events.system_events import (
+    SystemReadyEvent,
+    SystemStartupFailedEvent,
+    SystemShuttingDownEvent,
+    SystemShutdownCompleteEvent,
+)
+from domain.events.transformation_events import SensorTransformationAnglesUpdated
+
+
+class UnknownEventTopicError(ValueError):
+    """Raised when subscribing to a topic that no event is published on."""
+
+
+class EventTopicRegistry:
+    """Event class <-> interned topic string."""
+
+    def __init__(self) -> None:
+        self._lock = threading.Lock()
+        self._by_type: Dict[type, str] = {}
+        self._topics: FrozenSet[str] = frozenset()
+
+    def register(self, event_type: Type, topic: Optional[str] = None) -> str:
+        """
+        Register an event class and return its (interned) topic.
+
+        Raises:
+            ValueError: If the class is already registered under another topic.
+        """
+        topic = sys.intern(topic or event_type.__name__.lower())
+        with self._lock:
+            existing = self._by_type.get(event_type)
+            if existing is not None and existing != topic:
+                raise ValueError(f"{event_type.__name__} already registered as '{existing}'")
+            self._by_type[event_type] = topic
+            self._topics = self._topics | {topic}
+        return topic
+
+    def topic_of(self, event) -> str:
+        """
+        Topic of an event instance (one dict lookup once the class is known).
+
+        Unregistered classes (test doubles, ad-hoc events) fall back to the
+        lowercase class name, registered on first use.
+        """
+        topic = self._by_type.get(type(event))
+        if topic is None:
+            topic = self.register(type(event))
+        return topic
+
+    def resolve(self, topic: str) -> str:
+        """
+        Interned form of a known topic.
+
+        Raises:
+            UnknownEventTopicError: If no registered event uses this topic.
+        """
+        if topic not in self._topics:
+            raise UnknownEventTopicError(f"Unknown event topic '{topic}'")
+        return sys.intern(topic)
+
+    def is_known(self, topic: str) -> bool:
+        return topic in self._topics
+
+    @property
+    def topics(self) -> FrozenSet[str]:
+        return self._topics
+
+
+EVENT_TOPICS = EventTopicRegistry()
+
+# Scan
+SCAN_STARTED = EVENT_TOPICS.register(ScanStarted)
+SCAN_POINT_ACQUIRED = EVENT_TOPICS.register(ScanPointAcquired)
+SCAN_POINT_RAW_SAMPLES_ACQUIRED = EVENT_TOPICS.register(ScanPointRawSamplesAcquired)
+SCAN_COMPLETED = EVENT_TOPICS.register(ScanCompleted)
+SCAN_FAILED = EVENT_TOPICS.register(ScanFailed)
+SCAN_CANCELLED = EVENT_TOPICS.register(ScanCancelled)
+SCAN_PAUSED = EVENT_TOPICS.register(ScanPaused)
+SCAN_RESUMED = EVENT_TOPICS.register(ScanResumed)
+
+# Motion
+MOTION_STARTED = EVENT_TOPICS.register(MotionStarted)
+MOTION_COMPLETED = EVENT_TOPICS.register(MotionCompleted)
+MOTION_FAILED = EVENT_TOPICS.register(MotionFailed)
+POSITION_UPDATED = EVENT_TOPICS.register(PositionUpdated)
+MOTION_STOPPED = EVENT_TOPICS.register(MotionStopped)
+EMERGENCY_STOP_TRIGGERED = EVENT_TOPICS.register(EmergencyStopTriggered)
+
+# Continuous acquisition
+CONTINUOUS_ACQUISITION_SAMPLE_ACQUIRED = EVENT_TOPICS.register(ContinuousAcquisitionSampleAcquired)
+CONTINUOUS_ACQUISITION_FAILED = EVENT_TOPICS.register(ContinuousAcquisitionFailed)
+CONTINUOUS_ACQUISITION_STOPPED = EVENT_TOPICS.register(ContinuousAcquisitionStopped)
+
+# Transformation
+SENSOR_TRANSFORMATION_ANGLES_UPDATED = EVENT_TOPICS.register(SensorTransformationAnglesUpdated)
+
+# System lifecycle (published without the "Event" suffix)
+SYSTEM_READY = EVENT_TOPICS.register(SystemReadyEvent, "systemready")
+SYSTEM_STARTUP_FAILED = EVENT_TOPICS.register(SystemStartupFailedEvent, "systemstartupfailed")
+SYSTEM_SHUTTING_DOWN = EVENT_TOPICS.register(SystemShuttingDownEvent, "systemshuttingdown")
+SYSTEM_SHUTDOWN_COMPLETE = EVENT_TOPICS.register(SystemShutdownCompleteEvent, "systemshutdowncomplete")
+
+
+def topic_of(event) -> str:
+    """Topic of an event instance in the default registry."""
+    return EVENT_TOPICS.topic_of(event)
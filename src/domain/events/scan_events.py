@@ -7,6 +7,7 @@ Responsibility:
 """
 
 from dataclasses import dataclass
+from typing import Tuple
 from uuid import UUID
 from .domain_event import DomainEvent
 from ..value_objects.scan.step_scan_config import StepScanConfig
@@ -26,6 +27,14 @@ class ScanPointAcquired(DomainEvent):
     point_index: int
     position: Position2D
     measurement: VoltageMeasurement
+    level: int = 0  # Resolution level (multi-resolution scans)
+
+@dataclass(frozen=True)
+class ScanPointRawSamplesAcquired(DomainEvent):
+    """Event emitted with the individual samples of a point (raw capture mode)."""
+    scan_id: UUID
+    point_index: int
+    samples: Tuple[VoltageMeasurement, ...]
 
 @dataclass(frozen=True)
 class ScanCompleted(DomainEvent):
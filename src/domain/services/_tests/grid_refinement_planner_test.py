@@ -0,0 +1,117 @@
+import unittest
+from datetime import datetime
+
+from domain.services.grid_refinement_planner import GridRefinementPlanner
+from domain.services.scan_trajectory_factory import ScanTrajectoryFactory
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+from domain.value_objects.scan.grid_refinement import GridRefinement
+from domain.value_objects.scan.scan_pattern import ScanPattern
+from domain.value_objects.scan.scan_point_result import ScanPointResult
+from domain.value_objects.scan.scan_zone import ScanZone
+from domain.value_objects.scan.step_scan_config import StepScanConfig
+
+
+def config(refinement, nb_points=11):
+    return StepScanConfig(
+        scan_zone=ScanZone(x_min=0.0, x_max=10.0, y_min=0.0, y_max=10.0),
+        x_nb_points=nb_points,
+        y_nb_points=nb_points,
+        scan_pattern=ScanPattern.SERPENTINE,
+        stabilization_delay_ms=0,
+        averaging_per_position=1,
+        measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-6),
+        refinement=refinement,
+    )
+
+
+def edge_field(position):
+    """Object edge along x = 4.3: 1 V in-phase on X past the edge, 0 elsewhere."""
+    v = 1.0 if position.x > 4.3 else 0.0
+    return VoltageMeasurement(v, 0.0, 0.0, 0.0, 0.0, 0.0, timestamp=datetime.now())
+
+
+def measure(trajectory, field, first_index=0, level=0):
+    return [
+        ScanPointResult(position=p, measurement=field(p), point_index=first_index + i, level=level)
+        for i, p in enumerate(trajectory)
+    ]
+
+
+class TestGridRefinement(unittest.TestCase):
+
+    def test_validation(self):
+        with self.assertRaises(ValueError):
+            GridRefinement(levels=0)
+        with self.assertRaises(ValueError):
+            GridRefinement(subdivision=1)
+        with self.assertRaises(ValueError):
+            GridRefinement(threshold_fraction=0.0)
+        with self.assertRaises(ValueError):
+            config(GridRefinement(), nb_points=1)
+
+    def test_finest_points(self):
+        self.assertEqual(GridRefinement(levels=2, subdivision=2).finest_points(11), 41)
+
+
+class TestGridRefinementPlanner(unittest.TestCase):
+
+    def _run(self, cfg, field):
+        planner = GridRefinementPlanner(cfg)
+        results = measure(ScanTrajectoryFactory.create_trajectory(cfg), field)
+        levels = [results]
+        while not planner.finished:
+            refined = planner.plan_next_level(results)
+            if len(refined) == 0:
+                break
+            new = measure(refined, field, len(results), planner.level)
+            levels.append(new)
+            results = results + new
+        return planner, levels
+
+    def test_refines_only_around_the_edge(self):
+        planner, levels = self._run(config(GridRefinement(levels=2)), edge_field)
+        self.assertEqual(planner.level, 2)
+        level_1 = levels[1]
+        # Only the coarse column of cells 4..5 mm straddles the edge
+        self.assertTrue(all(4.0 <= r.position.x <= 5.0 for r in level_1))
+        # Sub-grid x in {4, 4.5, 5} x 21 rows, minus the 2 x 11 coarse points
+        self.assertEqual(len(level_1), 3 * 21 - 2 * 11)
+        # Level 2 stays within the level-1 cells that straddle the edge (4.0-4.5)
+        self.assertTrue(all(4.0 <= r.position.x <= 4.5 for r in levels[2]))
+
+    def test_points_are_never_measured_twice(self):
+        _, levels = self._run(config(GridRefinement(levels=3)), edge_field)
+        positions = [(r.position.x, r.position.y) for level in levels for r in level]
+        self.assertEqual(len(positions), len(set(positions)))
+
+    def test_far_fewer_points_than_the_uniform_fine_grid(self):
+        refinement = GridRefinement(levels=3)
+        _, levels = self._run(config(refinement), edge_field)
+        total = sum(len(level) for level in levels)
+        self.assertLess(total * 5, refinement.finest_points(11) ** 2)
+
+    def test_flat_response_is_not_refined(self):
+        flat = lambda p: VoltageMeasurement(0.5, 0.5, 0.5, 0.5, 0.5, 0.5, timestamp=datetime.now())
+        _, levels = self._run(config(GridRefinement(levels=2)), flat)
+        self.assertEqual(len(levels), 1)
+
+    def test_absolute_threshold(self):
+        # Variation of an edge cell is 1 V: a 2 V threshold refines nothing
+        _, levels = self._run(config(GridRefinement(levels=2, threshold_volts=2.0)), edge_field)
+        self.assertEqual(len(levels), 1)
+
+    def test_level_trajectory_is_serpentine(self):
+        planner = GridRefinementPlanner(config(GridRefinement(levels=1)))
+        cfg = config(GridRefinement(levels=1))
+        refined = planner.plan_next_level(measure(ScanTrajectoryFactory.create_trajectory(cfg), edge_field))
+        ys = [p.y for p in refined]
+        self.assertEqual(ys, sorted(ys))
+        first_row = [p.x for p in refined if p.y == ys[0]]
+        second_row = [p.x for p in refined if p.y == sorted(set(ys))[1]]
+        self.assertEqual(first_row, sorted(first_row))
+        self.assertEqual(second_row, sorted(second_row, reverse=True))
+
+
+if __name__ == "__main__":
+    unittest.main()
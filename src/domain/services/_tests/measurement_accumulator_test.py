@@ -0,0 +1,89 @@
+import math
+import random
+import unittest
+from datetime import datetime, timedelta
+
+from domain.services.measurement_accumulator import (
+    AccumulatorOptions,
+    AveragingEstimator,
+    MeasurementAccumulator,
+)
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+
+T0 = datetime(2025, 1, 1)
+
+
+def measurement(values, seconds=0.0):
+    return VoltageMeasurement(
+        voltage_x_in_phase=values[0], voltage_x_quadrature=values[1],
+        voltage_y_in_phase=values[2], voltage_y_quadrature=values[3],
+        voltage_z_in_phase=values[4], voltage_z_quadrature=values[5],
+        timestamp=T0 + timedelta(seconds=seconds),
+    )
+
+
+def two_pass(column):
+    mean = sum(column) / len(column)
+    return mean, math.sqrt(sum((v - mean) ** 2 for v in column) / (len(column) - 1))
+
+
+class TestMeasurementAccumulator(unittest.TestCase):
+    def setUp(self):
+        rng = random.Random(3)
+        # Large offset, small spread: naive sum-of-squares would lose precision
+        self.rows = [[1e3 + c + rng.gauss(0.0, 1e-3) for c in range(6)] for _ in range(200)]
+
+    def test_single_pass_matches_two_pass(self):
+        acc = MeasurementAccumulator()
+        for i, row in enumerate(self.rows):
+            acc.add(measurement(row, i))
+
+        for c in range(6):
+            mean, std = two_pass([row[c] for row in self.rows])
+            self.assertAlmostEqual(acc.mean()[c], mean, places=9)
+            self.assertAlmostEqual(acc.std()[c], std, places=9)
+        self.assertEqual(acc.to_measurement().timestamp, T0 + timedelta(seconds=199))
+
+    def test_merge_equals_sequential(self):
+        whole, part_a, part_b = MeasurementAccumulator(), MeasurementAccumulator(), MeasurementAccumulator()
+        for i, row in enumerate(self.rows):
+            whole.add(measurement(row, i))
+            (part_a if i < 70 else part_b).add(measurement(row, i))
+        part_a.merge(part_b)
+
+        self.assertEqual(part_a.count, whole.count)
+        for c in range(6):
+            self.assertAlmostEqual(part_a.mean()[c], whole.mean()[c], places=9)
+            self.assertAlmostEqual(part_a.std()[c], whole.std()[c], places=9)
+
+    def test_robust_estimators_reject_outlier(self):
+        values = [1.0, 1.1, 0.9, 1.0, 50.0]
+        median = MeasurementAccumulator(AccumulatorOptions(estimator=AveragingEstimator.MEDIAN))
+        trimmed = MeasurementAccumulator(AccumulatorOptions(estimator=AveragingEstimator.TRIMMED_MEAN,
+                                                            trim_fraction=0.2))
+        for v in values:
+            median.add(measurement([v] * 6))
+            trimmed.add(measurement([v] * 6))
+
+        self.assertAlmostEqual(median.to_measurement().voltage_x_in_phase, 1.0)
+        self.assertAlmostEqual(trimmed.to_measurement().voltage_z_quadrature, (1.0 + 1.1 + 1.0) / 3)
+
+    def test_empty_accumulator_raises(self):
+        with self.assertRaises(ValueError):
+            MeasurementAccumulator().to_measurement()
+
+    def test_standard_error_and_sample_count(self):
+        acc = MeasurementAccumulator()
+        acc.add(measurement([0.0] * 6))
+        self.assertTrue(all(math.isinf(se) for se in acc.standard_error()))
+        column = [0.0, 1.0, 2.0, 3.0]
+        for i, v in enumerate(column[1:], start=1):
+            acc.add(measurement([v] * 6, seconds=i))
+        _, std = two_pass(column)
+        for se in acc.standard_error():
+            self.assertAlmostEqual(se, std / math.sqrt(len(column)))
+        self.assertEqual(acc.to_measurement().sample_count, 4)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,110 @@
+import random
+import unittest
+
+from domain.services.scan_trajectory_factory import ScanTrajectoryFactory
+from domain.services.trajectory_optimizer import TrajectoryOptimizer
+from domain.value_objects.geometric.axis_motion_profile import AxisMotionProfile
+from domain.value_objects.geometric.position_2d import Position2D
+from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+from domain.value_objects.scan.scan_pattern import ScanPattern
+from domain.value_objects.scan.scan_trajectory import ScanTrajectory
+from domain.value_objects.scan.scan_zone import ScanZone
+from domain.value_objects.scan.step_scan_config import StepScanConfig
+
+
+def grid(pattern, x_points, y_points, size=10.0):
+    return ScanTrajectoryFactory.create_trajectory(StepScanConfig(
+        scan_zone=ScanZone(x_min=0.0, x_max=size, y_min=0.0, y_max=size),
+        x_nb_points=x_points,
+        y_nb_points=y_points,
+        scan_pattern=pattern,
+        stabilization_delay_ms=0,
+        averaging_per_position=1,
+        measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-6),
+    ))
+
+
+class TestAxisMotionProfile(unittest.TestCase):
+
+    def test_trapezoidal_move(self):
+        # 10 mm/s from rest in 1 s: ramps cover 10 mm in 2 s, 20 mm cruise in 2 s
+        profile = AxisMotionProfile(max_speed_mm_s=10.0, accel_time_s=1.0, decel_time_s=1.0)
+        self.assertAlmostEqual(profile.move_time(30.0), 4.0)
+        self.assertAlmostEqual(profile.move_time(-30.0), 4.0)
+        self.assertEqual(profile.move_time(0.0), 0.0)
+
+    def test_short_move_is_triangular(self):
+        profile = AxisMotionProfile(max_speed_mm_s=10.0, accel_time_s=1.0, decel_time_s=1.0)
+        # 2.5 mm: peak at 5 mm/s after 0.5 s, same time to stop
+        self.assertAlmostEqual(profile.move_time(2.5), 1.0)
+        self.assertAlmostEqual(profile.move_time(10.0), 2.0)
+
+    def test_without_ramps(self):
+        self.assertAlmostEqual(AxisMotionProfile(max_speed_mm_s=4.0).move_time(2.0), 0.5)
+
+    def test_from_step_parameters(self):
+        profile = AxisMotionProfile.from_step_parameters(10, 1500, 300, 200, mm_per_step=0.01)
+        self.assertAlmostEqual(profile.max_speed_mm_s, 15.0)
+        self.assertAlmostEqual(profile.start_speed_mm_s, 0.1)
+        self.assertAlmostEqual(profile.accel_time_s, 0.3)
+        self.assertAlmostEqual(profile.decel_time_s, 0.2)
+
+    def test_invalid_parameters(self):
+        with self.assertRaises(ValueError):
+            AxisMotionProfile(max_speed_mm_s=0.0)
+        with self.assertRaises(ValueError):
+            AxisMotionProfile(max_speed_mm_s=1.0, accel_time_s=-1.0)
+
+
+class TestTrajectoryOptimizer(unittest.TestCase):
+
+    def setUp(self):
+        fast = AxisMotionProfile(max_speed_mm_s=20.0, accel_time_s=0.1, decel_time_s=0.1)
+        slow = AxisMotionProfile(max_speed_mm_s=1.0, accel_time_s=0.5, decel_time_s=0.5)
+        self.fast = fast
+        self.slow_y = TrajectoryOptimizer(fast, slow)
+
+    def test_move_time_is_slowest_axis(self):
+        optimizer = self.slow_y
+        a, b = Position2D(0.0, 0.0), Position2D(10.0, 1.0)
+        self.assertAlmostEqual(optimizer.move_time(a, b), max(self.fast.move_time(10.0),
+                                                              optimizer._y.move_time(1.0)))
+
+    def test_slow_y_axis_prefers_rows_over_columns(self):
+        comb = grid(ScanPattern.COMB, 6, 6)
+        optimized = self.slow_y.optimize(comb)
+        self.assertLess(self.slow_y.total_move_time(optimized), self.slow_y.total_move_time(comb))
+        self.assertEqual(sorted(optimized.points, key=lambda p: (p.x, p.y)),
+                         sorted(comb.points, key=lambda p: (p.x, p.y)))
+
+    def test_slow_x_axis_prefers_columns(self):
+        slow_x = TrajectoryOptimizer(self.slow_y._y, self.fast)
+        serpentine = grid(ScanPattern.SERPENTINE, 6, 6)
+        optimized = slow_x.optimize(serpentine)
+        self.assertLess(slow_x.total_move_time(optimized), slow_x.total_move_time(serpentine))
+
+    def test_serpentine_kept_when_already_best(self):
+        serpentine = grid(ScanPattern.SERPENTINE, 5, 5)
+        optimized = self.slow_y.optimize(serpentine, start=Position2D(0.0, 0.0))
+        self.assertAlmostEqual(self.slow_y.total_move_time(optimized), self.slow_y.total_move_time(serpentine))
+
+    def test_irregular_points_never_slower(self):
+        rng = random.Random(3)
+        points = [Position2D(rng.uniform(0, 10), rng.uniform(0, 10)) for _ in range(60)]
+        trajectory = ScanTrajectory(points)
+        start = Position2D(5.0, 5.0)
+        optimized = self.slow_y.optimize(trajectory, start)
+        self.assertLess(self.slow_y.total_move_time(optimized, start),
+                        0.5 * self.slow_y.total_move_time(trajectory, start))
+        self.assertEqual(set(optimized.points), set(points))
+
+    def test_large_sets_use_line_orders_only(self):
+        optimizer = TrajectoryOptimizer(self.fast, self.slow_y._y, search_limit=10)
+        comb = grid(ScanPattern.COMB, 30, 30)
+        optimized = optimizer.optimize(comb)
+        self.assertEqual(len(optimized), 900)
+        self.assertLess(optimizer.total_move_time(optimized), optimizer.total_move_time(comb))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,174 @@
+"""
+Grid Refinement Planner - Domain Service
+
+Responsibility:
+- Plan the points of each refinement level of a multi-resolution scan from
+  the results already acquired (coarse grid, then previous levels).
+- Pure business logic, no side effects, no I/O.
+
+Rationale:
+- Only cells where the in-phase/quadrature response changes deserve a finer
+  step: the rest of the zone keeps the coarse resolution.
+
+Design:
+- Quadtree on an integer lattice: the finest step of the scan is 1 unit, a
+  coarse cell is subdivision**levels units wide. Lattice coordinates avoid
+  float comparisons when deciding whether a point was already measured.
+- Score of a cell: largest distance between the 6-channel vectors of its
+  4 corners (variation ~ gradient x cell size; an isolated anomaly raises
+  the score of the cells around it).
+- Threshold fixed once from the coarse cells (GridRefinement), then applied
+  to every level: only the sub-cells of refined cells are candidates.
+- Each level is returned as a serpentine-ordered ScanTrajectory.
+"""
+
+from array import array
+from collections import defaultdict
+import math
+from typing import Dict, Iterable, List, Optional, Set, Tuple
+
+from ..value_objects.scan.grid_refinement import GridRefinement
+from ..value_objects.scan.scan_point_result import ScanPointResult
+from ..value_objects.scan.scan_trajectory import ScanTrajectory
+from ..value_objects.scan.step_scan_config import StepScanConfig
+
+Node = Tuple[int, int]
+Vector = Tuple[float, float, float, float, float, float]
+
+
+class GridRefinementPlanner:
+    """
+    Level-by-level planner of a multi-resolution scan.
+    """
+
+    def __init__(self, config: StepScanConfig):
+        """
+        Raises:
+            ValueError: If the configuration has no refinement.
+        """
+        if config.refinement is None:
+            raise ValueError("GridRefinementPlanner needs a StepScanConfig with refinement")
+        self._refinement: GridRefinement = config.refinement
+        zone = config.scan_zone
+        self._x_min = zone.x_min
+        self._y_min = zone.y_min
+        self._scale = self._refinement.subdivision ** self._refinement.levels
+        # Lattice unit (mm) = finest step
+        self._x_unit = (zone.x_max - zone.x_min) / ((config.x_nb_points - 1) * self._scale)
+        self._y_unit = (zone.y_max - zone.y_min) / ((config.y_nb_points - 1) * self._scale)
+
+        self._values: Dict[Node, Vector] = {}
+        self._planned: Set[Node] = set()
+        # Candidate cells (lower-left node) of the next level, and their size
+        self._cells: List[Node] = [
+            (i * self._scale, j * self._scale)
+            for j in range(config.y_nb_points - 1)
+            for i in range(config.x_nb_points - 1)
+        ]
+        self._cell_size = self._scale
+        self._threshold: Optional[float] = None
+        self._level = 0
+
+    @property
+    def level(self) -> int:
+        """Last planned level (0 before the first refinement)."""
+        return self._level
+
+    @property
+    def threshold_volts(self) -> Optional[float]:
+        """Variation threshold in use (None until the coarse grid was scored)."""
+        return self._threshold
+
+    @property
+    def finished(self) -> bool:
+        return self._level >= self._refinement.levels or not self._cells
+
+    def record(self, results: Iterable[ScanPointResult]) -> None:
+        """Add acquired points (already known points are ignored)."""
+        for result in results:
+            node = self._node_of(result.position.x, result.position.y)
+            if node in self._values:
+                continue
+            m = result.measurement
+            self._values[node] = (
+                m.voltage_x_in_phase, m.voltage_x_quadrature,
+                m.voltage_y_in_phase, m.voltage_y_quadrature,
+                m.voltage_z_in_phase, m.voltage_z_quadrature,
+            )
+
+    def plan_next_level(self, results: Iterable[ScanPointResult] = ()) -> ScanTrajectory:
+        """
+        Record `results`, then return the points of the next level.
+
+        Returns an empty trajectory when no cell exceeds the threshold or the
+        last level was reached.
+        """
+        self.record(results)
+        if self.finished:
+            return ScanTrajectory()
+
+        scores = {cell: self._score(cell) for cell in self._cells}
+        if self._threshold is None:
+            self._threshold = self._initial_threshold(scores.values())
+        refined = [cell for cell, score in scores.items() if score is not None and score > self._threshold]
+
+        self._level += 1
+        size = self._cell_size // self._refinement.subdivision
+        step_range = range(0, self._cell_size + 1, size)
+        new_nodes: Set[Node] = set()
+        next_cells: List[Node] = []
+        for ox, oy in refined:
+            for dy in step_range:
+                for dx in step_range:
+                    node = (ox + dx, oy + dy)
+                    if node not in self._values and node not in self._planned:
+                        new_nodes.add(node)
+                    if dx < self._cell_size and dy < self._cell_size:
+                        next_cells.append(node)
+        self._cells = next_cells
+        self._cell_size = size
+        self._planned |= new_nodes
+        return self._serpentine(new_nodes)
+
+    # ------------------------------------------------------------------ #
+    # Helpers
+    # ------------------------------------------------------------------ #
+
+    def _score(self, cell: Node) -> Optional[float]:
+        """Largest distance between the corner vectors (None if a corner is missing)."""
+        ox, oy = cell
+        size = self._cell_size
+        corners = []
+        for node in ((ox, oy), (ox + size, oy), (ox, oy + size), (ox + size, oy + size)):
+            value = self._values.get(node)
+            if value is None:
+                return None
+            corners.append(value)
+        return max(
+            math.dist(corners[a], corners[b])
+            for a in range(len(corners))
+            for b in range(a + 1, len(corners))
+        )
+
+    def _initial_threshold(self, scores: Iterable[Optional[float]]) -> float:
+        if self._refinement.threshold_volts is not None:
+            return self._refinement.threshold_volts
+        largest = max((s for s in scores if s is not None), default=0.0)
+        return self._refinement.threshold_fraction * largest
+
+    def _node_of(self, x: float, y: float) -> Node:
+        ix = round((x - self._x_min) / self._x_unit) if self._x_unit else 0
+        iy = round((y - self._y_min) / self._y_unit) if self._y_unit else 0
+        return ix, iy
+
+    def _serpentine(self, nodes: Iterable[Node]) -> ScanTrajectory:
+        rows: Dict[int, List[int]] = defaultdict(list)
+        for ix, iy in nodes:
+            rows[iy].append(ix)
+        coords = array("d")
+        for row_number, iy in enumerate(sorted(rows)):
+            y = self._y_min + iy * self._y_unit
+            for ix in sorted(rows[iy], reverse=bool(row_number % 2)):
+                coords.append(self._x_min + ix * self._x_unit)
+                coords.append(y)
+        return ScanTrajectory.from_coordinates(coords)
@@ -0,0 +1,213 @@
+"""
+Domain Service: Measurement Accumulator
+Responsibility: Accumulate VoltageMeasurement samples one at a time and give
+the mean / standard deviation at any moment, without keeping the samples.
+
+Rationale:
+    With `averaging_per_position` in the hundreds, storing every sample of a
+    point then making two passes over them costs a list allocation and a second
+    loop. Welford's update is numerically stable in a single pass.
+
+Design:
+    - The 6 channels are kept packed in flat lists (same order as CHANNELS).
+    - `merge` combines partial accumulators (Chan et al. parallel formula).
+    - Robust estimators (median, trimmed mean) need the samples: only those
+      modes retain them. The std devs always come from the Welford moments.
+"""
+
+from dataclasses import dataclass
+from datetime import datetime
+from enum import Enum
+import math
+from typing import List, Optional, Sequence
+
+from ..value_objects.acquisition.voltage_measurement import VoltageMeasurement
+
+CHANNELS = (
+    "x_in_phase", "x_quadrature",
+    "y_in_phase", "y_quadrature",
+    "z_in_phase", "z_quadrature",
+)
+CHANNEL_COUNT = len(CHANNELS)
+
+
+class AveragingEstimator(Enum):
+    """Central value reported for an averaged point."""
+    MEAN = "mean"
+    MEDIAN = "median"
+    TRIMMED_MEAN = "trimmed_mean"
+
+
+@dataclass(frozen=True)
+class AccumulatorOptions:
+    """
+    - estimator: central value (MEAN needs no sample storage).
+    - trim_fraction: fraction cut at EACH end for TRIMMED_MEAN (0 <= f < 0.5).
+    """
+    estimator: AveragingEstimator = AveragingEstimator.MEAN
+    trim_fraction: float = 0.1
+
+    def __post_init__(self):
+        if not (0.0 <= self.trim_fraction < 0.5):
+            raise ValueError(f"trim_fraction must be in [0, 0.5), got {self.trim_fraction}")
+
+
+class MeasurementAccumulator:
+    """
+    Incremental 6-channel statistics over VoltageMeasurement samples.
+    """
+
+    def __init__(self, options: Optional[AccumulatorOptions] = None):
+        self._options = options or AccumulatorOptions()
+        self._count = 0
+        self._mean = [0.0] * CHANNEL_COUNT
+        self._m2 = [0.0] * CHANNEL_COUNT
+        self._last_timestamp: Optional[datetime] = None
+        self._first_uncertainty: Optional[float] = None
+        # Per-channel samples, only for robust estimators
+        self._samples: Optional[List[List[float]]] = (
+            None if self._options.estimator is AveragingEstimator.MEAN
+            else [[] for _ in range(CHANNEL_COUNT)]
+        )
+
+    # ------------------------------------------------------------------ #
+    # Commands
+    # ------------------------------------------------------------------ #
+
+    def add(self, measurement: VoltageMeasurement) -> None:
+        """Ingest one sample."""
+        if self._count == 0:
+            self._first_uncertainty = measurement.uncertainty_estimate_volts
+        self.add_values(
+            (
+                measurement.voltage_x_in_phase,
+                measurement.voltage_x_quadrature,
+                measurement.voltage_y_in_phase,
+                measurement.voltage_y_quadrature,
+                measurement.voltage_z_in_phase,
+                measurement.voltage_z_quadrature,
+            ),
+            measurement.timestamp,
+        )
+
+    def add_values(self, values: Sequence[float], timestamp: datetime) -> None:
+        """Ingest one sample given as 6 packed channel values (CHANNELS order)."""
+        self._count += 1
+        n = self._count
+        mean = self._mean
+        m2 = self._m2
+        for c in range(CHANNEL_COUNT):
+            v = values[c]
+            delta = v - mean[c]
+            mean[c] += delta / n
+            m2[c] += delta * (v - mean[c])
+        if self._samples is not None:
+            for c in range(CHANNEL_COUNT):
+                self._samples[c].append(values[c])
+        self._last_timestamp = timestamp
+
+    def merge(self, other: "MeasurementAccumulator") -> None:
+        """Fold another accumulator (e.g. a partial block) into this one."""
+        if other._count == 0:
+            return
+        if self._count == 0:
+            self._first_uncertainty = other._first_uncertainty
+        n_a, n_b = self._count, other._count
+        n = n_a + n_b
+        for c in range(CHANNEL_COUNT):
+            delta = other._mean[c] - self._mean[c]
+            self._mean[c] += delta * n_b / n
+            self._m2[c] += other._m2[c] + delta * delta * n_a * n_b / n
+        self._count = n
+        if self._samples is not None:
+            if other._samples is None:
+                raise ValueError("Cannot merge a MEAN accumulator into a robust one (samples missing)")
+            for c in range(CHANNEL_COUNT):
+                self._samples[c].extend(other._samples[c])
+        if other._last_timestamp is not None and (
+            self._last_timestamp is None or other._last_timestamp > self._last_timestamp
+        ):
+            self._last_timestamp = other._last_timestamp
+
+    # ------------------------------------------------------------------ #
+    # Queries
+    # ------------------------------------------------------------------ #
+
+    @property
+    def count(self) -> int:
+        return self._count
+
+    def mean(self) -> List[float]:
+        return list(self._mean)
+
+    def std(self) -> List[float]:
+        """Sample standard deviation (Bessel, n-1); 0.0 for a single sample."""
+        if self._count < 2:
+            return [0.0] * CHANNEL_COUNT
+        divisor = self._count - 1
+        return [math.sqrt(max(m2, 0.0) / divisor) for m2 in self._m2]
+
+    def standard_error(self) -> List[float]:
+        """Standard error of the mean (std / sqrt(n)); inf below 2 samples."""
+        if self._count < 2:
+            return [math.inf] * CHANNEL_COUNT
+        scale = 1.0 / (self._count * (self._count - 1))
+        return [math.sqrt(max(m2, 0.0) * scale) for m2 in self._m2]
+
+    def center(self) -> List[float]:
+        """Central value according to the configured estimator."""
+        estimator = self._options.estimator
+        if estimator is AveragingEstimator.MEAN:
+            return self.mean()
+        if estimator is AveragingEstimator.MEDIAN:
+            return [self._median(s) for s in self._samples]
+        return [self._trimmed_mean(s, self._options.trim_fraction) for s in self._samples]
+
+    def to_measurement(self) -> VoltageMeasurement:
+        """
+        Averaged VoltageMeasurement with std_dev_* populated.
+
+        Raises:
+            ValueError: If no sample was added.
+        """
+        if self._count == 0:
+            raise ValueError("Cannot calculate statistics on empty measurement list")
+        center = self.center()
+        std = self.std()
+        return VoltageMeasurement(
+            voltage_x_in_phase=center[0],
+            voltage_x_quadrature=center[1],
+            voltage_y_in_phase=center[2],
+            voltage_y_quadrature=center[3],
+            voltage_z_in_phase=center[4],
+            voltage_z_quadrature=center[5],
+            # Last timestamp: when the averaging completed
+            timestamp=self._last_timestamp,
+            # A single sample keeps its own uncertainty estimate
+            uncertainty_estimate_volts=self._first_uncertainty if self._count == 1 else None,
+            std_dev_x_in_phase=std[0],
+            std_dev_x_quadrature=std[1],
+            std_dev_y_in_phase=std[2],
+            std_dev_y_quadrature=std[3],
+            std_dev_z_in_phase=std[4],
+            std_dev_z_quadrature=std[5],
+            sample_count=self._count,
+        )
+
+    # ------------------------------------------------------------------ #
+    # Internal
+    # ------------------------------------------------------------------ #
+
+    @staticmethod
+    def _median(values: List[float]) -> float:
+        ordered = sorted(values)
+        n = len(ordered)
+        mid = n // 2
+        return ordered[mid] if n % 2 else 0.5 * (ordered[mid - 1] + ordered[mid])
+
+    @staticmethod
+    def _trimmed_mean(values: List[float], fraction: float) -> float:
+        ordered = sorted(values)
+        cut = int(len(ordered) * fraction)
+        kept = ordered[cut:len(ordered) - cut] if cut else ordered
+        return math.fsum(kept) / len(kept)
@@ -11,8 +11,8 @@ Rationale:
 - Deterministic and easily testable.
 """
 
-from typing import List
-from ..value_objects.geometric.position_2d import Position2D
+from array import array
+
 from ..value_objects.scan.step_scan_config import StepScanConfig
 from ..value_objects.scan.scan_pattern import ScanPattern
 from ..value_objects.validation_result import ValidationResult
@@ -31,42 +31,36 @@ class ScanTrajectoryFactory:
         """
         Create a ScanTrajectory for the given configuration.
         """
-        positions = []
+        coords = array("d")
         zone = config.scan_zone
         
         # Calculate step sizes
         x_step = (zone.x_max - zone.x_min) / (config.x_nb_points - 1) if config.x_nb_points > 1 else 0
         y_step = (zone.y_max - zone.y_min) / (config.y_nb_points - 1) if config.y_nb_points > 1 else 0
+        xs = [zone.x_min + i * x_step for i in range(config.x_nb_points)]
+        ys = [zone.y_min + j * y_step for j in range(config.y_nb_points)]
         
+        # Coordinates are written straight into the trajectory storage:
+        # no Position2D object per point on fine grids.
         if config.scan_pattern == ScanPattern.SERPENTINE:
             # Serpentine: alternating direction on each line
-            for j in range(config.y_nb_points):
-                y = zone.y_min + j * y_step
-                if j % 2 == 0:
-                    # Left to right
-                    for i in range(config.x_nb_points):
-                        x = zone.x_min + i * x_step
-                        positions.append(Position2D(x=x, y=y))
-                else:
-                    # Right to left
-                    for i in range(config.x_nb_points - 1, -1, -1):
-                        x = zone.x_min + i * x_step
-                        positions.append(Position2D(x=x, y=y))
+            for j, y in enumerate(ys):
+                for x in (xs if j % 2 == 0 else reversed(xs)):
+                    coords.append(x)
+                    coords.append(y)
         
         elif config.scan_pattern == ScanPattern.RASTER:
             # Raster: always left to right
-            for j in range(config.y_nb_points):
-                y = zone.y_min + j * y_step
-                for i in range(config.x_nb_points):
-                    x = zone.x_min + i * x_step
-                    positions.append(Position2D(x=x, y=y))
+            for y in ys:
+                for x in xs:
+                    coords.append(x)
+                    coords.append(y)
         
         elif config.scan_pattern == ScanPattern.COMB:
             # Comb: scan each column completely before moving to next
-            for i in range(config.x_nb_points):
-                x = zone.x_min + i * x_step
-                for j in range(config.y_nb_points):
-                    y = zone.y_min + j * y_step
-                    positions.append(Position2D(x=x, y=y))
+            for x in xs:
+                for y in ys:
+                    coords.append(x)
+                    coords.append(y)
         
-        return ScanTrajectory(points=positions)
+        return ScanTrajectory.from_coordinates(coords)
@@ -0,0 +1,188 @@
+"""
+Trajectory Optimizer - Domain Service
+
+Responsibility:
+- Reorder the points of a ScanTrajectory to minimise the total move time
+  of the stage.
+- Pure business logic, no side effects, no I/O.
+
+Rationale:
+- X and Y move simultaneously: a move lasts as long as the slower axis,
+  max(t_x, t_y), not the Euclidean distance. With a slow Y axis the
+  default serpentine may not be the fastest order, and irregular point
+  sets (ROI, refinement) have no natural order at all.
+
+Design:
+- Cost of a move from the two AxisMotionProfile (ramps included).
+- Candidates: input order, row / column serpentines, their reverses,
+  and, for small sets, nearest neighbour + 2-opt; the cheapest wins.
+- The visited point set never changes, only its order.
+"""
+
+from collections import defaultdict
+from typing import Callable, Dict, List, Optional, Sequence, Tuple
+
+from ..value_objects.geometric.axis_motion_profile import AxisMotionProfile
+from ..value_objects.geometric.position_2d import Position2D
+from ..value_objects.scan.scan_trajectory import ScanTrajectory
+
+Order = List[int]
+
+
+class TrajectoryOptimizer:
+    """
+    Move-time aware ordering of scan points.
+    """
+
+    # Coordinates closer than this share a row / column (mm)
+    LINE_TOLERANCE_MM = 1e-6
+
+    def __init__(
+        self,
+        x_profile: AxisMotionProfile,
+        y_profile: AxisMotionProfile,
+        search_limit: int = 300,
+        max_two_opt_passes: int = 20,
+    ):
+        """
+        Args:
+            x_profile: Kinematics of the X axis.
+            y_profile: Kinematics of the Y axis.
+            search_limit: Largest point count for the nearest neighbour + 2-opt
+                search (O(n²) per pass); larger sets only compare the line orders.
+            max_two_opt_passes: Bound on 2-opt improvement passes.
+        """
+        self._x = x_profile
+        self._y = y_profile
+        self._search_limit = search_limit
+        self._max_two_opt_passes = max_two_opt_passes
+
+    # ------------------------------------------------------------------ #
+    # Cost
+    # ------------------------------------------------------------------ #
+
+    def move_time(self, a: Position2D, b: Position2D) -> float:
+        """Duration (s) of the move a -> b: both axes move together."""
+        return self._cost(a.x, a.y, b.x, b.y)
+
+    def total_move_time(self, trajectory: ScanTrajectory, start: Optional[Position2D] = None) -> float:
+        """Sum of the move durations along the trajectory (from `start` if given)."""
+        points = [trajectory.xy(i) for i in range(len(trajectory))]
+        return self._order_cost(points, list(range(len(points))), self._start_xy(start))
+
+    # ------------------------------------------------------------------ #
+    # Optimization
+    # ------------------------------------------------------------------ #
+
+    def optimize(self, trajectory: ScanTrajectory, start: Optional[Position2D] = None) -> ScanTrajectory:
+        """
+        Return the trajectory in the fastest order found.
+
+        Never slower than the input order (it is one of the candidates).
+        """
+        n = len(trajectory)
+        if n < 3 and start is None:
+            return trajectory
+
+        points = [trajectory.xy(i) for i in range(n)]
+        start_xy = self._start_xy(start)
+
+        candidates: List[Order] = [list(range(n))]
+        candidates.append(self._line_serpentine(points, axis=1))
+        candidates.append(self._line_serpentine(points, axis=0))
+        candidates += [order[::-1] for order in candidates]
+        if n <= self._search_limit:
+            candidates.append(self._two_opt(points, self._nearest_neighbour(points, start_xy), start_xy))
+
+        best = min(candidates, key=lambda order: self._order_cost(points, order, start_xy))
+        if best is candidates[0]:
+            return trajectory
+        return trajectory.reordered(best)
+
+    # ------------------------------------------------------------------ #
+    # Candidates
+    # ------------------------------------------------------------------ #
+
+    def _line_serpentine(self, points: Sequence[Tuple[float, float]], axis: int) -> Order:
+        """Group points in lines (axis=1: rows of equal y), alternate direction."""
+        lines: Dict[int, List[int]] = defaultdict(list)
+        for index, point in enumerate(points):
+            lines[round(point[axis] / self.LINE_TOLERANCE_MM)].append(index)
+
+        along = 1 - axis
+        order: Order = []
+        for line_number, key in enumerate(sorted(lines)):
+            line = sorted(lines[key], key=lambda i: points[i][along], reverse=bool(line_number % 2))
+            order.extend(line)
+        return order
+
+    def _nearest_neighbour(
+        self, points: Sequence[Tuple[float, float]], start_xy: Optional[Tuple[float, float]]
+    ) -> Order:
+        remaining = set(range(len(points)))
+        current = start_xy if start_xy is not None else points[0]
+        order: Order = []
+        while remaining:
+            cx, cy = current
+            nearest = min(remaining, key=lambda i: (self._cost(cx, cy, *points[i]), i))
+            remaining.remove(nearest)
+            order.append(nearest)
+            current = points[nearest]
+        return order
+
+    def _two_opt(
+        self,
+        points: Sequence[Tuple[float, float]],
+        order: Order,
+        start_xy: Optional[Tuple[float, float]],
+    ) -> Order:
+        """Open-path 2-opt: reverse order[i..j] while it shortens the path."""
+        # Node -1 is the fixed start position (if any)
+        path = [-1] + order if start_xy is not None else list(order)
+        coords = lambda node: start_xy if node == -1 else points[node]
+        cost: Callable[[int, int], float] = lambda a, b: self._cost(*coords(a), *coords(b))
+
+        first = 1 if start_xy is not None else 0
+        for _ in range(self._max_two_opt_passes):
+            improved = False
+            for i in range(first, len(path) - 1):
+                for j in range(i + 1, len(path)):
+                    before = after = 0.0
+                    if i > 0:
+                        before += cost(path[i - 1], path[i])
+                        after += cost(path[i - 1], path[j])
+                    if j + 1 < len(path):
+                        before += cost(path[j], path[j + 1])
+                        after += cost(path[i], path[j + 1])
+                    if after < before - 1e-12:
+                        path[i:j + 1] = reversed(path[i:j + 1])
+                        improved = True
+            if not improved:
+                break
+        return path[1:] if start_xy is not None else path
+
+    # ------------------------------------------------------------------ #
+    # Helpers
+    # ------------------------------------------------------------------ #
+
+    def _cost(self, ax: float, ay: float, bx: float, by: float) -> float:
+        return max(self._x.move_time(bx - ax), self._y.move_time(by - ay))
+
+    def _order_cost(
+        self,
+        points: Sequence[Tuple[float, float]],
+        order: Sequence[int],
+        start_xy: Optional[Tuple[float, float]],
+    ) -> float:
+        total = 0.0
+        previous = start_xy
+        for index in order:
+            point = points[index]
+            if previous is not None:
+                total += self._cost(*previous, *point)
+            previous = point
+        return total
+
+    @staticmethod
+    def _start_xy(start: Optional[Position2D]) -> Optional[Tuple[float, float]]:
+        return (start.x, start.y) if start is not None else None
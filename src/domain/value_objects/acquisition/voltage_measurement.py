@@ -60,6 +60,7 @@ class VoltageMeasurement:
     std_dev_y_quadrature: Optional[float] = None
     std_dev_z_in_phase: Optional[float] = None
     std_dev_z_quadrature: Optional[float] = None
+    sample_count: Optional[int] = None  # Number of samples averaged
     
     def __post_init__(self):
         """Validate voltage values are finite."""
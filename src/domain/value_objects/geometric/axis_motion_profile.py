@@ -0,0 +1,78 @@
+"""
+Domain: Axis Motion Profile
+
+Responsibility:
+    Kinematics of one stage axis: time to travel a distance with a
+    start speed, a maximum speed and fixed-duration ramps.
+
+Rationale:
+    Scan ordering must minimise the real duration of the moves, not the
+    travelled distance: axes differ in speed and short moves never leave
+    the acceleration ramp.
+
+Design:
+    - Frozen dataclass in mm / s (hardware agnostic)
+    - Ramp model of step-motor controllers: start at `start_speed`, reach
+      `max_speed` in `accel_time_s`, stop in `decel_time_s`
+    - Short moves (ramps overlap) use a triangular profile
+    - `from_step_parameters` converts controller units (Hz, ms, mm/step)
+"""
+from dataclasses import dataclass
+import math
+
+
+@dataclass(frozen=True)
+class AxisMotionProfile:
+    """Trapezoidal velocity profile of one axis."""
+
+    max_speed_mm_s: float
+    start_speed_mm_s: float = 0.0
+    accel_time_s: float = 0.0
+    decel_time_s: float = 0.0
+
+    def __post_init__(self):
+        """Validate parameters."""
+        if not self.max_speed_mm_s > 0:
+            raise ValueError(f"max_speed_mm_s must be > 0, got {self.max_speed_mm_s}")
+        if self.start_speed_mm_s < 0:
+            raise ValueError(f"start_speed_mm_s must be >= 0, got {self.start_speed_mm_s}")
+        if self.accel_time_s < 0 or self.decel_time_s < 0:
+            raise ValueError(f"Ramp times must be >= 0, got {self.accel_time_s}, {self.decel_time_s}")
+
+    @classmethod
+    def from_step_parameters(
+        cls,
+        start_speed_hz: float,
+        max_speed_hz: float,
+        accel_ms: float,
+        decel_ms: float,
+        mm_per_step: float,
+    ) -> "AxisMotionProfile":
+        """Build from controller parameters (LS/HS in steps/s, ACC/DEC in ms)."""
+        return cls(
+            max_speed_mm_s=max_speed_hz * mm_per_step,
+            start_speed_mm_s=start_speed_hz * mm_per_step,
+            accel_time_s=accel_ms / 1000.0,
+            decel_time_s=decel_ms / 1000.0,
+        )
+
+    def move_time(self, distance_mm: float) -> float:
+        """Duration (s) of a point-to-point move of `distance_mm` (sign ignored)."""
+        distance = abs(distance_mm)
+        if distance == 0:
+            return 0.0
+
+        v0 = min(self.start_speed_mm_s, self.max_speed_mm_s)
+        dv = self.max_speed_mm_s - v0
+        ramp_time = self.accel_time_s + self.decel_time_s
+        if dv <= 0 or ramp_time == 0:
+            return distance / self.max_speed_mm_s
+
+        ramp_distance = (v0 + self.max_speed_mm_s) / 2.0 * ramp_time
+        if distance >= ramp_distance:
+            return ramp_time + (distance - ramp_distance) / self.max_speed_mm_s
+
+        # Triangular profile: peak speed v_p with d = (v_p² - v0²) / 2 · k
+        k = ramp_time / dv  # 1/accel + 1/decel
+        peak_speed = math.sqrt(v0 * v0 + 2.0 * distance / k)
+        return (peak_speed - v0) * k
@@ -0,0 +1,38 @@
+import unittest
+
+from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+from domain.value_objects.scan.adaptive_averaging import AdaptiveAveraging
+
+
+class TestAdaptiveAveraging(unittest.TestCase):
+
+    def test_uniform_target_broadcast(self):
+        adaptive = AdaptiveAveraging.uniform(1e-6, min_samples=5, max_samples=50)
+        self.assertEqual(adaptive.target_standard_error_volts, (1e-6,) * 6)
+
+    def test_from_uncertainty(self):
+        adaptive = AdaptiveAveraging.from_uncertainty(MeasurementUncertainty(max_uncertainty_volts=2e-6))
+        self.assertEqual(adaptive.target_standard_error_volts, (2e-6,) * 6)
+
+    def test_stopping_rule(self):
+        targets = (1.0, 1.0, 1.0, 1.0, 1.0, 0.1)
+        adaptive = AdaptiveAveraging(targets, min_samples=3, max_samples=10)
+        quiet = [0.05] * 6
+        self.assertFalse(adaptive.is_reached(2, quiet))   # below min_samples
+        self.assertTrue(adaptive.is_reached(3, quiet))
+        self.assertFalse(adaptive.is_reached(5, [0.05] * 5 + [0.5]))  # one channel above its target
+        self.assertTrue(adaptive.is_reached(10, [9.0] * 6))  # max_samples reached
+
+    def test_invalid_parameters(self):
+        with self.assertRaises(ValueError):
+            AdaptiveAveraging.uniform(0.0)
+        with self.assertRaises(ValueError):
+            AdaptiveAveraging.uniform(1e-6, min_samples=1)
+        with self.assertRaises(ValueError):
+            AdaptiveAveraging.uniform(1e-6, min_samples=20, max_samples=10)
+        with self.assertRaises(ValueError):
+            AdaptiveAveraging((1e-6,) * 5)
+
+
+if __name__ == "__main__":
+    unittest.main()
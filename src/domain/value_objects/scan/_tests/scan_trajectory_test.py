@@ -0,0 +1,47 @@
+import unittest
+
+from domain.value_objects.geometric.position_2d import Position2D
+from domain.value_objects.scan.scan_trajectory import ScanTrajectory
+
+
+class TestScanTrajectory(unittest.TestCase):
+
+    def setUp(self):
+        self.points = [Position2D(float(i), float(10 * i)) for i in range(5)]
+        self.trajectory = ScanTrajectory(self.points)
+
+    def test_sequence_of_positions(self):
+        self.assertEqual(len(self.trajectory), 5)
+        self.assertEqual(self.trajectory.total_points, 5)
+        self.assertEqual(list(self.trajectory), self.points)
+        self.assertEqual(self.trajectory.points, self.points)
+        self.assertEqual(self.trajectory[2], Position2D(2.0, 20.0))
+        self.assertEqual(self.trajectory[-1], Position2D(4.0, 40.0))
+        with self.assertRaises(IndexError):
+            self.trajectory[5]
+
+    def test_from_coordinates_matches_points(self):
+        coords = [c for p in self.points for c in (p.x, p.y)]
+        self.assertEqual(ScanTrajectory.from_coordinates(coords), self.trajectory)
+        with self.assertRaises(ValueError):
+            ScanTrajectory.from_coordinates([1.0, 2.0, 3.0])
+
+    def test_slice_and_reorder(self):
+        self.assertEqual(list(self.trajectory[1:3]), self.points[1:3])
+        self.assertEqual(list(self.trajectory.reordered([4, 0, 2])),
+                         [self.points[4], self.points[0], self.points[2]])
+
+    def test_coordinates_view_is_read_only_n_by_2(self):
+        view = self.trajectory.coordinates
+        self.assertEqual(view.shape, (5, 2))
+        self.assertEqual(view[3, 1], 30.0)
+        self.assertTrue(view.readonly)
+        self.assertEqual(ScanTrajectory().coordinates.shape, (0,))
+
+    def test_immutable(self):
+        with self.assertRaises(AttributeError):
+            self.trajectory._coords = None
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,79 @@
+"""
+Domain: Adaptive Averaging
+
+Responsibility:
+    Stopping rule of the averaging at a scan point: stop as soon as every
+    channel reaches its target standard error of the mean, within a
+    [min_samples, max_samples] budget.
+
+Rationale:
+    A fixed `averaging_per_position` is sized for the noisiest point: quiet
+    background regions are averaged far longer than their precision needs.
+
+Design:
+    - Frozen dataclass, validated in __post_init__
+    - Target per channel (MeasurementAccumulator CHANNELS order); a single
+      value applies to the 6 channels
+    - Standard error = std / sqrt(n) (Welford std of the streaming accumulator)
+    - min_samples >= 2 so that the std estimate exists before any decision
+"""
+from dataclasses import dataclass
+from typing import Sequence, Tuple, Union
+
+from ..measurement_uncertainty import MeasurementUncertainty
+
+CHANNEL_COUNT = 6
+
+
+@dataclass(frozen=True)
+class AdaptiveAveraging:
+    """Target standard error per channel plus min/max sample counts."""
+
+    target_standard_error_volts: Tuple[float, ...]  # 6 values, CHANNELS order
+    min_samples: int = 10
+    max_samples: int = 1000
+
+    def __post_init__(self):
+        """Validate parameters."""
+        if len(self.target_standard_error_volts) != CHANNEL_COUNT:
+            raise ValueError(
+                f"target_standard_error_volts needs {CHANNEL_COUNT} values, got {len(self.target_standard_error_volts)}"
+            )
+        if any(not target > 0 for target in self.target_standard_error_volts):
+            raise ValueError(f"Target standard errors must be > 0, got {self.target_standard_error_volts}")
+        if self.min_samples < 2:
+            raise ValueError(f"min_samples must be >= 2, got {self.min_samples}")
+        if self.max_samples < self.min_samples:
+            raise ValueError(f"max_samples ({self.max_samples}) must be >= min_samples ({self.min_samples})")
+
+    @classmethod
+    def uniform(
+        cls,
+        target_standard_error_volts: Union[float, Sequence[float]],
+        min_samples: int = 10,
+        max_samples: int = 1000,
+    ) -> "AdaptiveAveraging":
+        """Build from one target for all channels, or one per channel."""
+        if isinstance(target_standard_error_volts, (int, float)):
+            targets = (float(target_standard_error_volts),) * CHANNEL_COUNT
+        else:
+            targets = tuple(float(t) for t in target_standard_error_volts)
+        return cls(targets, min_samples, max_samples)
+
+    @classmethod
+    def from_uncertainty(
+        cls,
+        uncertainty: MeasurementUncertainty,
+        min_samples: int = 10,
+        max_samples: int = 1000,
+    ) -> "AdaptiveAveraging":
+        """Target standard error = the scan's acceptable uncertainty on every channel."""
+        return cls.uniform(uncertainty.max_uncertainty_volts, min_samples, max_samples)
+
+    def is_reached(self, count: int, standard_errors: Sequence[float]) -> bool:
+        """True when sampling can stop after `count` samples."""
+        if count >= self.max_samples:
+            return True
+        if count < self.min_samples:
+            return False
+        return all(se <= target for se, target in zip(standard_errors, self.target_standard_error_volts))
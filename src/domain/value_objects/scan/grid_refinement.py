@@ -0,0 +1,47 @@
+"""
+Domain: Grid Refinement
+
+Responsibility:
+    Parameters of a multi-resolution scan: after the coarse grid, the cells
+    where the response varies are subdivided and scanned again, level by level.
+
+Rationale:
+    The object signature covers a fraction of the ScanZone: a uniform fine
+    grid spends most of its points on flat background.
+
+Design:
+    - Frozen dataclass, validated in __post_init__
+    - A cell is refined when the variation of its 4 corner measurements
+      (largest distance between their 6 in-phase/quadrature vectors) exceeds
+      the threshold: gradients and isolated anomalies both raise it
+    - Threshold: absolute (threshold_volts) or relative to the largest
+      variation of the coarse cells (threshold_fraction)
+    - Each refinement level divides the step by `subdivision`
+"""
+from dataclasses import dataclass
+from typing import Optional
+
+
+@dataclass(frozen=True)
+class GridRefinement:
+    """Number of refinement levels, subdivision factor and variation threshold."""
+
+    levels: int = 2  # Refinement passes after the coarse grid
+    subdivision: int = 2  # A refined cell is split into subdivision x subdivision cells
+    threshold_fraction: float = 0.2  # Of the largest coarse-cell variation
+    threshold_volts: Optional[float] = None  # Absolute threshold (overrides the fraction)
+
+    def __post_init__(self):
+        """Validate parameters."""
+        if self.levels < 1:
+            raise ValueError(f"levels must be >= 1, got {self.levels}")
+        if self.subdivision < 2:
+            raise ValueError(f"subdivision must be >= 2, got {self.subdivision}")
+        if not 0 < self.threshold_fraction <= 1:
+            raise ValueError(f"threshold_fraction must be in (0, 1], got {self.threshold_fraction}")
+        if self.threshold_volts is not None and not self.threshold_volts > 0:
+            raise ValueError(f"threshold_volts must be > 0, got {self.threshold_volts}")
+
+    def finest_points(self, coarse_points: int) -> int:
+        """Points along one axis of the finest grid reachable from `coarse_points`."""
+        return (coarse_points - 1) * self.subdivision ** self.levels + 1
@@ -16,7 +16,9 @@ class ScanPointResult:
     Result of a single scan point.
     
     Associates WHERE (Position) with WHAT (Measurement).
+    level: resolution level (0 = coarse grid, n = n-th refinement pass).
     """
     position: Position2D
     measurement: VoltageMeasurement
     point_index: int
+    level: int = 0
@@ -5,28 +5,125 @@ Responsibility:
 - Encapsulate the ordered list of positions to visit during a scan.
 - Represents the "Consignes" (Instructions) generated by the Domain.
 - Immutable.
+
+Design:
+- Backed by one flat array of doubles (x0, y0, x1, y1, ...): 16 bytes per
+  point instead of one Position2D object per point on very fine grids.
+- Index-addressable: Position2D objects are created on access only.
+  Executors and motion adapters index the trajectory (or read `xy(i)`)
+  instead of copying it into a list.
+- `coordinates` exposes the storage as a read-only (N, 2) memoryview
+  (zero-copy `numpy.asarray(trajectory.coordinates)` in infrastructure).
 """
 
-from dataclasses import dataclass
-from typing import List, Iterator
+from array import array
+from typing import Iterable, Iterator, List, Sequence, Tuple, Union, overload
+
 from ..geometric.position_2d import Position2D
 
-@dataclass(frozen=True)
+
 class ScanTrajectory:
     """
     Ordered sequence of positions for a scan.
     """
-    points: List[Position2D]
-    
-    def __iter__(self) -> Iterator[Position2D]:
-        return iter(self.points)
-    
+
+    __slots__ = ("_coords",)
+
+    def __init__(self, points: Iterable[Position2D] = ()):
+        coords = array("d")
+        for point in points:
+            coords.append(point.x)
+            coords.append(point.y)
+        object.__setattr__(self, "_coords", coords)
+
+    @classmethod
+    def from_coordinates(cls, coords: Union[array, Iterable[float]]) -> "ScanTrajectory":
+        """
+        Build from interleaved coordinates (x0, y0, x1, y1, ...).
+
+        Raises:
+            ValueError: On an odd number of values.
+        """
+        coords = coords if isinstance(coords, array) and coords.typecode == "d" else array("d", coords)
+        if len(coords) % 2:
+            raise ValueError("Interleaved coordinates need an even number of values")
+        trajectory = cls.__new__(cls)
+        object.__setattr__(trajectory, "_coords", coords)
+        return trajectory
+
+    def __setattr__(self, name, value):
+        raise AttributeError("ScanTrajectory is immutable")
+
+    # ------------------------------------------------------------------ #
+    # Sequence protocol
+    # ------------------------------------------------------------------ #
+
     def __len__(self) -> int:
-        return len(self.points)
-    
-    def __getitem__(self, index) -> Position2D:
-        return self.points[index]
-    
+        return len(self._coords) // 2
+
+    @overload
+    def __getitem__(self, index: int) -> Position2D: ...
+    @overload
+    def __getitem__(self, index: slice) -> "ScanTrajectory": ...
+
+    def __getitem__(self, index):
+        if isinstance(index, slice):
+            start, stop, step = index.indices(len(self))
+            return self.reordered(range(start, stop, step))
+        x, y = self.xy(index)
+        return Position2D(x=x, y=y)
+
+    def __iter__(self) -> Iterator[Position2D]:
+        coords = self._coords
+        for i in range(0, len(coords), 2):
+            yield Position2D(x=coords[i], y=coords[i + 1])
+
+    def __eq__(self, other) -> bool:
+        if not isinstance(other, ScanTrajectory):
+            return NotImplemented
+        return self._coords == other._coords
+
+    def __hash__(self) -> int:
+        return hash(self._coords.tobytes())
+
+    def __repr__(self) -> str:
+        return f"ScanTrajectory({len(self)} points)"
+
+    # ------------------------------------------------------------------ #
+    # Queries
+    # ------------------------------------------------------------------ #
+
+    def xy(self, index: int) -> Tuple[float, float]:
+        """(x, y) of a point without creating a Position2D."""
+        n = len(self)
+        if index < 0:
+            index += n
+        if not 0 <= index < n:
+            raise IndexError("ScanTrajectory index out of range")
+        return self._coords[2 * index], self._coords[2 * index + 1]
+
+    @property
+    def points(self) -> List[Position2D]:
+        """All positions as a list (allocates one object per point)."""
+        return list(self)
+
     @property
     def total_points(self) -> int:
-        return len(self.points)
+        return len(self)
+
+    @property
+    def coordinates(self) -> memoryview:
+        """Read-only (N, 2) view of the coordinates (no copy)."""
+        view = memoryview(self._coords).toreadonly()
+        if not len(self):
+            return view
+        return view.cast("B").cast("d", (len(self), 2))
+
+    def reordered(self, order: Sequence[int]) -> "ScanTrajectory":
+        """New trajectory visiting the points in `order` (indices into this one)."""
+        coords = self._coords
+        out = array("d")
+        for i in order:
+            out.append(coords[2 * i])
+            out.append(coords[2 * i + 1])
+        return ScanTrajectory.from_coordinates(out)
@@ -16,7 +16,10 @@ Design:
 from dataclasses import dataclass
 from .scan_zone import ScanZone
 from .scan_pattern import ScanPattern
+from typing import Optional
 from ..measurement_uncertainty import MeasurementUncertainty
+from .adaptive_averaging import AdaptiveAveraging
+from .grid_refinement import GridRefinement
 
 @dataclass(frozen=True)
 class StepScanConfig:
@@ -28,6 +31,10 @@ class StepScanConfig:
     - Scan trajectory pattern
     - Timing parameters
     - Measurement uncertainty requirements
+    - Optional adaptive averaging (stop a point once its target standard
+      error is reached, at most adaptive_averaging.max_samples samples)
+    - Optional grid refinement (multi-resolution: the x/y grid is the
+      coarse pass, refinement levels are planned from its results)
     """
     
     # Spatial configuration
@@ -47,6 +54,12 @@ class StepScanConfig:
     # Measurement quality requirement
     measurement_uncertainty: MeasurementUncertainty
     
+    # Adaptive averaging (None: always averaging_per_position samples)
+    adaptive_averaging: Optional[AdaptiveAveraging] = None
+    
+    # Multi-resolution (None: uniform grid only)
+    refinement: Optional[GridRefinement] = None
+    
     def __post_init__(self):
         """Validate configuration parameters."""
         if self.x_nb_points < 1:
@@ -60,9 +73,18 @@ class StepScanConfig:
         
         if self.averaging_per_position < 1:
             raise ValueError(f"averaging_per_position must be >= 1, got {self.averaging_per_position}")
+        
+        if self.refinement is not None and (self.x_nb_points < 2 or self.y_nb_points < 2):
+            raise ValueError("Grid refinement needs a coarse grid of at least 2 x 2 points")
+    
+    def max_samples_per_position(self) -> int:
+        """Upper bound of samples averaged at one position."""
+        if self.adaptive_averaging is not None:
+            return self.adaptive_averaging.max_samples
+        return self.averaging_per_position
     
     def total_points(self) -> int:
-        """Calculate total number of scan points."""
+        """Calculate total number of scan points (coarse pass with refinement)."""
         return self.x_nb_points * self.y_nb_points
     
     def validate(self):
@@ -85,12 +107,13 @@ class StepScanConfig:
         - Acquisition time per point (estimated)
         
         Note: Does not account for movement time (depends on distance and speed).
+        With adaptive averaging this is the worst case (max_samples everywhere).
         """
         # Time per point (stabilization + acquisition)
         stabilization_s = self.stabilization_delay_ms / 1000.0
         
         # Acquisition time per point (rough estimate: 100ms per averaged sample)
-        acquisition_s = self.averaging_per_position * 0.1
+        acquisition_s = self.max_samples_per_position() * 0.1
         
         time_per_point = stabilization_s + acquisition_s
         
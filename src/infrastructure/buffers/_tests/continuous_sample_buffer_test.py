@@ -0,0 +1,45 @@
+import unittest
+from datetime import datetime
+
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+from infrastructure.buffers.continuous_sample_buffer import ContinuousSampleBuffer
+
+
+def measurement(base, timestamp):
+    return VoltageMeasurement(
+        voltage_x_in_phase=base + 0.1,
+        voltage_x_quadrature=base + 0.2,
+        voltage_y_in_phase=base + 0.3,
+        voltage_y_quadrature=base + 0.4,
+        voltage_z_in_phase=base + 0.5,
+        voltage_z_quadrature=base + 0.6,
+        timestamp=timestamp,
+    )
+
+
+class TestContinuousSampleBuffer(unittest.TestCase):
+    def test_push_keeps_record_layout(self):
+        buffer = ContinuousSampleBuffer(capacity=4)
+        timestamp = datetime(2025, 1, 1, 12, 0, 0, 250000)
+        self.assertTrue(buffer.push(7, measurement(1.0, timestamp), monotonic_ns=123, mcu_counter=70000))
+
+        records = buffer.read()
+        self.assertEqual(len(records), 1)
+        self.assertEqual(int(records["index"][0]), 7)
+        self.assertEqual(int(records["monotonic_ns"][0]), 123)
+        self.assertEqual(int(records["mcu_counter"][0]), 70000)
+        self.assertEqual(int(records["timestamp_ns"][0]), int(timestamp.timestamp() * 1e9))
+        self.assertEqual(records["values"][0].tolist(), [1.1, 1.2, 1.3, 1.4, 1.5, 1.6])
+
+    def test_full_buffer_drops_and_counts(self):
+        buffer = ContinuousSampleBuffer(capacity=2)
+        now = datetime.now()
+        results = [buffer.push(i, measurement(float(i), now)) for i in range(3)]
+
+        self.assertEqual(results, [True, True, False])
+        self.assertEqual(buffer.overruns, 1)
+        self.assertEqual(list(buffer.read()["index"]), [0, 1])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,62 @@
+import threading
+import unittest
+
+import numpy as np
+
+from infrastructure.buffers.spsc_ring_buffer import SpscRingBuffer
+
+RECORD = np.dtype([("index", np.int64), ("values", np.float64, (6,))])
+
+
+def records(start, n):
+    out = np.zeros(n, dtype=RECORD)
+    out["index"] = np.arange(start, start + n)
+    out["values"] = out["index"][:, None] * 0.5
+    return out
+
+
+class TestSpscRingBuffer(unittest.TestCase):
+    def test_write_read_wraps_around(self):
+        ring = SpscRingBuffer(8, RECORD)
+        ring.write(records(0, 6))
+        self.assertEqual(list(ring.read(4)["index"]), [0, 1, 2, 3])
+
+        ring.write(records(6, 5))  # wraps
+        out = ring.read()
+        self.assertEqual(list(out["index"]), list(range(4, 11)))
+        np.testing.assert_allclose(out["values"][:, 0], out["index"] * 0.5)
+        self.assertEqual(ring.available, 0)
+
+    def test_full_buffer_drops_new_records_and_counts_overruns(self):
+        ring = SpscRingBuffer(4, RECORD)
+        self.assertEqual(ring.write(records(0, 6)), 4)
+        self.assertEqual(ring.overruns, 2)
+        self.assertEqual(list(ring.read()["index"]), [0, 1, 2, 3])
+
+    def test_empty_read_returns_empty_array(self):
+        ring = SpscRingBuffer(4, RECORD)
+        out = ring.read()
+        self.assertEqual(len(out), 0)
+        self.assertEqual(out.dtype, RECORD)
+
+    def test_concurrent_producer_consumer_keeps_order(self):
+        ring = SpscRingBuffer(64, RECORD)
+        total = 5000
+        received = []
+
+        def produce():
+            i = 0
+            while i < total:
+                i += ring.write(records(i, min(7, total - i)))
+
+        producer = threading.Thread(target=produce)
+        producer.start()
+        while len(received) < total:
+            received.extend(ring.read()["index"].tolist())
+        producer.join()
+
+        self.assertEqual(received, list(range(total)))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,87 @@
+"""
+Continuous Sample Buffer - Infrastructure Layer
+
+Responsibility:
+- Carry continuous acquisition samples from the acquisition thread to the
+  consumers (presenter, exporters, statistics) as fixed-layout records.
+
+Rationale:
+- Publishing one domain event per sample runs every subscriber on the
+  acquisition thread, so UI processing throttles the sampling rate.
+- Here the acquisition thread only copies 8 numbers into a preallocated ring;
+  consumers drain whole blocks on their own cadence.
+
+Design:
+- Record layout SAMPLE_RECORD_DTYPE: timestamp_ns (int64, wall clock),
+  monotonic_ns (int64, acquisition instant on the monotonic clock, used for
+  spacing/jitter), mcu_counter (int64, MCU sample counter, -1 if unknown),
+  index (int64), values (6 x float64 in VoltageMeasurement order:
+  X I/Q, Y I/Q, Z I/Q).
+- Thin specialisation of SpscRingBuffer (same non-blocking / overrun rules).
+"""
+
+import time
+from typing import Optional
+
+import numpy as np
+
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+from infrastructure.buffers.spsc_ring_buffer import SpscRingBuffer
+
+SAMPLE_RECORD_DTYPE = np.dtype([
+    ("timestamp_ns", np.int64),
+    ("monotonic_ns", np.int64),
+    ("mcu_counter", np.int64),
+    ("index", np.int64),
+    ("values", np.float64, (6,)),
+])
+
+DEFAULT_SAMPLE_CAPACITY = 1 << 16
+
+NO_MCU_COUNTER = -1
+
+
+class ContinuousSampleBuffer(SpscRingBuffer):
+    """
+    SPSC ring of continuous acquisition sample records.
+
+    Args:
+        capacity: Maximum number of buffered samples.
+    """
+
+    def __init__(self, capacity: int = DEFAULT_SAMPLE_CAPACITY) -> None:
+        super().__init__(capacity, SAMPLE_RECORD_DTYPE)
+        # Scratch record reused by push(), owned by the producer thread
+        self._scratch = np.zeros(1, dtype=SAMPLE_RECORD_DTYPE)
+
+    def push(
+        self,
+        index: int,
+        sample: VoltageMeasurement,
+        monotonic_ns: Optional[int] = None,
+        mcu_counter: int = NO_MCU_COUNTER,
+    ) -> bool:
+        """
+        Append one sample without blocking (producer side).
+
+        Args:
+            monotonic_ns: Acquisition instant (time.monotonic_ns()); now if None.
+            mcu_counter: MCU sample counter of the sample, when the stream provides it.
+
+        Returns:
+            False if the buffer was full and the sample was dropped.
+        """
+        record = self._scratch[0]
+        record["timestamp_ns"] = int(sample.timestamp.timestamp() * 1e9)
+        record["monotonic_ns"] = time.monotonic_ns() if monotonic_ns is None else monotonic_ns
+        record["mcu_counter"] = mcu_counter
+        record["index"] = index
+        record["values"] = (
+            sample.voltage_x_in_phase,
+            sample.voltage_x_quadrature,
+            sample.voltage_y_in_phase,
+            sample.voltage_y_quadrature,
+            sample.voltage_z_in_phase,
+            sample.voltage_z_quadrature,
+        )
+        return self.write(self._scratch) == 1
@@ -0,0 +1,133 @@
+"""
+SPSC Ring Buffer - Infrastructure Layer
+
+Responsibility:
+- Hand fixed-layout records from one producer thread (hardware reader) to
+  one consumer thread, in numpy blocks.
+- Never block the producer: when full, new records are dropped and counted.
+
+Rationale:
+- The acquisition side must not be throttled by consumers (UI, exporters).
+- Block copies (numpy slices) instead of one Python object per sample.
+
+Design:
+- Preallocated numpy structured array of `capacity` records.
+- Monotonic write/read counters; only the producer writes `_write_count`,
+  only the consumer writes `_read_count`. Records are stored before the
+  counter is published, so no lock is needed with one producer and one
+  consumer (integer attribute assignment is atomic in CPython).
+"""
+
+from typing import Optional
+
+import numpy as np
+
+
+class SpscRingBuffer:
+    """
+    Single-producer / single-consumer ring buffer of numpy records.
+
+    Args:
+        capacity: Maximum number of buffered records.
+        dtype: Record layout (numpy dtype, usually structured).
+    """
+
+    def __init__(self, capacity: int, dtype) -> None:
+        if capacity <= 0:
+            raise ValueError(f"capacity must be > 0, got {capacity}")
+        self._capacity = int(capacity)
+        self._data = np.zeros(self._capacity, dtype=dtype)
+        self._write_count = 0
+        self._read_count = 0
+        self._overruns = 0
+
+    # ==========================================================================
+    # PRODUCER
+    # ==========================================================================
+
+    def write(self, records: np.ndarray) -> int:
+        """
+        Append records without blocking.
+
+        Args:
+            records: 1-D array with the buffer dtype.
+
+        Returns:
+            Number of records actually stored (the rest is counted as overrun).
+        """
+        n = len(records)
+        free = self._capacity - (self._write_count - self._read_count)
+        if n > free:
+            self._overruns += n - free
+            records = records[:free]
+            n = free
+        if n == 0:
+            return 0
+
+        start = self._write_count % self._capacity
+        first = min(n, self._capacity - start)
+        self._data[start:start + first] = records[:first]
+        if first < n:
+            self._data[:n - first] = records[first:]
+
+        # Publish after the copy
+        self._write_count += n
+        return n
+
+    # ==========================================================================
+    # CONSUMER
+    # ==========================================================================
+
+    def read(self, max_records: Optional[int] = None) -> np.ndarray:
+        """
+        Remove and return up to max_records records (all available if None).
+
+        Returns:
+            A copy (1-D array, possibly empty), oldest first.
+        """
+        n = self._write_count - self._read_count
+        if max_records is not None:
+            n = min(n, max_records)
+        if n <= 0:
+            return self._data[:0].copy()
+
+        start = self._read_count % self._capacity
+        first = min(n, self._capacity - start)
+        if first == n:
+            out = self._data[start:start + n].copy()
+        else:
+            out = np.concatenate((self._data[start:], self._data[:n - first]))
+
+        # Release the slots after the copy
+        self._read_count += n
+        return out
+
+    def clear(self) -> None:
+        """Drop all buffered records (consumer side)."""
+        self._read_count = self._write_count
+
+    # ==========================================================================
+    # QUERIES
+    # ==========================================================================
+
+    @property
+    def capacity(self) -> int:
+        return self._capacity
+
+    @property
+    def dtype(self) -> np.dtype:
+        return self._data.dtype
+
+    @property
+    def available(self) -> int:
+        """Records ready to be read."""
+        return self._write_count - self._read_count
+
+    @property
+    def overruns(self) -> int:
+        """Records dropped because the buffer was full."""
+        return self._overruns
+
+    @property
+    def total_written(self) -> int:
+        return self._write_count
@@ -0,0 +1,215 @@
+import threading
+import time
+import unittest
+
+from domain.events.event_topics import EVENT_TOPICS, UnknownEventTopicError
+from infrastructure.events.async_event_bus import (
+    AsyncEventBus,
+    BackpressurePolicy,
+    SubscriptionOptions,
+)
+
+
+class TestAsyncEventBus(unittest.TestCase):
+
+    def setUp(self):
+        self.bus = AsyncEventBus()
+
+    def tearDown(self):
+        self.bus.shutdown()
+
+    def test_delivers_off_publisher_thread(self):
+        threads = []
+        self.bus.subscribe("sample", lambda data: threads.append(threading.current_thread()))
+        self.bus.publish("sample", 1)
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(len(threads), 1)
+        self.assertIsNot(threads[0], threading.current_thread())
+
+    def test_same_handler_keeps_order_across_topics(self):
+        received = []
+        handler = lambda data: received.append(data)
+        self.bus.subscribe("scanpointacquired", handler)
+        self.bus.subscribe("scancompleted", handler)
+        for i in range(50):
+            self.bus.publish("scanpointacquired", i)
+        self.bus.publish("scancompleted", "done")
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, list(range(50)) + ["done"])
+
+    def test_batch_delivery(self):
+        gate = threading.Event()
+        batches = []
+
+        def handler(batch):
+            gate.wait(timeout=2.0)
+            batches.append(list(batch))
+
+        self.bus.subscribe("sample", handler, SubscriptionOptions(batch=True, max_batch=10))
+        for i in range(25):
+            self.bus.publish("sample", i)
+        gate.set()
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual([x for b in batches for x in b], list(range(25)))
+        self.assertTrue(all(len(b) <= 10 for b in batches))
+        self.assertLess(len(batches), 25)
+
+    def test_drop_oldest_counts_drops(self):
+        gate = threading.Event()
+        received = []
+
+        def handler(data):
+            gate.wait(timeout=2.0)
+            received.append(data)
+
+        self.bus.subscribe("sample", handler,
+                           SubscriptionOptions(capacity=5, policy=BackpressurePolicy.DROP_OLDEST))
+        self.bus.publish("sample", -1)
+        time.sleep(0.05)  # -1 taken by the dispatcher, which now waits on the gate
+        for i in range(20):
+            self.bus.publish("sample", i)
+        stats = self.bus.get_stats()["sample"]
+        self.assertEqual(stats.queue_depth, 5)
+        gate.set()
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, [-1, 15, 16, 17, 18, 19])
+        stats = self.bus.get_stats()["sample"]
+        self.assertEqual(stats.published, 21)
+        self.assertEqual(stats.delivered, 6)
+        self.assertEqual(stats.dropped, 15)
+        self.assertGreater(stats.max_latency_s, 0.0)
+
+    def test_block_loses_nothing(self):
+        received = []
+
+        def handler(data):
+            time.sleep(0.001)
+            received.append(data)
+
+        self.bus.subscribe("sample", handler,
+                           SubscriptionOptions(capacity=2, policy=BackpressurePolicy.BLOCK))
+        for i in range(30):
+            self.bus.publish("sample", i)
+        self.assertTrue(self.bus.flush(timeout=5.0))
+        self.assertEqual(received, list(range(30)))
+        self.assertEqual(self.bus.get_stats()["sample"].dropped, 0)
+
+    def test_coalesce_keeps_latest_per_topic(self):
+        gate = threading.Event()
+        received = []
+
+        def handler(data):
+            gate.wait(timeout=2.0)
+            received.append(data)
+
+        options = SubscriptionOptions(policy=BackpressurePolicy.COALESCE)
+        self.bus.subscribe("position", handler, options)
+        self.bus.subscribe("status", handler)
+        self.bus.publish("position", "p0")
+        time.sleep(0.05)
+        for i in range(1, 6):
+            self.bus.publish("position", f"p{i}")
+            self.bus.publish("status", f"s{i}")
+        gate.set()
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, ["p0", "p5", "s5"])
+
+    def test_handler_error_isolation(self):
+        received = []
+
+        def failing(data):
+            raise RuntimeError("boom")
+
+        self.bus.subscribe("sample", failing)
+        self.bus.subscribe("sample", lambda data: received.append(data))
+        self.bus.publish("sample", 1)
+        self.bus.publish("sample", 2)
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, [1, 2])
+
+    def test_unsubscribe_and_clear(self):
+        received = []
+        handler = lambda data: received.append(data)
+        self.bus.subscribe("a", handler)
+        self.bus.subscribe("b", handler)
+        self.bus.unsubscribe("a", handler)
+        self.bus.publish("a", 1)
+        self.bus.publish("b", 2)
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, [2])
+
+        self.bus.clear_subscribers()
+        self.bus.publish("b", 3)
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, [2])
+
+    def test_default_is_lossless_and_owner_options_opt_into_dropping(self):
+        class SlowSubscriber:
+            def __init__(self):
+                self.gate, self.received = threading.Event(), []
+
+            def on_sample(self, data):
+                self.gate.wait(timeout=2.0)
+                self.received.append(data)
+
+        class Export(SlowSubscriber):
+            pass
+
+        class Display(SlowSubscriber):
+            pass
+
+        bus = AsyncEventBus(
+            default_options=SubscriptionOptions(capacity=2),
+            owner_options={Display: SubscriptionOptions(capacity=2, policy=BackpressurePolicy.DROP_OLDEST)},
+        )
+        export, display = Export(), Display()
+        try:
+            bus.subscribe("sample", export.on_sample)
+            bus.subscribe("sample", display.on_sample)
+            publisher = threading.Thread(target=lambda: [bus.publish("sample", i) for i in range(10)])
+            publisher.start()
+            time.sleep(0.1)
+            self.assertTrue(publisher.is_alive())  # Blocked by the full export queue
+            export.gate.set()
+            publisher.join(timeout=2.0)
+            self.assertFalse(publisher.is_alive())  # Never blocked by the display queue
+            display.gate.set()
+            self.assertTrue(bus.flush(timeout=2.0))
+            self.assertEqual(export.received, list(range(10)))
+            self.assertLess(len(display.received), 10)
+            self.assertEqual(display.received[-2:], [8, 9])
+        finally:
+            bus.shutdown()
+
+    def test_publish_does_not_take_the_bus_lock(self):
+        received = []
+        self.bus.subscribe("t", received.append)
+        with self.bus._lock:  # Held as by a concurrent subscribe
+            publisher = threading.Thread(target=self.bus.publish, args=("t", 1))
+            publisher.start()
+            publisher.join(timeout=1.0)
+            self.assertFalse(publisher.is_alive())
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, [1])
+
+        self.bus.unsubscribe("t", received.append)
+        self.bus.publish("t", 2)
+        self.assertTrue(self.bus.flush(timeout=2.0))
+        self.assertEqual(received, [1])
+
+    def test_no_subscribers(self):
+        self.bus.publish("nobody", 1)
+        self.assertEqual(self.bus.get_stats()["nobody"].published, 1)
+
+    def test_unknown_topic_rejected_with_registry(self):
+        bus = AsyncEventBus(topic_registry=EVENT_TOPICS)
+        try:
+            with self.assertRaises(UnknownEventTopicError):
+                bus.subscribe("MotionCompleted", lambda data: None)
+            bus.subscribe("motioncompleted", lambda data: None)
+        finally:
+            bus.shutdown()
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -2,6 +2,7 @@
 Tests for InMemoryEventBus (Diagram-Friendly)
 """
 
+from domain.events.event_topics import EVENT_TOPICS, SCAN_STARTED, UnknownEventTopicError
 from infrastructure.events.in_memory_event_bus import InMemoryEventBus
 from tool.diagram_friendly_test import DiagramFriendlyTest
 
@@ -167,6 +168,43 @@ class TestInMemoryEventBus(DiagramFriendlyTest):
         self.log_interaction("Test", "ASSERT", "InMemoryEventBus", "Verify calls", expect=expected, got=calls)
         self.assertEqual(calls, expected)
 
+    def test_unknown_topic_rejected_with_registry(self):
+        """Test that a registry-checked bus rejects unknown topics at subscribe time."""
+        bus = InMemoryEventBus(topic_registry=EVENT_TOPICS)
+        self.log_interaction("Test", "SUBSCRIBE", "InMemoryEventBus", "Subscribe wrong-case topic", {"event": "ScanStarted"})
+        with self.assertRaises(UnknownEventTopicError):
+            bus.subscribe('ScanStarted', lambda data: None)
+
+        calls = []
+        self.log_interaction("Test", "SUBSCRIBE", "InMemoryEventBus", "Subscribe known topic", {"event": SCAN_STARTED})
+        bus.subscribe(SCAN_STARTED, calls.append)
+        bus.publish(SCAN_STARTED, 'started')
+
+        expected = ['started']
+        self.log_interaction("Test", "ASSERT", "InMemoryEventBus", "Verify calls", expect=expected, got=calls)
+        self.assertEqual(calls, expected)
+
+    def test_unsubscribe_during_publish(self):
+        """Test that a handler unsubscribing itself does not skip the next handler."""
+        calls = []
+
+        def once(data):
+            calls.append(('once', data))
+            self.bus.unsubscribe('test_event', once)
+
+        def always(data):
+            calls.append(('always', data))
+
+        self.bus.subscribe('test_event', once)
+        self.bus.subscribe('test_event', always)
+        self.log_interaction("Test", "PUBLISH", "InMemoryEventBus", "Publish twice", {"event": "test_event"})
+        self.bus.publish('test_event', 1)
+        self.bus.publish('test_event', 2)
+
+        expected = [('once', 1), ('always', 1), ('always', 2)]
+        self.log_interaction("Test", "ASSERT", "InMemoryEventBus", "Verify calls", expect=expected, got=calls)
+        self.assertEqual(calls, expected)
+
     def test_digest_orchestration_flow(self):
         """Demonstration of orchestration flow."""
         # Setup is already done in setUp()
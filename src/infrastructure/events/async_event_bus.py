@@ -0,0 +1,337 @@
+"""
+Asynchronous Event Bus - Infrastructure Layer
+
+Responsibility:
+- Implement `IDomainEventBus` with delivery off the publisher's thread:
+  one bounded queue and one dispatcher thread per subscriber.
+- Per-subscriber backpressure policy and optional batch delivery.
+- Per-topic counters (published, delivered, dropped, queue depth, latency).
+
+Rationale:
+- With the synchronous bus, a high-rate publisher (acquisition thread) pays
+  for every subscriber's work (UI, export) before it can take the next sample.
+
+Design:
+- A subscriber is a handler: subscribing the same handler to several topics
+  reuses its queue, so one handler still sees its events in publish order
+  across topics (e.g. the last ScanPointAcquired before ScanCompleted).
+- Backpressure when the queue is full:
+    DROP_OLDEST: discard the oldest pending event (counted as dropped)
+    BLOCK:       the publisher waits for room (never from the dispatcher
+                 thread itself, to avoid a self-deadlock)
+    COALESCE:    at most one pending event per topic, the newest one
+- BLOCK is the default: like the synchronous bus, no event is lost unless
+  asked for (persistence must see every ScanPointAcquired). Subscribers
+  subscribe from their constructors through IDomainEventBus, so the
+  composition root chooses lossy policies per component with
+  `owner_options` (e.g. DROP_OLDEST for UI presenters).
+- Batch delivery: the handler receives a list of up to `max_batch` events.
+- publish() takes no lock: as in InMemoryEventBus, each topic maps to an
+  immutable tuple of subscribers, replaced (copy-on-write) under the lock by
+  subscribe / unsubscribe. The per-topic published counter is not locked
+  either (diagnostic: concurrent publishers of one topic may miss a count).
+- Handler errors are logged and isolated, as in InMemoryEventBus.
+- With a `topic_registry`, unknown topics are rejected at subscribe time.
+- Each handler call is an "event/<topic>" tracer span on its dispatcher thread.
+"""
+
+import logging
+import threading
+import time
+from collections import defaultdict, deque
+from dataclasses import dataclass
+from enum import Enum
+from typing import Any, Callable, Deque, Dict, Mapping, Optional, Tuple
+
+from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.events.event_topics import EventTopicRegistry
+from infrastructure.instrumentation.hot_path_tracer import TRACER
+
+logger = logging.getLogger(__name__)
+
+
+class BackpressurePolicy(Enum):
+    """Behaviour of publish() when a subscriber queue is full."""
+    DROP_OLDEST = "drop_oldest"
+    BLOCK = "block"
+    COALESCE = "coalesce"
+
+
+@dataclass(frozen=True)
+class SubscriptionOptions:
+    """
+    - capacity: maximum pending events (ignored by COALESCE).
+    - policy: see BackpressurePolicy.
+    - batch: deliver lists of events instead of single events.
+    - max_batch: maximum events per batch.
+    """
+    capacity: int = 1024
+    policy: BackpressurePolicy = BackpressurePolicy.BLOCK
+    batch: bool = False
+    max_batch: int = 256
+
+    def __post_init__(self):
+        if self.capacity <= 0 or self.max_batch <= 0:
+            raise ValueError("capacity and max_batch must be > 0")
+
+
+@dataclass
+class TopicStats:
+    """Counters of one topic (summed over its subscribers for delivery counters)."""
+    published: int = 0
+    delivered: int = 0
+    dropped: int = 0
+    queue_depth: int = 0
+    max_latency_s: float = 0.0
+    total_latency_s: float = 0.0
+
+    @property
+    def mean_latency_s(self) -> float:
+        """Mean publish -> handler start delay."""
+        return self.total_latency_s / self.delivered if self.delivered else 0.0
+
+
+class _Subscriber:
+    """Queue + dispatcher thread of one handler."""
+
+    def __init__(self, handler: Callable[[Any], None], options: SubscriptionOptions, name: str):
+        self.handler = handler
+        self.options = options
+        self.topics: set = set()
+        self.stats: Dict[str, TopicStats] = defaultdict(TopicStats)
+        self._queue: Deque[Tuple[str, Any, float]] = deque()  # (topic, data, publish time)
+        self._cond = threading.Condition()
+        self._running = True
+        self._busy = False
+        self._thread = threading.Thread(target=self._run, name=name, daemon=True)
+        self._thread.start()
+
+    # Publisher side ---------------------------------------------------- #
+
+    def offer(self, topic: str, data: Any) -> None:
+        item = (topic, data, time.monotonic())
+        policy = self.options.policy
+        with self._cond:
+            if not self._running:
+                return
+            queue = self._queue
+            if policy is BackpressurePolicy.COALESCE:
+                for i, pending in enumerate(queue):
+                    if pending[0] == topic:
+                        del queue[i]
+                        self.stats[topic].dropped += 1
+                        break
+            elif len(queue) >= self.options.capacity:
+                if policy is BackpressurePolicy.DROP_OLDEST:
+                    self.stats[queue.popleft()[0]].dropped += 1
+                elif threading.current_thread() is not self._thread:
+                    while self._running and len(queue) >= self.options.capacity:
+                        self._cond.wait()
+                    if not self._running:
+                        return
+            queue.append(item)
+            self._cond.notify_all()
+
+    def depth(self, topic: str) -> int:
+        with self._cond:
+            return sum(1 for pending in self._queue if pending[0] == topic)
+
+    def wait_idle(self, timeout: Optional[float]) -> bool:
+        with self._cond:
+            return self._cond.wait_for(lambda: not self._queue and not self._busy, timeout)
+
+    def stop(self) -> None:
+        with self._cond:
+            self._running = False
+            self._queue.clear()
+            self._cond.notify_all()
+        if threading.current_thread() is not self._thread:
+            self._thread.join(timeout=1.0)
+
+    # Dispatcher side --------------------------------------------------- #
+
+    def _run(self) -> None:
+        batch = self.options.batch
+        n_max = self.options.max_batch if batch else 1
+        while True:
+            with self._cond:
+                while self._running and not self._queue:
+                    self._cond.wait()
+                if not self._running:
+                    return
+                items = [self._queue.popleft() for _ in range(min(n_max, len(self._queue)))]
+                self._busy = True
+                # Room for blocked publishers
+                self._cond.notify_all()
+
+            start = time.monotonic()
+            t0 = TRACER.start()
+            try:
+                if batch:
+                    self.handler([data for _, data, _ in items])
+                else:
+                    self.handler(items[0][1])
+            except Exception as e:
+                logger.error(f"[AsyncEventBus] Error in handler for '{items[0][0]}': {e}", exc_info=True)
+                print(f"[AsyncEventBus] Error in handler for '{items[0][0]}': {e}")
+            TRACER.end("event", items[0][0], t0)
+
+            with self._cond:
+                for topic, _, published_at in items:
+                    stats = self.stats[topic]
+                    latency = start - published_at
+                    stats.delivered += 1
+                    stats.total_latency_s += latency
+                    if latency > stats.max_latency_s:
+                        stats.max_latency_s = latency
+                self._busy = False
+                self._cond.notify_all()
+
+
+class AsyncEventBus(IDomainEventBus):
+    """
+    Event bus dispatching on per-subscriber threads.
+
+    Args:
+        default_options: Options of subscribers registered without explicit options.
+        topic_registry: If given, subscribe/unsubscribe only accept its topics.
+        owner_options: Options by component type, for handlers that are methods
+            of an instance of that type (first match, before default_options).
+    """
+
+    def __init__(
+        self,
+        default_options: Optional[SubscriptionOptions] = None,
+        topic_registry: Optional[EventTopicRegistry] = None,
+        owner_options: Optional[Mapping[type, SubscriptionOptions]] = None,
+    ):
+        self._default_options = default_options or SubscriptionOptions()
+        self._topic_registry = topic_registry
+        self._owner_options = dict(owner_options or {})
+        self._lock = threading.Lock()
+        self._subscribers: Dict[Callable[[Any], None], _Subscriber] = {}
+        self._topics: Dict[str, Tuple[_Subscriber, ...]] = {}  # Copy-on-write, read lock-free
+        self._published: Dict[str, int] = {}
+
+    def _resolve(self, event_type: str) -> str:
+        if self._topic_registry is None:
+            return event_type
+        return self._topic_registry.resolve(event_type)
+
+    def _options_for(self, handler: Callable[[Any], None]) -> SubscriptionOptions:
+        owner = getattr(handler, "__self__", None)
+        if owner is not None:
+            for owner_type, options in self._owner_options.items():
+                if isinstance(owner, owner_type):
+                    return options
+        return self._default_options
+
+    def subscribe(
+        self,
+        event_type: str,
+        handler: Callable[[Any], None],
+        options: Optional[SubscriptionOptions] = None,
+    ) -> None:
+        """
+        Subscribe a handler. Options apply when the handler is first seen;
+        later subscriptions of the same handler share its queue. Without
+        explicit options: owner_options of the handler's component, else
+        default_options.
+        """
+        event_type = self._resolve(event_type)
+        with self._lock:
+            subscriber = self._subscribers.get(handler)
+            if subscriber is None:
+                subscriber = _Subscriber(
+                    handler,
+                    options or self._options_for(handler),
+                    name=f"EventBus-{event_type}",
+                )
+                self._subscribers[handler] = subscriber
+            if event_type not in subscriber.topics:
+                subscriber.topics.add(event_type)
+                self._topics[event_type] = self._topics.get(event_type, ()) + (subscriber,)
+        logger.debug("[AsyncEventBus] Subscribing to '%s'", event_type)
+
+    def publish(self, event_type: str, data: Any) -> None:
+        """Enqueue the event for every subscriber of the topic (returns immediately unless BLOCK)."""
+        subscribers = self._topics.get(event_type, ())
+        self._published[event_type] = self._published.get(event_type, 0) + 1
+        if logger.isEnabledFor(logging.DEBUG):
+            logger.debug("[AsyncEventBus] Publishing '%s' to %d subscriber(s)", event_type, len(subscribers))
+        for subscriber in subscribers:
+            subscriber.offer(event_type, data)
+
+    def unsubscribe(self, event_type: str, handler: Callable[[Any], None]) -> None:
+        event_type = self._resolve(event_type)
+        with self._lock:
+            subscriber = self._subscribers.get(handler)
+            if subscriber is None or event_type not in subscriber.topics:
+                logger.warning(f"[AsyncEventBus] Handler not found for '{event_type}'")
+                return
+            subscriber.topics.discard(event_type)
+            remaining = tuple(s for s in self._topics.get(event_type, ()) if s is not subscriber)
+            if remaining:
+                self._topics[event_type] = remaining
+            else:
+                self._topics.pop(event_type, None)
+            orphan = not subscriber.topics
+            if orphan:
+                del self._subscribers[handler]
+        if orphan:
+            subscriber.stop()
+        logger.debug("[AsyncEventBus] Unsubscribed from '%s'", event_type)
+
+    def clear_subscribers(self, event_type: str = None) -> None:
+        with self._lock:
+            if event_type:
+                affected = self._topics.pop(event_type, ())
+                for subscriber in affected:
+                    subscriber.topics.discard(event_type)
+            else:
+                affected = list(self._subscribers.values())
+                self._topics = {}
+                for subscriber in affected:
+                    subscriber.topics.clear()
+            orphans = [s for s in affected if not s.topics]
+            for subscriber in orphans:
+                self._subscribers.pop(subscriber.handler, None)
+        for subscriber in orphans:
+            subscriber.stop()
+        logger.debug("[AsyncEventBus] Cleared subscribers for '%s'", event_type or "*")
+
+    # ------------------------------------------------------------------ #
+    # Diagnostics / lifecycle
+    # ------------------------------------------------------------------ #
+
+    def flush(self, timeout: Optional[float] = None) -> bool:
+        """Wait until every queue is empty and no handler is running."""
+        deadline = None if timeout is None else time.monotonic() + timeout
+        with self._lock:
+            subscribers = list(self._subscribers.values())
+        for subscriber in subscribers:
+            remaining = None if deadline is None else max(0.0, deadline - time.monotonic())
+            if not subscriber.wait_idle(remaining):
+                return False
+        return True
+
+    def get_stats(self) -> Dict[str, TopicStats]:
+        """Per-topic counters (snapshot)."""
+        with self._lock:
+            published = dict(self._published)
+            subscribers = list(self._subscribers.values())
+        result = {topic: TopicStats(published=count) for topic, count in published.items()}
+        for subscriber in subscribers:
+            for topic, stats in list(subscriber.stats.items()):
+                total = result.setdefault(topic, TopicStats())
+                total.delivered += stats.delivered
+                total.dropped += stats.dropped
+                total.total_latency_s += stats.total_latency_s
+                total.max_latency_s = max(total.max_latency_s, stats.max_latency_s)
+            for topic in list(subscriber.topics):
+                result.setdefault(topic, TopicStats()).queue_depth += subscriber.depth(topic)
+        return result
+
+    def shutdown(self) -> None:
+        """Stop every dispatcher thread (pending events are discarded)."""
+        self.clear_subscribers()
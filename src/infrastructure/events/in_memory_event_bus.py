@@ -1,48 +1,75 @@
-from typing import Callable, Dict, List, Any
-from collections import defaultdict
+from typing import Callable, Dict, Optional, Tuple, Any
 import logging
+import threading
 from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.events.event_topics import EventTopicRegistry
+from infrastructure.instrumentation.hot_path_tracer import TRACER
 
 logger = logging.getLogger(__name__)
 
 class InMemoryEventBus(IDomainEventBus):
     """
     In-memory implementation of the Domain Event Bus.
+
+    - Subscriber lists are copy-on-write tuples: subscribe/unsubscribe build a
+      new tuple under a lock, publish reads the current one without locking.
+    - With a `topic_registry`, subscribing to an unknown topic raises
+      `UnknownEventTopicError` at subscribe time (typo / wrong case).
+    - Each publish (all handlers) is an "event/<topic>" tracer span.
     """
-    
-    def __init__(self):
-        self._subscribers: Dict[str, List[Callable[[Any], None]]] = defaultdict(list)
-    
+
+    def __init__(self, topic_registry: Optional[EventTopicRegistry] = None):
+        self._subscribers: Dict[str, Tuple[Callable[[Any], None], ...]] = {}
+        self._topic_registry = topic_registry
+        self._lock = threading.Lock()
+
+    def _resolve(self, event_type: str) -> str:
+        if self._topic_registry is None:
+            return event_type
+        return self._topic_registry.resolve(event_type)
+
     def subscribe(self, event_type: str, handler: Callable[[Any], None]) -> None:
-        logger.debug(f"[InMemoryEventBus] Subscribing to '{event_type}'")
-        self._subscribers[event_type].append(handler)
-    
+        event_type = self._resolve(event_type)
+        logger.debug("[InMemoryEventBus] Subscribing to '%s'", event_type)
+        with self._lock:
+            self._subscribers[event_type] = self._subscribers.get(event_type, ()) + (handler,)
+
     def publish(self, event_type: str, data: Any) -> None:
-        logger.debug(f"[InMemoryEventBus] Publishing '{event_type}' with data: {data}")
-        
-        handlers = self._subscribers.get(event_type, [])
-        if not handlers:
-            logger.warning(f"[InMemoryEventBus] No subscribers for event '{event_type}'")
-        
+        handlers = self._subscribers.get(event_type, ())
+        # Hot path: no f-string formatting of `data` unless debug logging is on
+        if logger.isEnabledFor(logging.DEBUG):
+            logger.debug("[InMemoryEventBus] Publishing '%s' to %d handler(s) with data: %s",
+                         event_type, len(handlers), data)
+
+        t0 = TRACER.start()
         for handler in handlers:
             try:
                 handler(data)
             except Exception as e:
                 logger.error(f"[InMemoryEventBus] Error in handler for '{event_type}': {e}", exc_info=True)
                 print(f"[InMemoryEventBus] Error in handler for '{event_type}': {e}")
-    
+        TRACER.end("event", event_type, t0)
+
     def unsubscribe(self, event_type: str, handler: Callable[[Any], None]) -> None:
-        if event_type in self._subscribers:
-            try:
-                self._subscribers[event_type].remove(handler)
-                logger.debug(f"[InMemoryEventBus] Unsubscribed from '{event_type}'")
-            except ValueError:
+        event_type = self._resolve(event_type)
+        with self._lock:
+            handlers = self._subscribers.get(event_type, ())
+            if handler not in handlers:
                 logger.warning(f"[InMemoryEventBus] Handler not found for '{event_type}'")
-    
+                return
+            index = handlers.index(handler)
+            remaining = handlers[:index] + handlers[index + 1:]
+            if remaining:
+                self._subscribers[event_type] = remaining
+            else:
+                del self._subscribers[event_type]
+        logger.debug("[InMemoryEventBus] Unsubscribed from '%s'", event_type)
+
     def clear_subscribers(self, event_type: str = None) -> None:
-        if event_type:
-            self._subscribers[event_type].clear()
-            logger.debug(f"[InMemoryEventBus] Cleared subscribers for '{event_type}'")
-        else:
-            self._subscribers.clear()
-            logger.debug("[InMemoryEventBus] Cleared all subscribers")
+        with self._lock:
+            if event_type:
+                self._subscribers.pop(event_type, None)
+                logger.debug("[InMemoryEventBus] Cleared subscribers for '%s'", event_type)
+            else:
+                self._subscribers = {}
+                logger.debug("[InMemoryEventBus] Cleared all subscribers")
@@ -0,0 +1,95 @@
+import threading
+import unittest
+
+from infrastructure.execution.deadline_scheduler import DeadlineScheduler
+
+
+class FakeClock:
+    """Monotonic clock advanced by the test; Event.wait is replaced by a jump."""
+
+    def __init__(self):
+        self.now_ns = 0
+
+    def __call__(self):
+        return self.now_ns
+
+
+class JumpingFlag(threading.Event):
+    """Stop flag whose wait() advances the fake clock instead of sleeping."""
+
+    def __init__(self, clock, overshoot_ns=0):
+        super().__init__()
+        self._clock = clock
+        self._overshoot_ns = overshoot_ns
+
+    def wait(self, timeout=None):
+        self._clock.now_ns += int(round(timeout * 1e9)) + self._overshoot_ns
+        return self.is_set()
+
+
+class TestDeadlineScheduler(unittest.TestCase):
+    def test_deadlines_do_not_drift_with_work_time(self):
+        clock = FakeClock()
+        flag = JumpingFlag(clock)
+        scheduler = DeadlineScheduler(100.0, clock_ns=clock)
+        scheduler.start()
+
+        deadlines = []
+        for _ in range(5):
+            deadlines.append(scheduler.wait_next(flag))
+            clock.now_ns += 3_000_000  # 3 ms of acquisition work
+        self.assertEqual(deadlines, [0, 10_000_000, 20_000_000, 30_000_000, 40_000_000])
+        self.assertAlmostEqual(scheduler.stats().achieved_rate_hz, 100.0)
+
+    def test_long_stall_skips_missed_deadlines(self):
+        clock = FakeClock()
+        flag = JumpingFlag(clock)
+        scheduler = DeadlineScheduler(100.0, max_catch_up=1, clock_ns=clock)
+        scheduler.start()
+
+        scheduler.wait_next(flag)
+        clock.now_ns += 45_000_000  # stall over 4 periods
+        deadline = scheduler.wait_next(flag)
+
+        self.assertEqual(deadline, 40_000_000)
+        self.assertEqual(scheduler.stats().skipped_ticks, 3)
+
+    def test_short_delay_is_caught_up(self):
+        clock = FakeClock()
+        flag = JumpingFlag(clock)
+        scheduler = DeadlineScheduler(100.0, max_catch_up=1, clock_ns=clock)
+        scheduler.start()
+
+        scheduler.wait_next(flag)
+        clock.now_ns += 15_000_000  # 1.5 periods late
+        self.assertEqual(scheduler.wait_next(flag), 10_000_000)
+        self.assertEqual(scheduler.wait_next(flag), 20_000_000)
+        self.assertEqual(scheduler.stats().skipped_ticks, 0)
+
+    def test_jitter_statistics(self):
+        clock = FakeClock()
+        flag = JumpingFlag(clock, overshoot_ns=50_000)
+        scheduler = DeadlineScheduler(1000.0, clock_ns=clock)
+        scheduler.start()
+
+        for _ in range(4):
+            scheduler.wait_next(flag)
+        stats = scheduler.stats()
+        # First tick is on time (no wait), the next ones wake 50 us late
+        self.assertEqual(stats.ticks, 4)
+        self.assertAlmostEqual(stats.jitter_max_us, 50.0)
+        self.assertAlmostEqual(stats.jitter_mean_us, 37.5)
+
+    def test_stop_flag_interrupts_wait(self):
+        clock = FakeClock()
+        flag = JumpingFlag(clock)
+        scheduler = DeadlineScheduler(10.0, clock_ns=clock)
+        scheduler.start()
+        scheduler.wait_next(flag)
+
+        flag.set()
+        self.assertIsNone(scheduler.wait_next(flag))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,276 @@
+import threading
+import time
+import unittest
+from uuid import uuid4
+
+from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+from infrastructure.execution.fly_scan_executor import FlyScanExecutor
+from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import AxisParams
+from infrastructure.mocks.adapter_mock_i_acquisition_port import MockAcquisitionPort
+from domain.aggregates.step_scan import StepScan
+from domain.events.motion_events import MotionCompleted
+from domain.value_objects.geometric.position_2d import Position2D
+from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+from domain.value_objects.scan.scan_pattern import ScanPattern
+from domain.value_objects.scan.scan_status import ScanStatus
+from domain.value_objects.scan.scan_trajectory import ScanTrajectory
+from domain.value_objects.scan.scan_zone import ScanZone
+from domain.value_objects.scan.step_scan_config import StepScanConfig
+
+
+class LinearMotionPort:
+    """Moves in a straight line at the last set speed; position interpolated in time."""
+
+    def __init__(self, event_bus):
+        self._event_bus = event_bus
+        self._lock = threading.Lock()
+        self._start = Position2D(0, 0)
+        self._target = Position2D(0, 0)
+        self._t0 = 0.0
+        self._duration = 0.0
+        self.speed = 100.0
+        self.speed_history = []
+        self.stops = 0
+
+    def move_to(self, position):
+        return self.move_to_within(position, None)
+
+    def move_to_within(self, position, timeout_s):
+        motion_id = str(uuid4())
+        with self._lock:
+            self._start = self._position_at(time.monotonic())
+            self._target = position
+            self._t0 = time.monotonic()
+            distance = max(abs(position.x - self._start.x), abs(position.y - self._start.y))
+            self._duration = distance / self.speed
+        ends_in = self._duration if timeout_s is None else min(self._duration, timeout_s)
+        threading.Timer(ends_in, self._event_bus.publish, args=(
+            "motioncompleted", MotionCompleted(motion_id=motion_id, final_position=position, duration_ms=0.0)
+        )).start()
+        return motion_id
+
+    def _position_at(self, t):
+        if self._duration <= 0:
+            return self._target
+        ratio = min(max((t - self._t0) / self._duration, 0.0), 1.0)
+        return Position2D(
+            self._start.x + (self._target.x - self._start.x) * ratio,
+            self._start.y + (self._target.y - self._start.y) * ratio,
+        )
+
+    def get_current_position(self):
+        with self._lock:
+            return self._position_at(time.monotonic())
+
+    def set_speed(self, speed):
+        self.speed = speed
+        self.speed_history.append(speed)
+
+    def stop(self):
+        self.stops += 1
+
+    def get_axis_limits(self):
+        return (1000.0, 1000.0)
+
+
+class TimeoutMotionPort(LinearMotionPort):
+    """Like the Arcus adapter: MotionCompleted is published when the move timeout expires."""
+
+    MIN_SPEED_HZ = 10
+    MOTION_TIMEOUT_S = 0.3
+
+    def move_to(self, position):
+        return self.move_to_within(position, self.MOTION_TIMEOUT_S)
+
+
+class TestFlyScanPlanning(unittest.TestCase):
+    PARAMS = AxisParams(ls=10, hs=1000, acc=100, dec=200)
+
+    def test_rows_follow_serpentine_order(self):
+        points = [Position2D(0, 0), Position2D(10, 0), Position2D(10, 5), Position2D(0, 5)]
+        rows = FlyScanExecutor.plan_rows(points, self.PARAMS, mm_per_step=0.01,
+                                         point_time_s=0.0, x_limits=(-100.0, 100.0))
+
+        self.assertEqual(len(rows), 2)
+        self.assertEqual([i for i, _ in rows[0].points], [0, 1])
+        self.assertEqual([i for i, _ in rows[1].points], [2, 3])
+        self.assertEqual((rows[0].direction, rows[1].direction), (1, -1))
+
+    def test_rows_index_the_trajectory_without_copying_it(self):
+        trajectory = ScanTrajectory([Position2D(0, 0), Position2D(10, 0), Position2D(10, 5)])
+        rows = FlyScanExecutor.plan_rows(trajectory, self.PARAMS, mm_per_step=0.01,
+                                         point_time_s=0.0, x_limits=(-100.0, 100.0))
+
+        self.assertEqual([row.indices for row in rows], [range(0, 2), range(2, 3)])
+        self.assertTrue(all(row.trajectory is trajectory for row in rows))
+        self.assertEqual(list(rows[0].points), [(0, Position2D(0, 0)), (1, Position2D(10, 0))])
+
+    def test_speed_and_ramps_from_axis_params(self):
+        points = [Position2D(x, 0) for x in (20.0, 30.0, 40.0)]
+        rows = FlyScanExecutor.plan_rows(points, self.PARAMS, mm_per_step=0.01,
+                                         point_time_s=0.0, x_limits=(0.0, 100.0))
+        row = rows[0]
+
+        # HS = 1000 Hz * 0.01 mm = 10 mm/s, LS = 0.1 mm/s
+        self.assertAlmostEqual(row.speed_mm_s, 10.0)
+        run_up = FlyScanExecutor.RAMP_MARGIN * 0.5 * (0.1 + 10.0) * 0.1
+        run_out = FlyScanExecutor.RAMP_MARGIN * 0.5 * (0.1 + 10.0) * 0.2
+        self.assertAlmostEqual(row.run_up.x, 20.0 - run_up)
+        self.assertAlmostEqual(row.run_out.x, 40.0 + run_out)
+
+    def test_speed_limited_by_acquisition_time(self):
+        points = [Position2D(x, 0) for x in (0.0, 1.0, 2.0)]
+        rows = FlyScanExecutor.plan_rows(points, self.PARAMS, mm_per_step=0.01,
+                                         point_time_s=0.25, x_limits=(0.0, 100.0))
+
+        self.assertAlmostEqual(rows[0].speed_mm_s, FlyScanExecutor.ACQUISITION_FILL_FACTOR * 1.0 / 0.25)
+        # Run-up clamped to travel limits
+        self.assertEqual(rows[0].run_up.x, 0.0)
+        self.assertAlmostEqual(rows[0].duration_s,
+                               (rows[0].run_out.x - rows[0].run_up.x) / rows[0].speed_mm_s + 0.3)
+
+    def test_speed_floor_and_rows_that_cannot_be_flown(self):
+        points = [Position2D(x, 0) for x in (0.0, 1.0, 2.0)]
+        # Floor 50 Hz * 0.01 mm = 0.5 mm/s, above 0.5 * 1 mm / 1.5 s
+        rows = FlyScanExecutor.plan_rows(points, self.PARAMS, mm_per_step=0.01, point_time_s=1.5,
+                                         x_limits=(0.0, 100.0), min_speed_hz=50)
+        self.assertAlmostEqual(rows[0].speed_mm_s, 0.5)
+
+        # 2.5 s per point at 0.5 mm/s: 1.25 mm travelled, more than the 1 mm pitch
+        with self.assertRaises(ValueError):
+            FlyScanExecutor.plan_rows(points, self.PARAMS, mm_per_step=0.01, point_time_s=2.5,
+                                      x_limits=(0.0, 100.0), min_speed_hz=50)
+        with self.assertRaises(ValueError):
+            FlyScanExecutor.plan_rows(points, AxisParams(ls=10, hs=40, acc=100, dec=100), mm_per_step=0.01,
+                                      point_time_s=0.0, x_limits=(0.0, 100.0), min_speed_hz=50)
+
+
+class TestFlyScanExecutor(unittest.TestCase):
+    POINTS = [Position2D(10, 0), Position2D(11, 0), Position2D(12, 0),
+              Position2D(12, 1), Position2D(11, 1), Position2D(10, 1)]
+
+    def _config(self):
+        return StepScanConfig(
+            scan_zone=ScanZone(x_min=10, x_max=12, y_min=0, y_max=1),
+            x_nb_points=3,
+            y_nb_points=2,
+            scan_pattern=ScanPattern.SERPENTINE,
+            stabilization_delay_ms=0,
+            averaging_per_position=2,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+        )
+
+    def _executor(self, event_bus, motion_port, acquisition_port):
+        return FlyScanExecutor(
+            motion_port, acquisition_port, event_bus,
+            axis_params_provider=lambda: AxisParams(ls=10, hs=2000, acc=10, dec=10),
+            mm_per_step=0.05,
+        )
+
+    def test_pause_mid_row_finishes_row_and_resumes(self):
+        event_bus = InMemoryEventBus()
+        motion_port = LinearMotionPort(event_bus)
+        acquisition_port = MockAcquisitionPort()
+        executor = self._executor(event_bus, motion_port, acquisition_port)
+        config = self._config()
+        scan = StepScan()
+        scan.start(config)
+
+        done = threading.Event()
+        event_bus.subscribe("scancompleted", lambda e: done.set())
+        event_bus.subscribe("scanfailed", lambda e: done.set())
+        paused = []
+
+        def pause_after_first_point(event):
+            if not paused:
+                paused.append(event.point_index)
+                executor.pause(scan)
+
+        event_bus.subscribe("scanpointacquired", pause_after_first_point)
+        executor.execute(scan, ScanTrajectory(self.POINTS), config)
+
+        # The first row is finished, its last points held, the second row not started
+        time.sleep(0.5)
+        self.assertEqual(scan.status, ScanStatus.PAUSED)
+        self.assertEqual(len(scan.points), 1)
+        self.assertEqual(acquisition_port.acquire_count, 1 + 3 * 2)
+        self.assertFalse(done.is_set())
+
+        executor.resume(scan)
+        self.assertTrue(done.wait(timeout=10.0))
+        self.assertEqual(scan.status, ScanStatus.COMPLETED)
+        self.assertEqual([p.point_index for p in scan.points], list(range(6)))
+
+    def test_row_longer_than_adapter_timeout_completes(self):
+        event_bus = InMemoryEventBus()
+        motion_port = TimeoutMotionPort(event_bus)
+        acquisition_port = MockAcquisitionPort()
+        # HS 40 Hz * 0.05 mm = 2 mm/s: each 2 mm row lasts about 1 s, above the 0.3 s move timeout
+        executor = FlyScanExecutor(
+            motion_port, acquisition_port, event_bus,
+            axis_params_provider=lambda: AxisParams(ls=10, hs=40, acc=10, dec=10),
+            mm_per_step=0.05,
+        )
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=0.5, x_max=2.5, y_min=0, y_max=0.2),
+            x_nb_points=3,
+            y_nb_points=2,
+            scan_pattern=ScanPattern.SERPENTINE,
+            stabilization_delay_ms=0,
+            averaging_per_position=1,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+        )
+        points = [Position2D(0.5, 0), Position2D(1.5, 0), Position2D(2.5, 0),
+                  Position2D(2.5, 0.2), Position2D(1.5, 0.2), Position2D(0.5, 0.2)]
+        scan = StepScan()
+        scan.start(config)
+
+        done = threading.Event()
+        event_bus.subscribe("scancompleted", lambda e: done.set())
+        event_bus.subscribe("scanfailed", lambda e: done.set())
+        executor.execute(scan, ScanTrajectory(points), config)
+
+        self.assertTrue(done.wait(timeout=10.0))
+        self.assertEqual(scan.status, ScanStatus.COMPLETED)
+        self.assertEqual([p.point_index for p in scan.points], list(range(6)))
+
+    def test_fly_scan_acquires_every_point_at_crossing(self):
+        event_bus = InMemoryEventBus()
+        motion_port = LinearMotionPort(event_bus)
+        acquisition_port = MockAcquisitionPort()
+        executor = self._executor(event_bus, motion_port, acquisition_port)
+
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=10, x_max=12, y_min=0, y_max=1),
+            x_nb_points=3,
+            y_nb_points=2,
+            scan_pattern=ScanPattern.SERPENTINE,
+            stabilization_delay_ms=0,
+            averaging_per_position=2,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+        )
+        points = [Position2D(10, 0), Position2D(11, 0), Position2D(12, 0),
+                  Position2D(12, 1), Position2D(11, 1), Position2D(10, 1)]
+        scan = StepScan()
+        scan.start(config)
+
+        done = threading.Event()
+        event_bus.subscribe("scancompleted", lambda e: done.set())
+        event_bus.subscribe("scanfailed", lambda e: done.set())
+
+        executor.execute(scan, ScanTrajectory(points), config)
+
+        self.assertTrue(done.wait(timeout=10.0))
+        self.assertEqual(scan.status, ScanStatus.COMPLETED)
+        self.assertEqual([p.point_index for p in scan.points], list(range(6)))
+        # 1 timing sample + 2 averages per point
+        self.assertEqual(acquisition_port.acquire_count, 1 + 6 * 2)
+        for result, nominal in zip(scan.points, points):
+            self.assertAlmostEqual(result.position.y, nominal.y)
+            self.assertLess(abs(result.position.x - nominal.x), 0.5)
+        # Positioning speed restored at the end
+        self.assertAlmostEqual(motion_port.speed_history[-1], 2000 * 0.05)
+
+
+if __name__ == "__main__":
+    unittest.main()
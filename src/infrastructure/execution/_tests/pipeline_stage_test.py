@@ -0,0 +1,100 @@
+import threading
+import time
+import unittest
+
+from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+from infrastructure.execution.pipeline_stage import PipelineStage
+from infrastructure.execution.step_scan_executor import StepScanExecutor
+from infrastructure.mocks.adapter_mock_i_acquisition_port import MockAcquisitionPort
+from infrastructure.mocks.adapter_mock_i_motion_port import MockMotionPort
+from domain.aggregates.step_scan import StepScan
+from domain.value_objects.geometric.position_2d import Position2D
+from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+from domain.value_objects.scan.scan_pattern import ScanPattern
+from domain.value_objects.scan.scan_status import ScanStatus
+from domain.value_objects.scan.scan_trajectory import ScanTrajectory
+from domain.value_objects.scan.scan_zone import ScanZone
+from domain.value_objects.scan.step_scan_config import StepScanConfig
+
+
+class TestPipelineStage(unittest.TestCase):
+    def test_jobs_run_in_order_off_the_caller_thread(self):
+        stage = PipelineStage()
+        done = []
+        caller = threading.get_ident()
+        for i in range(5):
+            stage.submit(lambda i=i: done.append((i, threading.get_ident() != caller)))
+        stage.drain()
+        stage.close()
+        self.assertEqual(done, [(i, True) for i in range(5)])
+
+    def test_job_error_is_raised_on_drain_and_later_jobs_skipped(self):
+        stage = PipelineStage()
+        done = []
+
+        def fail():
+            raise RuntimeError("export failed")
+
+        stage.submit(fail)
+        stage.submit(done.append, 1)
+        with self.assertRaises(RuntimeError):
+            stage.drain()
+        stage.close()
+        self.assertEqual(done, [])
+
+
+class TestStepScanExecutorPipelined(unittest.TestCase):
+    def _run_scan(self, pipelined, raw_capture=False, raw=None):
+        event_bus = InMemoryEventBus()
+        motion_port = MockMotionPort(event_bus=event_bus, motion_delay_ms=20.0)
+        acquisition_port = MockAcquisitionPort()
+        executor = StepScanExecutor(motion_port, acquisition_port, event_bus,
+                                    use_planned_trajectory=False, pipelined=pipelined,
+                                    raw_capture=raw_capture)
+        if raw is not None:
+            event_bus.subscribe("scanpointrawsamplesacquired", raw.append)
+
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=0, x_max=1, y_min=0, y_max=1),
+            x_nb_points=2,
+            y_nb_points=2,
+            scan_pattern=ScanPattern.SERPENTINE,
+            stabilization_delay_ms=0,
+            averaging_per_position=2,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+        )
+        points = [Position2D(0, 0), Position2D(1, 0), Position2D(1, 1), Position2D(0, 1)]
+        scan = StepScan()
+        scan.start(config)
+
+        acquired = []
+        # Slow exporter: 20 ms per point
+        event_bus.subscribe("scanpointacquired", lambda e: (time.sleep(0.02), acquired.append(e.point_index)))
+        done = threading.Event()
+        event_bus.subscribe("scancompleted", lambda e: done.set())
+
+        executor.execute(scan, ScanTrajectory(points), config)
+        self.assertTrue(done.wait(timeout=5.0))
+        return scan, acquired
+
+    def test_pipelined_scan_records_every_point_in_order(self):
+        scan, acquired = self._run_scan(pipelined=True)
+        self.assertEqual(scan.status, ScanStatus.COMPLETED)
+        self.assertEqual(acquired, [0, 1, 2, 3])
+        self.assertEqual([p.point_index for p in scan.points], [0, 1, 2, 3])
+
+    def test_raw_capture_publishes_every_sample_of_each_point(self):
+        raw = []
+        scan, _ = self._run_scan(pipelined=True, raw_capture=True, raw=raw)
+        self.assertEqual([e.point_index for e in raw], [0, 1, 2, 3])
+        self.assertTrue(all(len(e.samples) == 2 for e in raw))
+        self.assertEqual(raw[0].scan_id, scan.id)
+
+    def test_no_raw_events_by_default(self):
+        raw = []
+        self._run_scan(pipelined=False, raw=raw)
+        self.assertEqual(raw, [])
+
+
+if __name__ == "__main__":
+    unittest.main()
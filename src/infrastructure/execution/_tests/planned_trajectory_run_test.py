@@ -0,0 +1,106 @@
+import threading
+import time
+import unittest
+
+from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+from infrastructure.execution.planned_trajectory_run import ThreadedPlannedTrajectoryRun
+from infrastructure.execution.step_scan_executor import StepScanExecutor
+from infrastructure.mocks.adapter_mock_i_acquisition_port import MockAcquisitionPort
+from infrastructure.mocks.adapter_mock_i_motion_port import MockMotionPort
+from domain.aggregates.step_scan import StepScan
+from domain.value_objects.geometric.position_2d import Position2D
+from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+from domain.value_objects.scan.scan_pattern import ScanPattern
+from domain.value_objects.scan.scan_status import ScanStatus
+from domain.value_objects.scan.scan_trajectory import ScanTrajectory
+from domain.value_objects.scan.scan_zone import ScanZone
+from domain.value_objects.scan.step_scan_config import StepScanConfig
+
+
+class TestThreadedPlannedTrajectoryRun(unittest.TestCase):
+    def setUp(self):
+        self.points = [Position2D(float(i), 0.0) for i in range(3)]
+        self.moves = []
+
+        def move_and_wait(index, target):
+            self.moves.append(index)
+            return target
+
+        self.run = ThreadedPlannedTrajectoryRun(self.points, move_and_wait).start()
+
+    def tearDown(self):
+        self.run.abort()
+
+    def test_next_move_waits_for_release(self):
+        self.assertEqual(self.run.wait_for_arrival(timeout=1.0), (0, self.points[0]))
+        time.sleep(0.02)
+        self.assertEqual(self.moves, [0])
+
+        self.run.release()
+        self.assertEqual(self.run.wait_for_arrival(timeout=1.0), (1, self.points[1]))
+
+    def test_finished_after_last_point(self):
+        for expected in range(3):
+            index, _ = self.run.wait_for_arrival(timeout=1.0)
+            self.assertEqual(index, expected)
+            self.run.release()
+        self.assertIsNone(self.run.wait_for_arrival(timeout=1.0))
+        self.assertTrue(self.run.finished)
+        self.assertIsNone(self.run.error)
+
+    def test_abort_stops_pending_moves(self):
+        self.run.wait_for_arrival(timeout=1.0)
+        self.run.abort()
+        self.run.release()
+        time.sleep(0.02)
+        self.assertEqual(self.moves, [0])
+
+
+class TestStepScanExecutorPlannedTrajectory(unittest.TestCase):
+    def test_planned_trajectory_scan_acquires_every_point(self):
+        event_bus = InMemoryEventBus()
+        motion_port = MockMotionPort(event_bus=event_bus, motion_delay_ms=1.0, planned_trajectory=True)
+        acquisition_port = MockAcquisitionPort()
+        executor = StepScanExecutor(motion_port, acquisition_port, event_bus)
+
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=0, x_max=1, y_min=0, y_max=1),
+            x_nb_points=2,
+            y_nb_points=2,
+            scan_pattern=ScanPattern.SERPENTINE,
+            stabilization_delay_ms=0,
+            averaging_per_position=2,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+        )
+        points = [Position2D(0, 0), Position2D(1, 0), Position2D(1, 1), Position2D(0, 1)]
+        trajectory = ScanTrajectory(points)
+        scan = StepScan()
+        scan.start(config)
+
+        handed_over = []
+        start_planned_trajectory = motion_port.start_planned_trajectory
+
+        def spy(points, on_arrived=None):
+            handed_over.append(points)
+            return start_planned_trajectory(points, on_arrived)
+        motion_port.start_planned_trajectory = spy
+
+        motion_completed = []
+        event_bus.subscribe("motioncompleted", motion_completed.append)
+        done = threading.Event()
+        event_bus.subscribe("scancompleted", lambda e: done.set())
+
+        executor.execute(scan, trajectory, config)
+
+        self.assertTrue(done.wait(timeout=5.0))
+        self.assertEqual(scan.status, ScanStatus.COMPLETED)
+        self.assertEqual(motion_port.move_history, points)
+        self.assertEqual(handed_over, [trajectory])
+        self.assertIs(handed_over[0], trajectory)  # Not copied into a list
+        self.assertEqual(acquisition_port.acquire_count, 8)
+        # Per-point synchronization bypasses the event bus
+        self.assertEqual(motion_completed, [])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -120,5 +120,168 @@ class TestStepScanExecutor(DiagramFriendlyTest):
         # We expect at least ScanStarted, 2 ScanPointAcquired, ScanCompleted
         self.assertTrue(self.event_bus.mock.publish.call_count >= 4)
 
+class NoisyAcquisitionPort:
+    """Alternates v +/- noise on every channel (standard error shrinks as 1/sqrt(n))."""
+
+    def __init__(self, noise):
+        self.noise = noise
+        self.calls = 0
+
+    def acquire_sample(self):
+        from datetime import datetime
+        from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+        self.calls += 1
+        v = 1.0 + (self.noise if self.calls % 2 else -self.noise)
+        return VoltageMeasurement(v, v, v, v, v, v, timestamp=datetime.now())
+
+
+class TestStepScanExecutorAdaptiveAveraging(unittest.TestCase):
+
+    def _acquire(self, noise, adaptive):
+        from domain.value_objects.scan.adaptive_averaging import AdaptiveAveraging
+        from domain.value_objects.scan.scan_zone import ScanZone
+        from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=0, x_max=1, y_min=0, y_max=1),
+            x_nb_points=1,
+            y_nb_points=1,
+            scan_pattern=ScanPattern.RASTER,
+            stabilization_delay_ms=0,
+            averaging_per_position=50,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+            adaptive_averaging=AdaptiveAveraging.uniform(1e-3, min_samples=4, max_samples=200) if adaptive else None,
+        )
+        acquisition = NoisyAcquisitionPort(noise)
+        executor = StepScanExecutor(MagicMock(), acquisition, MagicMock())
+        scan = StepScan()
+        scan.start(config)
+        self.assertTrue(executor._acquire_point(scan, config, 0, Position2D(0, 0)))
+        return acquisition.calls, scan.points[0].measurement
+
+    def test_fixed_averaging_takes_averaging_per_position(self):
+        calls, measurement = self._acquire(noise=0.0, adaptive=False)
+        self.assertEqual(calls, 50)
+        self.assertEqual(measurement.sample_count, 50)
+
+    def test_quiet_point_stops_at_min_samples(self):
+        calls, measurement = self._acquire(noise=1e-6, adaptive=True)
+        self.assertEqual(calls, 4)
+        self.assertEqual(measurement.sample_count, 4)
+
+    def test_noisy_point_stops_when_target_reached(self):
+        # std ~ noise, standard error = noise / sqrt(n) <= 1e-3 from n ~ 100
+        calls, measurement = self._acquire(noise=1e-2, adaptive=True)
+        self.assertTrue(90 <= calls <= 110, calls)
+        self.assertEqual(measurement.sample_count, calls)
+
+    def test_too_noisy_point_bounded_by_max_samples(self):
+        calls, _ = self._acquire(noise=1.0, adaptive=True)
+        self.assertEqual(calls, 200)
+
+
+class TestStepScanExecutorPauseWhileRecording(unittest.TestCase):
+
+    def test_pause_during_record_waits_for_resume(self):
+        import threading
+        from datetime import datetime
+        from domain.services.measurement_accumulator import MeasurementAccumulator
+        from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+        from domain.value_objects.scan.scan_status import ScanStatus
+        from domain.value_objects.scan.scan_zone import ScanZone
+        from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+        from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=0, x_max=1, y_min=0, y_max=1),
+            x_nb_points=2,
+            y_nb_points=1,
+            scan_pattern=ScanPattern.RASTER,
+            stabilization_delay_ms=0,
+            averaging_per_position=1,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+        )
+        event_bus = InMemoryEventBus()
+        executor = StepScanExecutor(MagicMock(), MagicMock(), event_bus, raw_capture=True)
+        scan = StepScan()
+        scan.start(config)
+        resume = threading.Timer(0.3, scan.resume)
+
+        # The raw samples event is published after the pause check, before the add:
+        # pausing there lands the pause while the record is in flight
+        def pause_in_flight(_event):
+            scan.pause()
+            resume.start()
+
+        event_bus.subscribe("scanpointrawsamplesacquired", pause_in_flight)
+        accumulator = MeasurementAccumulator()
+        sample = VoltageMeasurement(1.0, 0.0, 0.0, 0.0, 0.0, 0.0, timestamp=datetime.now())
+        accumulator.add(sample)
+
+        executor._record_point(scan, 0, Position2D(0, 0), accumulator, [sample])
+
+        resume.join()
+        self.assertEqual(scan.status, ScanStatus.RUNNING)
+        self.assertEqual([p.point_index for p in scan.points], [0])
+
+
+class EdgeAcquisitionPort:
+    """Step response at x = 0.3 mm, read at the current stage position."""
+
+    def __init__(self, motion_port):
+        self.motion_port = motion_port
+
+    def acquire_sample(self):
+        from datetime import datetime
+        from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+        v = 1.0 if self.motion_port.get_current_position().x > 0.3 else 0.0
+        return VoltageMeasurement(v, v, 0.0, 0.0, 0.0, 0.0, timestamp=datetime.now())
+
+
+class TestStepScanExecutorRefinement(unittest.TestCase):
+
+    def test_refinement_levels_run_in_the_same_scan(self):
+        from domain.services.scan_trajectory_factory import ScanTrajectoryFactory
+        from domain.value_objects.scan.grid_refinement import GridRefinement
+        from domain.value_objects.scan.scan_status import ScanStatus
+        from domain.value_objects.scan.scan_zone import ScanZone
+        from domain.value_objects.measurement_uncertainty import MeasurementUncertainty
+        from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+        from infrastructure.mocks.adapter_mock_i_motion_port import MockMotionPort
+
+        config = StepScanConfig(
+            scan_zone=ScanZone(x_min=0, x_max=1, y_min=0, y_max=1),
+            x_nb_points=3,
+            y_nb_points=3,
+            scan_pattern=ScanPattern.SERPENTINE,
+            stabilization_delay_ms=0,
+            averaging_per_position=1,
+            measurement_uncertainty=MeasurementUncertainty(max_uncertainty_volts=1e-3),
+            refinement=GridRefinement(levels=2),
+        )
+        event_bus = InMemoryEventBus()
+        motion_port = MockMotionPort(event_bus=event_bus, motion_delay_ms=0.0, planned_trajectory=True)
+        executor = StepScanExecutor(motion_port, EdgeAcquisitionPort(motion_port), event_bus, pipelined=True)
+        acquired, completed = [], []
+        event_bus.subscribe("scanpointacquired", acquired.append)
+        event_bus.subscribe("scancompleted", completed.append)
+
+        scan = StepScan()
+        scan.start(config)
+        self.assertTrue(executor._worker(scan, ScanTrajectoryFactory.create_trajectory(config), config))
+
+        self.assertEqual(scan.status, ScanStatus.COMPLETED)
+        self.assertEqual(len(completed), 1)
+        self.assertEqual(scan.expected_points, len(scan.points))
+        levels = [p.level for p in scan.points]
+        self.assertEqual(levels[:9], [0] * 9)
+        self.assertEqual(sorted(set(levels)), [0, 1, 2])
+        self.assertEqual(levels, sorted(levels))
+        self.assertEqual([p.point_index for p in scan.points], list(range(len(scan.points))))
+        self.assertEqual([e.level for e in acquired], levels)
+        # Refined points only in the cells around the edge (0 <= x <= 0.5)
+        self.assertTrue(all(0.0 <= p.position.x <= 0.5 for p in scan.points if p.level > 0))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -3,31 +3,42 @@ ContinuousAcquisitionExecutor
 
 Responsibility:
 - Run a continuous acquisition loop in a background worker thread
-  using the IAcquisitionPort and publish domain events for each sample.
+  using the IAcquisitionPort; samples go to a ContinuousSampleBuffer,
+  lifecycle (failed, stopped) is published as domain events.
 
 Design:
 - Non‑blocking `start(config)`; loop runs in a daemon thread.
 - `stop()` uses an Event flag and join with timeout.
+- Pacing by DeadlineScheduler (absolute monotonic deadlines, no drift).
 """
 
 from __future__ import annotations
 
 import threading
 import time
+from typing import Optional
 from uuid import uuid4, UUID
 
 from application.services.continuous_acquisition_service.i_continuous_acquisition_executor import (
     IContinuousAcquisitionExecutor,
     ContinuousAcquisitionConfig,
 )
+from application.services.continuous_acquisition_service.dtos.continuous_acquisition_dtos import (
+    ContinuousAcquisitionTimingStats,
+)
 from application.services.scan_application_service.i_acquisition_port import IAcquisitionPort
 
 from domain.events.i_domain_event_bus import IDomainEventBus
 from domain.events.continuous_acquisition_events import (
-    ContinuousAcquisitionSampleAcquired,
     ContinuousAcquisitionFailed,
     ContinuousAcquisitionStopped,
 )
+from domain.events.event_topics import (
+    CONTINUOUS_ACQUISITION_FAILED,
+    CONTINUOUS_ACQUISITION_STOPPED,
+)
+from infrastructure.buffers.continuous_sample_buffer import ContinuousSampleBuffer
+from infrastructure.execution.deadline_scheduler import DeadlineScheduler
 
 
 class ContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
@@ -36,6 +47,8 @@ class ContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
         self._thread: threading.Thread | None = None
         self._stop_flag = threading.Event()
         self._current_acquisition_id: UUID | None = None
+        self._samples = ContinuousSampleBuffer()
+        self._scheduler: DeadlineScheduler | None = None
 
     def start(self, config: ContinuousAcquisitionConfig, acquisition_port: IAcquisitionPort) -> None:
         """
@@ -47,6 +60,7 @@ class ContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
             return
 
         self._stop_flag.clear()
+        self._samples.clear()
         self._current_acquisition_id = uuid4()
         self._thread = threading.Thread(
             target=self._worker,
@@ -61,6 +75,20 @@ class ContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
         if self._thread:
             self._thread.join(timeout=2.0)
 
+    def drain_samples(self, max_samples: Optional[int] = None):
+        """Buffered sample records (consumer side)."""
+        return self._samples.read(max_samples)
+
+    def get_sample_overruns(self) -> int:
+        return self._samples.overruns
+
+    def get_current_acquisition_id(self) -> UUID | None:
+        return self._current_acquisition_id
+
+    def get_timing_stats(self) -> ContinuousAcquisitionTimingStats | None:
+        scheduler = self._scheduler
+        return scheduler.stats() if scheduler is not None else None
+
     # ------------------------------------------------------------------ #
     # Internal worker
     # ------------------------------------------------------------------ #
@@ -75,34 +103,32 @@ class ContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
         if config.sample_rate_hz <= 0:
             return
 
-        dt = 1.0 / config.sample_rate_hz
-        t0 = time.time()
+        scheduler = DeadlineScheduler(config.sample_rate_hz)
+        self._scheduler = scheduler
+        t0 = time.monotonic()
         index = 0
 
         try:
+            scheduler.start()
             while not self._stop_flag.is_set():
-                if config.max_duration_s is not None and (time.time() - t0) > config.max_duration_s:
+                if config.max_duration_s is not None and (time.monotonic() - t0) > config.max_duration_s:
+                    break
+                if scheduler.wait_next(self._stop_flag) is None:
                     break
 
+                t_request = time.monotonic_ns()
                 sample = acquisition_port.acquire_sample()
-
-                event = ContinuousAcquisitionSampleAcquired(
-                    acquisition_id=acquisition_id,
-                    sample_index=index,
-                    sample=sample,
-                )
-                self._event_bus.publish("continuousacquisitionsampleacquired", event)
+                self._samples.push(index, sample, monotonic_ns=(t_request + time.monotonic_ns()) // 2)
 
                 index += 1
-                time.sleep(dt)
         except Exception as e:
             error_event = ContinuousAcquisitionFailed(
                 acquisition_id=acquisition_id,
                 reason=str(e)
             )
-            self._event_bus.publish("continuousacquisitionfailed", error_event)
+            self._event_bus.publish(CONTINUOUS_ACQUISITION_FAILED, error_event)
         finally:
             stop_event = ContinuousAcquisitionStopped(acquisition_id=acquisition_id)
-            self._event_bus.publish("continuousacquisitionstopped", stop_event)
+            self._event_bus.publish(CONTINUOUS_ACQUISITION_STOPPED, stop_event)
 
 
@@ -0,0 +1,147 @@
+"""
+DeadlineScheduler
+
+Responsibility:
+- Pace a continuous acquisition loop on absolute deadlines of the monotonic
+  clock (t0 + k * period) and measure how well the deadlines were met.
+
+Rationale:
+- `time.sleep(dt)` after each acquisition adds the acquisition time to every
+  period: the real rate is always below the target and drifts. Lock-in
+  analysis needs evenly spaced samples.
+
+Design:
+- `wait_next()` sleeps (interruptible by the stop flag) until the next deadline.
+- Catch-up/skip policy: up to `max_catch_up` late periods are run back to back
+  to recover the schedule; beyond, the missed deadlines are skipped (counted)
+  so that the loop never bursts after a long stall.
+- Statistics (lateness mean/std/max, achieved rate) are accumulated per tick.
+"""
+
+from __future__ import annotations
+
+import math
+import threading
+import time
+from typing import Callable, Optional
+
+from application.services.continuous_acquisition_service.dtos.continuous_acquisition_dtos import (
+    ContinuousAcquisitionTimingStats,
+)
+
+
+class DeadlineScheduler:
+    """
+    Absolute-deadline ticker on the monotonic clock.
+
+    Args:
+        rate_hz: Target tick rate.
+        max_catch_up: Late periods executed immediately before skipping.
+        clock_ns: Monotonic clock in nanoseconds (injectable for tests).
+    """
+
+    def __init__(
+        self,
+        rate_hz: float,
+        max_catch_up: int = 1,
+        clock_ns: Callable[[], int] = time.monotonic_ns,
+    ) -> None:
+        self._clock_ns = clock_ns
+        self._max_catch_up = max_catch_up
+        self._period_ns = self._to_period_ns(rate_hz)
+        self._rate_hz = float(rate_hz)
+        self._next_ns = 0
+        self._reset_stats()
+
+    # ==================================================================
+    # COMMANDS
+    # ==================================================================
+
+    def start(self) -> None:
+        """Anchor the schedule: the first deadline is now."""
+        self._next_ns = self._clock_ns()
+        self._reset_stats()
+
+    def set_rate(self, rate_hz: float) -> None:
+        """Change the period from the next deadline on (no phase jump)."""
+        self._period_ns = self._to_period_ns(rate_hz)
+        self._rate_hz = float(rate_hz)
+
+    def wait_next(self, stop_flag: threading.Event) -> Optional[int]:
+        """
+        Block until the next deadline.
+
+        Returns:
+            The deadline (monotonic ns) that was reached, or None if stop_flag was set.
+        """
+        now = self._clock_ns()
+        late_periods = (now - self._next_ns) // self._period_ns
+        if late_periods > self._max_catch_up:
+            self._next_ns += late_periods * self._period_ns
+            self._skipped += late_periods
+
+        remaining_ns = self._next_ns - now
+        if remaining_ns > 0:
+            if stop_flag.wait(remaining_ns / 1e9):
+                return None
+        elif stop_flag.is_set():
+            return None
+
+        actual_ns = self._clock_ns()
+        deadline_ns = self._next_ns
+        self._record_tick(actual_ns, actual_ns - deadline_ns)
+        self._next_ns += self._period_ns
+        return deadline_ns
+
+    # ==================================================================
+    # QUERIES
+    # ==================================================================
+
+    @property
+    def period_ns(self) -> int:
+        return self._period_ns
+
+    def stats(self) -> ContinuousAcquisitionTimingStats:
+        """Timing statistics since start()."""
+        n = self._ticks
+        mean = self._lateness_sum / n if n else 0.0
+        variance = max(self._lateness_sq_sum / n - mean * mean, 0.0) if n else 0.0
+        elapsed_ns = self._last_tick_ns - self._first_tick_ns
+        achieved = (n - 1) * 1e9 / elapsed_ns if n > 1 and elapsed_ns > 0 else 0.0
+        return ContinuousAcquisitionTimingStats(
+            target_rate_hz=self._rate_hz,
+            achieved_rate_hz=achieved,
+            ticks=n,
+            skipped_ticks=self._skipped,
+            jitter_mean_us=mean / 1e3,
+            jitter_std_us=math.sqrt(variance) / 1e3,
+            jitter_max_us=self._lateness_max / 1e3,
+        )
+
+    # ==================================================================
+    # INTERNAL
+    # ==================================================================
+
+    @staticmethod
+    def _to_period_ns(rate_hz: float) -> int:
+        if not rate_hz or rate_hz <= 0:
+            raise ValueError(f"rate_hz must be > 0, got {rate_hz}")
+        return max(int(round(1e9 / rate_hz)), 1)
+
+    def _reset_stats(self) -> None:
+        self._ticks = 0
+        self._skipped = 0
+        self._lateness_sum = 0.0
+        self._lateness_sq_sum = 0.0
+        self._lateness_max = 0.0
+        self._first_tick_ns = 0
+        self._last_tick_ns = 0
+
+    def _record_tick(self, actual_ns: int, lateness_ns: int) -> None:
+        if self._ticks == 0:
+            self._first_tick_ns = actual_ns
+        self._last_tick_ns = actual_ns
+        self._ticks += 1
+        self._lateness_sum += lateness_ns
+        self._lateness_sq_sum += float(lateness_ns) * lateness_ns
+        self._lateness_max = max(self._lateness_max, float(lateness_ns))
@@ -0,0 +1,569 @@
+"""
+FlyScanExecutor
+
+Responsibility:
+- Execute a scan trajectory row by row at constant velocity (on-the-fly),
+  triggering acquisitions when the measured position crosses each point.
+- Emit the same ScanPointResult stream as StepScanExecutor.
+
+Rationale:
+- With the step strategy, stop / settle / acquire dominates the wall time
+  (about 90% on an 80x80 scan). Moving each row at constant speed removes
+  the per-point stop entirely.
+
+Design:
+- Rows are consecutive trajectory points sharing the same Y (ScanTrajectory
+  order is kept, so SERPENTINE / RASTER / COMB all work). A row is an index
+  range into the trajectory: nothing is copied, positions are read on access.
+- Velocity planning from AxisParams (HS / LS / ACC / DEC of the scan axis):
+  cruise speed is capped by HS and by the time one point's acquisition takes,
+  and kept above LS and the adapter's speed floor (MIN_SPEED_HZ). A row whose
+  points cannot be acquired within one pitch at that floor is rejected.
+  Run-up / run-out distances cover the acceleration / deceleration ramps so
+  every point is crossed at cruise speed.
+- A row is a single move: it is started with move_to_within and a timeout
+  derived from the planned row duration, so slow rows are not cut short by the
+  adapter's default motion timeout.
+- Each ScanPointResult carries the measured position (mean of the reads
+  taken just before and after the acquisition), point_index keeps the grid index.
+- Pause is honoured between rows: a row cannot hold mid-pass at constant
+  velocity, so a pause requested during a row lets the row finish. The
+  points acquired after the pause are held and recorded (the aggregate only
+  accepts results while RUNNING) at the row boundary, once resumed, before
+  the stage moves to the next run-up. Cancellation stops the row immediately.
+"""
+
+from __future__ import annotations
+
+import threading
+import time
+from dataclasses import dataclass
+from typing import Any, Callable, Iterator, List, Optional, Sequence, Tuple
+
+from application.services.scan_application_service.i_scan_executor import IScanExecutor
+from application.services.motion_control_service.i_motion_port import IMotionPort
+from application.services.scan_application_service.i_acquisition_port import IAcquisitionPort
+
+from domain.aggregates.step_scan import StepScan
+from domain.events.domain_event import DomainEvent
+from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.events.motion_events import MotionCompleted, MotionFailed, MotionStopped
+from domain.events.event_topics import (
+    EMERGENCY_STOP_TRIGGERED,
+    MOTION_COMPLETED,
+    MOTION_FAILED,
+    MOTION_STOPPED,
+    topic_of,
+)
+from domain.services.measurement_accumulator import MeasurementAccumulator
+from domain.value_objects.geometric.position_2d import Position2D
+from domain.value_objects.scan.scan_point_result import ScanPointResult
+from domain.value_objects.scan.scan_status import ScanStatus
+from domain.value_objects.scan.scan_trajectory import ScanTrajectory
+from domain.value_objects.scan.step_scan_config import StepScanConfig
+
+from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import (
+    ArcusPerformax4EXController,
+    AxisParams,
+)
+
+
+@dataclass(frozen=True)
+class FlyRow:
+    """One constant-velocity pass along X."""
+    trajectory: Sequence[Position2D]  # Whole scan trajectory (shared, not copied)
+    indices: range  # Trajectory indices of the row points
+    direction: int  # +1: increasing X, -1: decreasing X
+    run_up: Position2D  # start of the acceleration ramp
+    run_out: Position2D  # end of the deceleration ramp
+    speed_mm_s: float  # cruise speed
+    duration_s: float  # planned run-up -> run-out time, ramps included
+
+    @property
+    def points(self) -> Iterator[Tuple[int, Position2D]]:
+        """(trajectory index, nominal position), created on access."""
+        return ((index, self.trajectory[index]) for index in self.indices)
+
+
+def _xy(trajectory: Sequence[Position2D], index: int) -> Tuple[float, float]:
+    """(x, y) of a point, without creating a Position2D for a ScanTrajectory."""
+    if isinstance(trajectory, ScanTrajectory):
+        return trajectory.xy(index)
+    position = trajectory[index]
+    return position.x, position.y
+
+
+class FlyScanExecutor(IScanExecutor):
+    """
+    Concrete scan executor for the fly-scan (continuous motion) strategy.
+
+    Notes:
+    - Same contract as StepScanExecutor: non-blocking execute(), domain
+      events published after each point.
+    - StepScanConfig.stabilization_delay_ms is not used (the stage never stops).
+    """
+
+    MOTION_TIMEOUT_S = 30.0  # Positioning moves and per-point margin
+
+    # Fraction of the point pitch travelled during one point's acquisition
+    ACQUISITION_FILL_FACTOR = 0.5
+
+    # Safety factor on the acceleration / deceleration distances
+    RAMP_MARGIN = 1.2
+
+    # Safety factor on the planned row duration (row move timeout)
+    ROW_TIMEOUT_FACTOR = 1.5
+
+    # Period of position reads while flying a row
+    POSITION_POLL_S = 0.001
+
+    # Fallback for motion ports without a step calibration (mocks)
+    DEFAULT_MM_PER_STEP = 0.0436
+
+    def __init__(
+        self,
+        motion_port: IMotionPort,
+        acquisition_port: IAcquisitionPort,
+        event_bus: IDomainEventBus,
+        axis_params_provider: Optional[Callable[[], AxisParams]] = None,
+        mm_per_step: Optional[float] = None,
+    ) -> None:
+        """
+        Args:
+            motion_port: Motion port (positions in mm, set_speed in mm/s).
+            acquisition_port: Acquisition port (acquire_sample).
+            event_bus: Domain event bus.
+            axis_params_provider: Returns the current scan-axis (X) parameters,
+                called at the start of each scan. Defaults to the Arcus defaults.
+            mm_per_step: Step calibration. If None, read from motion_port.MM_PER_STEP
+                at the start of each scan (follows calibration updates).
+        """
+        self._motion_port = motion_port
+        self._acquisition_port = acquisition_port
+        self._event_bus = event_bus
+        self._axis_params_provider = axis_params_provider or (
+            lambda: ArcusPerformax4EXController.DEFAULT_PARAMS["X"]
+        )
+        self._mm_per_step = mm_per_step
+
+        # State for event synchronization
+        self._pending_motion_id: Optional[str] = None
+        self._motion_completed_event = threading.Event()
+        self._motion_error: Optional[str] = None
+        self._current_scan: Optional[StepScan] = None
+        self._held_results: List[ScanPointResult] = []  # Acquired while paused (mid-row)
+
+    # ------------------------------------------------------------------ #
+    # IScanExecutor implementation
+    # ------------------------------------------------------------------ #
+
+    def execute(
+        self,
+        scan: StepScan,
+        trajectory: ScanTrajectory,
+        config: StepScanConfig,
+    ) -> bool:
+        """
+        Start the fly scan in a background thread and return immediately.
+        """
+        self._current_scan = scan
+
+        thread = threading.Thread(
+            target=self._worker,
+            args=(scan, trajectory, config),
+            daemon=True
+        )
+        thread.start()
+        return True
+
+    def cancel(self, scan: StepScan) -> None:
+        """Mark scan as cancelled. The running row is stopped by the worker."""
+        scan.cancel()
+        self._publish_events(scan.domain_events)
+
+    def pause(self, scan: StepScan) -> None:
+        """Mark scan as paused. Takes effect at the end of the current row (the row is finished)."""
+        scan.pause()
+        self._publish_events(scan.domain_events)
+
+    def resume(self, scan: StepScan) -> None:
+        """Mark scan as resumed."""
+        scan.resume()
+        self._publish_events(scan.domain_events)
+
+    # ------------------------------------------------------------------ #
+    # Velocity planning
+    # ------------------------------------------------------------------ #
+
+    @classmethod
+    def plan_rows(
+        cls,
+        trajectory: Sequence[Position2D],
+        axis_params: AxisParams,
+        mm_per_step: float,
+        point_time_s: float,
+        x_limits: Tuple[float, float],
+        min_speed_hz: float = 0.0,
+    ) -> List[FlyRow]:
+        """
+        Split the trajectory into constant-Y rows and plan each pass.
+
+        Args:
+            trajectory: Ordered scan positions (mm), indexed (ScanTrajectory or list).
+            axis_params: Scan-axis parameters (LS/HS in Hz, ACC/DEC in ms).
+            mm_per_step: Step calibration.
+            point_time_s: Duration of one point's acquisition (all averages).
+            x_limits: Allowed (x_min, x_max) travel for run-up / run-out.
+            min_speed_hz: Lowest speed the motion port can set (Hz).
+
+        Returns:
+            Planned rows, in trajectory order.
+
+        Raises:
+            ValueError: If a row cannot be flown (one point's acquisition
+                outlasts its pitch even at the minimum speed).
+        """
+        max_speed = axis_params.hs * mm_per_step
+        low_speed = axis_params.ls * mm_per_step
+        min_speed = max(axis_params.ls, min_speed_hz) * mm_per_step
+        if min_speed > max_speed:
+            raise ValueError(f"Scan axis HS ({axis_params.hs} Hz) below its minimum speed ({min_speed / mm_per_step:.0f} Hz)")
+        x_min, x_max = x_limits
+
+        rows: List[FlyRow] = []
+        for indices in cls._split_rows(trajectory):
+            first_x, y = _xy(trajectory, indices[0])
+            last_x, _ = _xy(trajectory, indices[-1])
+            direction = 1 if last_x >= first_x else -1
+
+            speed = max_speed
+            pitch = cls._min_pitch(trajectory, indices)
+            if pitch > 0 and point_time_s > 0:
+                speed = min(speed, cls.ACQUISITION_FILL_FACTOR * pitch / point_time_s)
+            if speed < min_speed:
+                if min_speed * point_time_s > pitch:
+                    raise ValueError(
+                        f"Row y={y:.3f} mm cannot be flown: one point takes {point_time_s:.3f} s, "
+                        f"more than the {pitch:.3f} mm pitch at the minimum speed ({min_speed:.3f} mm/s). "
+                        "Reduce the averaging or use the step strategy"
+                    )
+                speed = min_speed
+
+            run_up_mm = cls._ramp_distance(speed, low_speed, axis_params.acc)
+            run_out_mm = cls._ramp_distance(speed, low_speed, axis_params.dec)
+            start_x = min(max(first_x - direction * run_up_mm, x_min), x_max)
+            end_x = min(max(last_x + direction * run_out_mm, x_min), x_max)
+            duration = abs(end_x - start_x) / speed + (axis_params.acc + axis_params.dec) / 1000.0
+
+            rows.append(FlyRow(
+                trajectory=trajectory,
+                indices=indices,
+                direction=direction,
+                run_up=Position2D(x=start_x, y=y),
+                run_out=Position2D(x=end_x, y=y),
+                speed_mm_s=speed,
+                duration_s=duration,
+            ))
+        return rows
+
+    @staticmethod
+    def _split_rows(trajectory: Sequence[Position2D]) -> List[range]:
+        """Index ranges of the runs of consecutive points sharing the same Y."""
+        rows: List[range] = []
+        start, previous_y = 0, None
+        for index in range(len(trajectory)):
+            y = _xy(trajectory, index)[1]
+            if previous_y is not None and abs(previous_y - y) >= 1e-9:
+                rows.append(range(start, index))
+                start = index
+            previous_y = y
+        if len(trajectory):
+            rows.append(range(start, len(trajectory)))
+        return rows
+
+    @staticmethod
+    def _min_pitch(trajectory: Sequence[Position2D], indices: range) -> float:
+        pitches = [
+            abs(_xy(trajectory, b)[0] - _xy(trajectory, a)[0])
+            for a, b in zip(indices, indices[1:])
+        ]
+        return min(pitches) if pitches else 0.0
+
+    @classmethod
+    def _ramp_distance(cls, speed: float, low_speed: float, ramp_ms: int) -> float:
+        """Distance covered by a linear LS -> speed ramp lasting ramp_ms."""
+        if speed <= low_speed:
+            return 0.0
+        return cls.RAMP_MARGIN * 0.5 * (low_speed + speed) * (ramp_ms / 1000.0)
+
+    # ------------------------------------------------------------------ #
+    # Event Handlers
+    # ------------------------------------------------------------------ #
+
+    def _on_motion_completed(self, event: MotionCompleted) -> None:
+        if self._pending_motion_id and event.motion_id == self._pending_motion_id:
+            self._motion_completed_event.set()
+
+    def _on_motion_failed(self, event: MotionFailed) -> None:
+        if self._pending_motion_id and event.motion_id == self._pending_motion_id:
+            self._motion_error = event.error
+            self._motion_completed_event.set()
+
+    def _on_emergency_stop_triggered(self, event: Any) -> None:
+        self._motion_error = "Emergency Stop Triggered"
+        if self._current_scan:
+            self._current_scan.cancel()
+        self._motion_completed_event.set()
+
+    def _on_motion_stopped(self, event: MotionStopped) -> None:
+        self._motion_error = f"Motion stopped: {event.reason}"
+        self._motion_completed_event.set()
+
+    # ------------------------------------------------------------------ #
+    # Internal worker
+    # ------------------------------------------------------------------ #
+
+    def _worker(
+        self,
+        scan: StepScan,
+        trajectory: ScanTrajectory,
+        config: StepScanConfig,
+    ) -> bool:
+        self._event_bus.subscribe(MOTION_COMPLETED, self._on_motion_completed)
+        self._event_bus.subscribe(MOTION_FAILED, self._on_motion_failed)
+        self._event_bus.subscribe(MOTION_STOPPED, self._on_motion_stopped)
+        self._event_bus.subscribe(EMERGENCY_STOP_TRIGGERED, self._on_emergency_stop_triggered)
+
+        if getattr(config, "refinement", None) is not None:
+            print("[FlyScanExecutor] Grid refinement not supported in fly scan: coarse grid only")
+
+        axis_params = self._axis_params_provider()
+        mm_per_step = self._resolve_mm_per_step()
+        positioning_speed = axis_params.hs * mm_per_step
+        self._held_results = []
+
+        try:
+            x_max, _ = self._motion_port.get_axis_limits()
+            rows = self.plan_rows(
+                trajectory,
+                axis_params,
+                mm_per_step,
+                point_time_s=self._measure_point_time(config),
+                x_limits=(0.0, x_max),
+                min_speed_hz=getattr(self._motion_port, "MIN_SPEED_HZ", 0.0),
+            )
+
+            for row in rows:
+                if scan.status == ScanStatus.CANCELLED:
+                    return False
+                # Row boundary: hold while paused, then record the held points
+                if not self._release_held_results(scan):
+                    return False
+                if not self._fly_row(scan, config, row, positioning_speed):
+                    return False
+            if not self._release_held_results(scan):
+                return False
+
+            if scan.status != ScanStatus.COMPLETED:
+                scan.complete()
+                self._publish_events(scan.domain_events)
+            return True
+
+        except Exception as exc:
+            scan.fail(str(exc))
+            self._publish_events(scan.domain_events)
+            return False
+        finally:
+            self._current_scan = None
+            try:
+                self._motion_port.set_speed(positioning_speed)
+            except Exception as e:
+                print(f"[FlyScanExecutor] Failed to restore positioning speed: {e}")
+            self._event_bus.unsubscribe(MOTION_COMPLETED, self._on_motion_completed)
+            self._event_bus.unsubscribe(MOTION_FAILED, self._on_motion_failed)
+            self._event_bus.unsubscribe(MOTION_STOPPED, self._on_motion_stopped)
+            self._event_bus.unsubscribe(EMERGENCY_STOP_TRIGGERED, self._on_emergency_stop_triggered)
+
+    def _resolve_mm_per_step(self) -> float:
+        if self._mm_per_step is not None:
+            return self._mm_per_step
+        return float(getattr(self._motion_port, "MM_PER_STEP", self.DEFAULT_MM_PER_STEP))
+
+    def _measure_point_time(self, config: StepScanConfig) -> float:
+        """Time one (discarded) sample and scale by the averaging count."""
+        start = time.perf_counter()
+        self._acquisition_port.acquire_sample()
+        return (time.perf_counter() - start) * config.averaging_per_position
+
+    def _fly_row(
+        self,
+        scan: StepScan,
+        config: StepScanConfig,
+        row: FlyRow,
+        positioning_speed: float,
+    ) -> bool:
+        """
+        Position at the run-up point, then cross the row at cruise speed.
+
+        Returns:
+            True if every point of the row was acquired, False if cancelled.
+        """
+        # A. Position at run-up (regular speed, full stop)
+        self._motion_port.set_speed(positioning_speed)
+        self._start_motion(row.run_up)
+        if not self._wait_motion(scan, self.MOTION_TIMEOUT_S):
+            return False
+
+        # B. Cruise through the row (one move, timed on the planned duration)
+        row_timeout = self.MOTION_TIMEOUT_S + self.ROW_TIMEOUT_FACTOR * row.duration_s
+        self._motion_port.set_speed(row.speed_mm_s)
+        self._start_motion(row.run_out, timeout_s=row_timeout)
+        deadline = time.time() + row_timeout
+
+        for index, target in row.points:
+            position = self._wait_crossing(scan, row, index, target, deadline)
+            if position is None:
+                return False
+            if not self._acquire_point(scan, config, index, position):
+                return False
+
+        # C. Let the deceleration ramp finish
+        return self._wait_motion(scan, max(deadline - time.time(), 0.0))
+
+    def _wait_crossing(
+        self,
+        scan: StepScan,
+        row: FlyRow,
+        index: int,
+        target: Position2D,
+        deadline: float,
+    ) -> Optional[Position2D]:
+        """
+        Poll the position until the stage crosses target.x in the row direction.
+
+        Returns:
+            The position read at the crossing, or None if cancelled.
+        """
+        while True:
+            if scan.status == ScanStatus.CANCELLED:
+                self._motion_port.stop()
+                return None
+            if self._motion_error:
+                raise RuntimeError(f"Motion failed: {self._motion_error}")
+
+            position = self._motion_port.get_current_position()
+            if (position.x - target.x) * row.direction >= 0:
+                return position
+
+            if self._motion_completed_event.is_set():
+                raise RuntimeError(f"Row motion ended before point {index} (x={target.x:.3f} mm)")
+            if time.time() > deadline:
+                raise RuntimeError(f"Motion timeout before point {index}")
+
+            time.sleep(self.POSITION_POLL_S)
+
+    def _acquire_point(
+        self,
+        scan: StepScan,
+        config: StepScanConfig,
+        index: int,
+        position_before: Position2D,
+    ) -> bool:
+        """
+        Acquire, average and record one point tagged with its measured position.
+
+        Returns:
+            False if the scan was cancelled, True otherwise.
+        """
+        accumulator = MeasurementAccumulator()
+        for _ in range(config.averaging_per_position):
+            if scan.status == ScanStatus.CANCELLED:
+                self._motion_port.stop()
+                return False
+            accumulator.add(self._acquisition_port.acquire_sample())
+        position_after = self._motion_port.get_current_position()
+
+        averaged_measurement = accumulator.to_measurement()
+        point_result = ScanPointResult(
+            position=Position2D(
+                x=(position_before.x + position_after.x) / 2.0,
+                y=(position_before.y + position_after.y) / 2.0,
+            ),
+            measurement=averaged_measurement,
+            point_index=index,
+        )
+        self._record_point(scan, point_result)
+        return True
+
+    def _record_point(self, scan: StepScan, point_result: ScanPointResult) -> None:
+        """Add the point now, or hold it if the scan was paused during the row."""
+        if not self._held_results and scan.status == ScanStatus.RUNNING:
+            try:
+                scan.add_point_result(point_result)
+                self._publish_events(scan.domain_events)
+                return
+            except ValueError:
+                if scan.status != ScanStatus.PAUSED:
+                    raise
+        self._held_results.append(point_result)
+
+    def _release_held_results(self, scan: StepScan) -> bool:
+        """
+        Wait while paused, then record the held points in order.
+
+        Returns:
+            False if the scan was cancelled meanwhile.
+        """
+        while True:
+            if not self._wait_while_paused(scan) or scan.status == ScanStatus.CANCELLED:
+                return False
+            if not self._held_results:
+                return True
+            try:
+                scan.add_point_result(self._held_results[0])
+            except ValueError:
+                if scan.status == ScanStatus.PAUSED:
+                    continue  # Paused again in between
+                raise
+            self._held_results.pop(0)
+            self._publish_events(scan.domain_events)
+
+    def _start_motion(self, position: Position2D, timeout_s: Optional[float] = None) -> None:
+        self._motion_error = None
+        self._motion_completed_event.clear()
+        if timeout_s is None:
+            self._pending_motion_id = self._motion_port.move_to(position)
+        else:
+            self._pending_motion_id = self._motion_port.move_to_within(position, timeout_s)
+
+    def _wait_motion(self, scan: StepScan, timeout: float) -> bool:
+        """Wait for the pending motion. Returns False if cancelled."""
+        start_wait = time.time()
+        while not self._motion_completed_event.is_set():
+            if scan.status == ScanStatus.CANCELLED:
+                self._motion_port.stop()
+                return False
+            if time.time() - start_wait > timeout:
+                raise RuntimeError(f"Motion timeout after {timeout:.1f}s")
+            time.sleep(0.01)
+
+        if self._motion_error:
+            raise RuntimeError(f"Motion failed: {self._motion_error}")
+        return True
+
+    def _wait_while_paused(self, scan: StepScan) -> bool:
+        """Block while paused. Returns False if cancelled meanwhile."""
+        while scan.status == ScanStatus.PAUSED:
+            time.sleep(0.1)
+            if scan.status == ScanStatus.CANCELLED:
+                return False
+        return True
+
+    # ------------------------------------------------------------------ #
+    # Helper
+    # ------------------------------------------------------------------ #
+
+    def _publish_events(self, events: List[DomainEvent]) -> None:
+        for event in events:
+            event_type = topic_of(event)
+            self._event_bus.publish(event_type, event)
@@ -0,0 +1,85 @@
+"""
+PipelineStage
+
+Responsibility:
+- Run jobs submitted by a hardware loop on a dedicated worker thread, in
+  submission order, so that the loop can start the next hardware step
+  (e.g. the move to point N+1) while job N is processed.
+
+Rationale:
+- In a step scan the post-acquisition work (statistics, aggregate update,
+  ScanPointAcquired publishing and the exports subscribed to it) does not
+  need the stage: it can overlap the next move.
+
+Design:
+- One worker thread, FIFO queue bounded by `max_pending` (back-pressure:
+  submit() blocks if the consumer side falls that far behind).
+- The first job exception is kept; later jobs are skipped and the error is
+  re-raised to the producer on the next submit() or drain().
+"""
+
+from __future__ import annotations
+
+import queue
+import threading
+from typing import Any, Callable, Optional
+
+_STOP = object()
+
+
+class PipelineStage:
+    """
+    Ordered single-worker job stage.
+
+    Args:
+        name: Worker thread name.
+        max_pending: Maximum queued jobs before submit() blocks.
+    """
+
+    def __init__(self, name: str = "PipelineStage", max_pending: int = 64) -> None:
+        self._queue: "queue.Queue[Any]" = queue.Queue(maxsize=max_pending)
+        self._error: Optional[BaseException] = None
+        self._thread = threading.Thread(target=self._run, name=name, daemon=True)
+        self._thread.start()
+
+    # ==================================================================
+    # COMMANDS
+    # ==================================================================
+
+    def submit(self, job: Callable[..., Any], *args: Any) -> None:
+        """Queue job(*args). Raises the pending error of a previous job, if any."""
+        self._raise_pending_error()
+        self._queue.put((job, args))
+
+    def drain(self) -> None:
+        """Block until every submitted job is done, then raise the first job error."""
+        self._queue.join()
+        self._raise_pending_error()
+
+    def close(self) -> None:
+        """Process the remaining jobs, then stop the worker (errors are not raised)."""
+        self._queue.put(_STOP)
+        self._thread.join()
+
+    # ==================================================================
+    # INTERNAL
+    # ==================================================================
+
+    def _raise_pending_error(self) -> None:
+        if self._error is not None:
+            error, self._error = self._error, None
+            raise error
+
+    def _run(self) -> None:
+        while True:
+            item = self._queue.get()
+            try:
+                if item is _STOP:
+                    return
+                job, args = item
+                if self._error is None:
+                    job(*args)
+            except BaseException as exc:
+                self._error = exc
+            finally:
+                self._queue.task_done()
@@ -0,0 +1,130 @@
+"""
+Threaded Planned Trajectory Run - Infrastructure Layer
+
+Responsibility:
+- Drive a pre-planned point list on a dedicated thread
+- Implement the arrival/release handshake of IPlannedTrajectoryRun
+
+Rationale:
+- Shared by every motion adapter offering planned trajectories (Arcus,
+  mocks): adapters only provide a blocking "move to point i" function.
+
+Design:
+- One Condition guards arrivals, releases and termination state.
+- Move i+1 starts as soon as release() is called for point i: no command
+  queue, no event bus on the per-point path.
+- The point sequence is indexed, never copied: a ScanTrajectory stays
+  array-backed and creates each Position2D when its move starts.
+"""
+
+import threading
+from collections import deque
+from typing import Callable, Deque, Optional, Sequence, Tuple
+
+from application.services.motion_control_service.i_planned_trajectory_run import IPlannedTrajectoryRun
+from domain.value_objects.geometric.position_2d import Position2D
+
+
+class ThreadedPlannedTrajectoryRun(IPlannedTrajectoryRun):
+    """
+    Planned trajectory driven by a background thread.
+
+    Args:
+        points: Ordered target positions (indexable, e.g. ScanTrajectory).
+        move_and_wait: Blocking move to (index, target); returns the actual
+            position on arrival, raises on failure.
+        on_arrived: Optional callback (index, actual_position).
+        name: Thread name (debugging).
+    """
+
+    def __init__(
+        self,
+        points: Sequence[Position2D],
+        move_and_wait: Callable[[int, Position2D], Position2D],
+        on_arrived: Optional[Callable[[int, Position2D], None]] = None,
+        name: str = "PlannedTrajectoryRun",
+    ) -> None:
+        self._points = points
+        self._move_and_wait = move_and_wait
+        self._on_arrived = on_arrived
+
+        self._condition = threading.Condition()
+        self._arrivals: Deque[Tuple[int, Position2D]] = deque()
+        self._released = 0
+        self._aborted = False
+        self._done = False
+        self._error: Optional[str] = None
+
+        self._thread = threading.Thread(target=self._run, daemon=True, name=name)
+
+    def start(self) -> "ThreadedPlannedTrajectoryRun":
+        self._thread.start()
+        return self
+
+    # ------------------------------------------------------------------ #
+    # Worker
+    # ------------------------------------------------------------------ #
+
+    def _run(self) -> None:
+        try:
+            for index in range(len(self._points)):
+                with self._condition:
+                    while index > self._released and not self._aborted:
+                        self._condition.wait()
+                    if self._aborted:
+                        return
+
+                actual = self._move_and_wait(index, self._points[index])
+
+                with self._condition:
+                    if self._aborted:
+                        return
+                    self._arrivals.append((index, actual))
+                    self._condition.notify_all()
+
+                if self._on_arrived is not None:
+                    self._on_arrived(index, actual)
+        except Exception as e:
+            with self._condition:
+                self._error = str(e)
+        finally:
+            with self._condition:
+                self._done = True
+                self._condition.notify_all()
+
+    # ------------------------------------------------------------------ #
+    # IPlannedTrajectoryRun
+    # ------------------------------------------------------------------ #
+
+    def wait_for_arrival(self, timeout: float) -> Optional[Tuple[int, Position2D]]:
+        with self._condition:
+            self._condition.wait_for(lambda: self._arrivals or self._done, timeout=timeout)
+            if self._arrivals:
+                return self._arrivals.popleft()
+            return None
+
+    def release(self) -> None:
+        with self._condition:
+            self._released += 1
+            self._condition.notify_all()
+
+    def abort(self) -> None:
+        with self._condition:
+            self._aborted = True
+            self._arrivals.clear()
+            self._condition.notify_all()
+
+    @property
+    def finished(self) -> bool:
+        with self._condition:
+            return self._done and not self._arrivals
+
+    @property
+    def error(self) -> Optional[str]:
+        with self._condition:
+            return self._error
+
+    @property
+    def aborted(self) -> bool:
+        with self._condition:
+            return self._aborted
@@ -11,12 +11,24 @@ from application.services.scan_application_service.i_acquisition_port import IAc
 from domain.aggregates.step_scan import StepScan
 from domain.events.domain_event import DomainEvent
 from domain.events.i_domain_event_bus import IDomainEventBus
-from domain.services.measurement_statistics_service import MeasurementStatisticsService
+from domain.services.grid_refinement_planner import GridRefinementPlanner
+from domain.services.measurement_accumulator import MeasurementAccumulator
 from domain.value_objects.scan.scan_trajectory import ScanTrajectory
 from domain.value_objects.scan.step_scan_config import StepScanConfig
 from domain.value_objects.scan.scan_point_result import ScanPointResult
 from domain.value_objects.scan.scan_status import ScanStatus
 from domain.events.motion_events import MotionCompleted, MotionFailed, MotionStopped
+from domain.events.scan_events import ScanPointRawSamplesAcquired
+from domain.events.event_topics import (
+    EMERGENCY_STOP_TRIGGERED,
+    MOTION_COMPLETED,
+    MOTION_FAILED,
+    MOTION_STOPPED,
+    topic_of,
+)
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+from infrastructure.execution.pipeline_stage import PipelineStage
+from infrastructure.instrumentation.hot_path_tracer import TRACER
 
 
 class StepScanExecutor(IScanExecutor):
@@ -27,17 +39,43 @@ class StepScanExecutor(IScanExecutor):
     - Decouples motion execution from scan logic via Domain Events.
     - Handles asynchronous motion hardware (like Arcus) correctly.
     - Allows responsive cancellation during motion wait.
+    - When the motion port supports planned trajectories, the whole point
+      list is handed over once and the executor only waits for arrivals.
+    - In pipelined mode, averaging, aggregate update and event publishing
+      (hence the exports) run on a PipelineStage: the hardware path is only
+      move + settle + sample.
+    - In raw capture mode, the individual samples of each point are published
+      (ScanPointRawSamplesAcquired) so that they can be exported and
+      re-averaged offline.
+    - With config.adaptive_averaging, a point stops sampling as soon as the
+      streaming accumulator reaches the target standard error (bounded by
+      min/max samples); the achieved count is in measurement.sample_count.
+    - With config.refinement, the trajectory is the coarse pass: each
+      refinement level is then planned from the results (GridRefinementPlanner)
+      and run in the same scan, point indices continuing, points tagged with
+      their level.
+    - Hot-path tracer spans (category "scan"): move (command or wait ->
+      arrival), settle, acquire, statistics.
     """
 
+    MOTION_TIMEOUT_S = 30.0  # TODO: Make configurable
+
     def __init__(
         self,
         motion_port: IMotionPort,
         acquisition_port: IAcquisitionPort,
         event_bus: IDomainEventBus,
+        use_planned_trajectory: bool = True,
+        pipelined: bool = False,
+        raw_capture: bool = False,
     ) -> None:
         self._motion_port = motion_port
         self._acquisition_port = acquisition_port
         self._event_bus = event_bus
+        self._use_planned_trajectory = use_planned_trajectory
+        self._pipelined = pipelined
+        self._raw_capture = raw_capture
+        self._post_stage: Optional[PipelineStage] = None
         
         # State for event synchronization
         self._pending_motion_id: Optional[str] = None
@@ -139,99 +177,23 @@ class StepScanExecutor(IScanExecutor):
         Core execution loop using event-based motion synchronization.
         """
         # Subscribe to motion events
-        self._event_bus.subscribe("motioncompleted", self._on_motion_completed)
-        self._event_bus.subscribe("motionfailed", self._on_motion_failed)
-        self._event_bus.subscribe("motionstopped", self._on_motion_stopped)
-        self._event_bus.subscribe("emergencystoptriggered", self._on_emergency_stop_triggered)
-
-        try:
-            for i, position in enumerate(trajectory):
-                # Check for cancellation
-                if scan.status == ScanStatus.CANCELLED:
-                    return False
-
-                # Check for pause - block until resumed or cancelled
-                while scan.status == ScanStatus.PAUSED:
-                    time.sleep(0.1)  # Wait for resume
-                    # Check if cancelled during pause
-                    if scan.status == ScanStatus.CANCELLED:
-                        return False
+        self._event_bus.subscribe(MOTION_COMPLETED, self._on_motion_completed)
+        self._event_bus.subscribe(MOTION_FAILED, self._on_motion_failed)
+        self._event_bus.subscribe(MOTION_STOPPED, self._on_motion_stopped)
+        self._event_bus.subscribe(EMERGENCY_STOP_TRIGGERED, self._on_emergency_stop_triggered)
 
-                # A. Move (Event-Based)
-                self._motion_error = None
-                self._motion_completed_event.clear()
-                
-                # Start motion
-                # print(f"[StepScanExecutor] Moving to {position}...")
-                motion_id = self._motion_port.move_to(position)
-                self._pending_motion_id = motion_id
-                
-                # Wait for completion (with cancellation check)
-                timeout = 30.0 # TODO: Make configurable
-                start_wait = time.time()
-                
-                while not self._motion_completed_event.is_set():
-                    # Check cancellation during wait
-                    if scan.status == ScanStatus.CANCELLED:
-                        self._motion_port.stop()  # Regular stop with deceleration
-                        return False
-                    
-                    # Check pause during wait
-                    if scan.status == ScanStatus.PAUSED:
-                        # Motion is already started, we should wait for it to complete
-                        # but we can pause after motion completes
-                        pass
-                    
-                    # Check timeout
-                    if time.time() - start_wait > timeout:
-                        raise RuntimeError(f"Motion timeout after {timeout}s")
-                    
-                    time.sleep(0.01) # Avoid CPU spin
-                
-                # Check for motion failure
-                if self._motion_error:
-                     raise RuntimeError(f"Motion failed: {self._motion_error}")
-
-                # Check for pause AFTER motion completes (safe point)
-                while scan.status == ScanStatus.PAUSED:
-                    time.sleep(0.1)
-                    if scan.status == ScanStatus.CANCELLED:
-                        return False
-
-                # B. Stabilize
-                if config.stabilization_delay_ms > 0:
-                    # print(f"[StepScanExecutor] Stabilizing for {config.stabilization_delay_ms}ms...")
-                    time.sleep(config.stabilization_delay_ms / 1000.0)
-                
-                # Check for pause/cancel after stabilization (safe point)
-                if scan.status == ScanStatus.CANCELLED:
-                    return False
-                while scan.status == ScanStatus.PAUSED:
-                    time.sleep(0.1)
-                    if scan.status == ScanStatus.CANCELLED:
-                        return False
-
-                # C. Acquire (Infrastructure)
-                measurements = []
-                for _ in range(config.averaging_per_position):
-                    # Check cancellation during acquisition?
-                    if scan.status == ScanStatus.CANCELLED:
-                        return False
-                    measurements.append(self._acquisition_port.acquire_sample())
-
-                # D. Average (Domain Service)
-                averaged_measurement = MeasurementStatisticsService.calculate_statistics(measurements)
-
-                # E. Create value object and add to aggregate
-                point_result = ScanPointResult(
-                    position=position,
-                    measurement=averaged_measurement,
-                    point_index=i,
-                )
-                scan.add_point_result(point_result)
+        if self._pipelined:
+            self._post_stage = PipelineStage(name="StepScan_PostProcessing")
 
-                # F. Publish domain events
-                self._publish_events(scan.domain_events)
+        try:
+            completed = self._run_trajectory(scan, trajectory, config)
+            if completed and config.refinement is not None:
+                completed = self._run_refinement(scan, config)
+            # Every acquired point must be recorded before finalizing
+            if self._post_stage is not None:
+                self._post_stage.drain()
+            if not completed:
+                return False
 
             # Finalize if not already completed by domain
             if scan.status != ScanStatus.COMPLETED:
@@ -246,12 +208,288 @@ class StepScanExecutor(IScanExecutor):
             self._publish_events(scan.domain_events)
             return False
         finally:
+            if self._post_stage is not None:
+                self._post_stage.close()
+                self._post_stage = None
             self._current_scan = None
             # Unsubscribe to avoid leaks
-            self._event_bus.unsubscribe("motioncompleted", self._on_motion_completed)
-            self._event_bus.unsubscribe("motionfailed", self._on_motion_failed)
-            self._event_bus.unsubscribe("motionstopped", self._on_motion_stopped)
-            self._event_bus.unsubscribe("emergencystoptriggered", self._on_emergency_stop_triggered)
+            self._event_bus.unsubscribe(MOTION_COMPLETED, self._on_motion_completed)
+            self._event_bus.unsubscribe(MOTION_FAILED, self._on_motion_failed)
+            self._event_bus.unsubscribe(MOTION_STOPPED, self._on_motion_stopped)
+            self._event_bus.unsubscribe(EMERGENCY_STOP_TRIGGERED, self._on_emergency_stop_triggered)
+
+    def _planned_trajectory_available(self) -> bool:
+        if not self._use_planned_trajectory:
+            return False
+        supports = getattr(self._motion_port, "supports_planned_trajectory", None)
+        return callable(supports) and supports() is True
+
+    def _run_trajectory(
+        self,
+        scan: StepScan,
+        trajectory: ScanTrajectory,
+        config: StepScanConfig,
+        level: int = 0,
+        index_offset: int = 0,
+    ) -> bool:
+        if self._planned_trajectory_available():
+            return self._run_planned_trajectory(scan, trajectory, config, level, index_offset)
+        return self._run_point_by_point(scan, trajectory, config, level, index_offset)
+
+    def _run_refinement(self, scan: StepScan, config: StepScanConfig) -> bool:
+        """
+        Plan and run the refinement levels after the coarse pass.
+
+        Returns:
+            True if every planned point was acquired, False if cancelled.
+        """
+        planner = GridRefinementPlanner(config)
+        while not planner.finished:
+            # The planner needs every result of the previous level
+            if self._post_stage is not None:
+                self._post_stage.drain()
+            if scan.status == ScanStatus.CANCELLED:
+                return False
+            results = scan.points
+            refined = planner.plan_next_level(results)
+            if len(refined) == 0:
+                break
+            print(f"[StepScanExecutor] Refinement level {planner.level}: {len(refined)} points "
+                  f"(threshold {planner.threshold_volts:.3g} V)")
+            scan.extend_expected_points(len(refined))
+            if not self._run_trajectory(scan, refined, config, planner.level, index_offset=len(results)):
+                return False
+        return True
+
+    def _run_point_by_point(
+        self,
+        scan: StepScan,
+        trajectory: ScanTrajectory,
+        config: StepScanConfig,
+        level: int = 0,
+        index_offset: int = 0,
+    ) -> bool:
+        """
+        One move_to() per point, synchronized on MotionCompleted events.
+
+        Returns:
+            True if every point was acquired, False if cancelled.
+        """
+        for i, position in enumerate(trajectory):
+            # Check for cancellation
+            if scan.status == ScanStatus.CANCELLED:
+                return False
+
+            # Check for pause - block until resumed or cancelled
+            if not self._wait_while_paused(scan):
+                return False
+
+            # A. Move (Event-Based)
+            self._motion_error = None
+            self._motion_completed_event.clear()
+            
+            # Start motion
+            t_move = TRACER.start()
+            motion_id = self._motion_port.move_to(position)
+            self._pending_motion_id = motion_id
+            
+            # Wait for completion (with cancellation check)
+            timeout = self.MOTION_TIMEOUT_S
+            start_wait = time.time()
+            
+            while not self._motion_completed_event.is_set():
+                # Check cancellation during wait
+                if scan.status == ScanStatus.CANCELLED:
+                    self._motion_port.stop()  # Regular stop with deceleration
+                    return False
+                
+                # Pause during motion: the move completes, pause applies afterwards
+                
+                # Check timeout
+                if time.time() - start_wait > timeout:
+                    raise RuntimeError(f"Motion timeout after {timeout}s")
+                
+                time.sleep(0.01) # Avoid CPU spin
+            TRACER.end("scan", "move", t_move)
+            
+            # Check for motion failure
+            if self._motion_error:
+                 raise RuntimeError(f"Motion failed: {self._motion_error}")
+
+            if not self._acquire_point(scan, config, index_offset + i, position, level):
+                return False
+
+        return True
+
+    def _run_planned_trajectory(
+        self,
+        scan: StepScan,
+        trajectory: ScanTrajectory,
+        config: StepScanConfig,
+        level: int = 0,
+        index_offset: int = 0,
+    ) -> bool:
+        """
+        Hand the whole trajectory to the motion port, then acquire on each arrival.
+
+        The next move starts as soon as release() is called, without going
+        through the command queue or the event bus.
+
+        Returns:
+            True if every point was acquired, False if cancelled.
+        """
+        self._motion_error = None
+        # The trajectory is handed over as is: array-backed, indexed by the run
+        run = self._motion_port.start_planned_trajectory(trajectory)
+        try:
+            for expected_index, position in enumerate(trajectory):
+                start_wait = time.time()
+                t_move = TRACER.start()
+                arrival = None
+                while arrival is None:
+                    if scan.status == ScanStatus.CANCELLED or self._motion_error:
+                        break
+                    arrival = run.wait_for_arrival(timeout=0.05)
+                    if arrival is None and run.finished:
+                        break
+                    if arrival is None and time.time() - start_wait > self.MOTION_TIMEOUT_S:
+                        raise RuntimeError(f"Motion timeout after {self.MOTION_TIMEOUT_S}s")
+                TRACER.end("scan", "move", t_move)
+
+                if scan.status == ScanStatus.CANCELLED:
+                    self._motion_port.stop()
+                    return False
+                if self._motion_error:
+                    raise RuntimeError(f"Motion failed: {self._motion_error}")
+                if arrival is None:
+                    raise RuntimeError(f"Motion failed: {run.error or 'trajectory ended early'}")
+
+                index, _actual_position = arrival
+                if index != expected_index:
+                    raise RuntimeError(f"Trajectory out of order: got point {index}, expected {expected_index}")
+
+                if not self._acquire_point(scan, config, index_offset + index, position, level):
+                    return False
+                run.release()
+            return True
+        finally:
+            run.abort()
+
+    def _wait_while_paused(self, scan: StepScan) -> bool:
+        """Block while paused. Returns False if cancelled meanwhile."""
+        while scan.status == ScanStatus.PAUSED:
+            time.sleep(0.1)
+            if scan.status == ScanStatus.CANCELLED:
+                return False
+        return True
+
+    def _acquire_point(
+        self,
+        scan: StepScan,
+        config: StepScanConfig,
+        index: int,
+        position: Any,
+        level: int = 0,
+    ) -> bool:
+        """
+        Stabilize, acquire, average and record one point (motion already done).
+
+        Returns:
+            False if the scan was cancelled, True otherwise.
+        """
+        # Check for pause AFTER motion completes (safe point)
+        if not self._wait_while_paused(scan):
+            return False
+
+        # B. Stabilize
+        if config.stabilization_delay_ms > 0:
+            t0 = TRACER.start()
+            time.sleep(config.stabilization_delay_ms / 1000.0)
+            TRACER.end("scan", "settle", t0)
+        
+        # Check for pause/cancel after stabilization (safe point)
+        if scan.status == ScanStatus.CANCELLED:
+            return False
+        if not self._wait_while_paused(scan):
+            return False
+
+        # C. Acquire (Infrastructure)
+        accumulator = MeasurementAccumulator()
+        raw_samples: Optional[List[VoltageMeasurement]] = [] if self._raw_capture else None
+        adaptive = config.adaptive_averaging
+        t_acquire = TRACER.start()
+        for _ in range(config.max_samples_per_position()):
+            # Check cancellation during acquisition?
+            if scan.status == ScanStatus.CANCELLED:
+                return False
+            sample = self._acquisition_port.acquire_sample()
+            accumulator.add(sample)
+            if raw_samples is not None:
+                raw_samples.append(sample)
+            # Adaptive dwell: stop once every channel reached its target standard error
+            if (
+                adaptive is not None
+                and accumulator.count >= adaptive.min_samples
+                and adaptive.is_reached(accumulator.count, accumulator.standard_error())
+            ):
+                break
+        TRACER.end("scan", "acquire", t_acquire)
+
+        # D-F. Off the hardware path when pipelined (overlaps the next move)
+        if self._post_stage is not None:
+            self._post_stage.submit(self._record_point, scan, index, position, accumulator, raw_samples, level)
+        else:
+            self._record_point(scan, index, position, accumulator, raw_samples, level)
+        return True
+
+    def _record_point(
+        self,
+        scan: StepScan,
+        index: int,
+        position: Any,
+        accumulator: MeasurementAccumulator,
+        raw_samples: Optional[List[VoltageMeasurement]] = None,
+        level: int = 0,
+    ) -> None:
+        """Average, add the point to the aggregate and publish its events."""
+        # D. Average (Domain Service)
+        t0 = TRACER.start()
+        averaged_measurement = accumulator.to_measurement()
+        TRACER.end("scan", "statistics", t0)
+
+        # The aggregate only accepts results while RUNNING
+        if not self._wait_while_paused(scan) or scan.status == ScanStatus.CANCELLED:
+            return
+
+        # Raw samples first: the last point may complete the scan
+        if raw_samples is not None:
+            raw_event = ScanPointRawSamplesAcquired(
+                scan_id=scan.id,
+                point_index=index,
+                samples=tuple(raw_samples),
+            )
+            self._event_bus.publish(topic_of(raw_event), raw_event)
+
+        # E. Create value object and add to aggregate
+        point_result = ScanPointResult(
+            position=position,
+            measurement=averaged_measurement,
+            point_index=index,
+            level=level,
+        )
+        while True:
+            try:
+                scan.add_point_result(point_result)
+                break
+            except ValueError:
+                if scan.status != ScanStatus.PAUSED:
+                    raise
+            # Paused between the check and the add (pipeline thread): retry once resumed
+            if not self._wait_while_paused(scan) or scan.status == ScanStatus.CANCELLED:
+                return
+
+        # F. Publish domain events
+        self._publish_events(scan.domain_events)
 
     # ------------------------------------------------------------------ #
     # Helper
@@ -259,5 +497,5 @@ class StepScanExecutor(IScanExecutor):
 
     def _publish_events(self, events: List[DomainEvent]) -> None:
         for event in events:
-            event_type = type(event).__name__.lower()
+            event_type = topic_of(event)
             self._event_bus.publish(event_type, event)
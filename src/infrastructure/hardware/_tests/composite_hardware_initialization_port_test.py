@@ -0,0 +1,160 @@
+import threading
+import time
+import unittest
+import sys
+from pathlib import Path
+from unittest import mock
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from infrastructure.hardware.composite_hardware_initialization_port import CompositeHardwareInitializationPort
+from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import ArcusPerformax4EXController
+
+
+class FakeSubsystem:
+    """Initializer taking `delay_s`, recording start/end times."""
+
+    def __init__(self, name, delay_s=0.1, fail=False, log=None):
+        self.name = name
+        self.delay_s = delay_s
+        self.fail = fail
+        self.log = log if log is not None else []
+        self.started_at = None
+        self.closed = False
+
+    def initialize_all(self):
+        self.started_at = time.monotonic()
+        self.log.append(("start", self.name))
+        time.sleep(self.delay_s)
+        if self.fail:
+            raise RuntimeError(f"{self.name} failed")
+        self.log.append(("end", self.name))
+        return {"device": self.name}
+
+    def verify_all(self):
+        time.sleep(self.delay_s)
+        return not self.fail
+
+    def close_all(self):
+        self.closed = True
+
+
+class TestCompositeHardwareInitializationPort(unittest.TestCase):
+
+    def test_independent_subsystems_initialize_concurrently(self):
+        subsystems = [FakeSubsystem("arcus", 0.2), FakeSubsystem("mcu", 0.2)]
+        port = CompositeHardwareInitializationPort(subsystems, names=["arcus", "mcu"])
+
+        start = time.monotonic()
+        resources = port.initialize_all()
+        elapsed = time.monotonic() - start
+
+        self.assertLess(elapsed, 0.35)
+        self.assertEqual(resources["arcus_device"], "arcus")
+        self.assertEqual(resources["mcu_device"], "mcu")
+        timing = resources[CompositeHardwareInitializationPort.TIMINGS_KEY]
+        self.assertEqual(set(timing), {"arcus", "mcu"})
+        self.assertGreaterEqual(timing["arcus"], 0.2)
+        self.assertEqual([t.phase for t in port.timings], ["initialize", "initialize"])
+
+    def test_default_names_keep_subsystem_prefix(self):
+        port = CompositeHardwareInitializationPort([FakeSubsystem("a", 0.0), FakeSubsystem("b", 0.0)])
+        resources = port.initialize_all()
+        self.assertEqual(resources["subsystem_0_device"], "a")
+        self.assertEqual(resources["subsystem_1_device"], "b")
+
+    def test_dependency_waits_for_its_prerequisite(self):
+        log = []
+        subsystems = [FakeSubsystem("mcu", 0.1, log=log), FakeSubsystem("arcus", 0.0, log=log)]
+        port = CompositeHardwareInitializationPort(
+            subsystems, names=["mcu", "arcus"], depends_on={"arcus": ["mcu"]}
+        )
+        port.initialize_all()
+        self.assertLess(log.index(("end", "mcu")), log.index(("start", "arcus")))
+
+    def test_failure_skips_dependents_and_lets_others_finish(self):
+        log = []
+        subsystems = [
+            FakeSubsystem("mcu", 0.0, fail=True, log=log),
+            FakeSubsystem("excitation", 0.0, log=log),
+            FakeSubsystem("arcus", 0.1, log=log),
+        ]
+        port = CompositeHardwareInitializationPort(
+            subsystems, names=["mcu", "excitation", "arcus"], depends_on={"excitation": ["mcu"]}
+        )
+        with self.assertRaisesRegex(RuntimeError, "mcu failed"):
+            port.initialize_all()
+        self.assertIn(("end", "arcus"), log)
+        self.assertNotIn(("start", "excitation"), log)
+        errors = {t.name: t.error for t in port.timings}
+        self.assertEqual(errors["mcu"], "mcu failed")
+        self.assertEqual(errors["excitation"], "skipped: dependency failed")
+        self.assertIsNone(errors["arcus"])
+
+    def test_verify_all_runs_concurrently_and_combines(self):
+        subsystems = [FakeSubsystem("a", 0.2), FakeSubsystem("b", 0.2)]
+        port = CompositeHardwareInitializationPort(subsystems)
+        start = time.monotonic()
+        self.assertTrue(port.verify_all())
+        self.assertLess(time.monotonic() - start, 0.35)
+
+        subsystems[1].fail = True
+        self.assertFalse(port.verify_all())
+
+    def test_invalid_dependencies_rejected(self):
+        subsystems = [FakeSubsystem("a"), FakeSubsystem("b")]
+        with self.assertRaises(ValueError):
+            CompositeHardwareInitializationPort(subsystems, names=["a", "b"], depends_on={"a": ["c"]})
+        with self.assertRaises(ValueError):
+            CompositeHardwareInitializationPort(subsystems, names=["a", "b"], depends_on={"a": ["b"], "b": ["a"]})
+
+    def test_close_all_in_reverse_order(self):
+        order = []
+        subsystems = [FakeSubsystem("a"), FakeSubsystem("b")]
+        for subsystem in subsystems:
+            subsystem.close_all = lambda name=subsystem.name: order.append(name)
+        CompositeHardwareInitializationPort(subsystems).close_all()
+        self.assertEqual(order, ["b", "a"])
+
+
+class FakeStage:
+    """Arcus stage answering HS queries and recording writes."""
+
+    def __init__(self, hs):
+        self.params = {"HSX": hs, "HSY": hs, "LSX": 10, "LSY": 10, "ACCX": 300, "ACCY": 300, "DECX": 300, "DECY": 300}
+        self.writes = []
+        self._lock = threading.Lock()
+
+    def query(self, command):
+        if "=" in command:
+            key, value = command.split("=")
+            self.writes.append(command)
+            self.params[key] = int(value)
+            return ""
+        return str(self.params[command])
+
+
+class TestArcusDefaultParams(unittest.TestCase):
+
+    def _apply(self, stage):
+        controller = ArcusPerformax4EXController()
+        controller._stage = stage
+        with mock.patch("infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX.time.sleep"):
+            controller._apply_default_params()
+
+    def test_parameters_already_set_are_skipped(self):
+        stage = FakeStage(hs=ArcusPerformax4EXController.DEFAULT_PARAMS["X"].hs)
+        self._apply(stage)
+        self.assertEqual(stage.writes, [])
+
+    def test_differing_parameters_are_written(self):
+        stage = FakeStage(hs=500)
+        self._apply(stage)
+        self.assertEqual(stage.writes, ["HSX=1500", "HSY=1500"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,98 @@
+import threading
+import time
+import unittest
+import sys
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from infrastructure.hardware.arcus_performax_4EX.arcus_status_poller import ArcusStatusPoller
+
+
+class FakeMovingController:
+    """Simulates a move towards a target: moving for a given duration, then stopped at target."""
+
+    MOVING = 0x004
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._target = (0, 0)
+        self._position = (0, 0)
+        self._stop_at = 0.0
+        self.reads = 0
+
+    def start_move(self, target, duration_s):
+        with self._lock:
+            self._target = target
+            self._stop_at = time.monotonic() + duration_s
+
+    def get_motion_snapshot(self):
+        with self._lock:
+            self.reads += 1
+            if time.monotonic() < self._stop_at:
+                x, y = self._position
+                self._position = (x + 1, y + 1)
+                return self._position[0], self._position[1], self.MOVING, self.MOVING
+            self._position = self._target
+            return self._target[0], self._target[1], 0, 0
+
+
+class TestArcusStatusPoller(unittest.TestCase):
+    def setUp(self):
+        self.controller = FakeMovingController()
+        self.updates = []
+        self.poller = ArcusStatusPoller(
+            self.controller,
+            on_update=self.updates.append,
+            poll_interval_s=0.001,
+            publish_interval_s=0.05,
+        )
+        self.poller.start()
+
+    def tearDown(self):
+        self.poller.stop()
+
+    def test_wait_for_stop_wakes_up_right_after_motion_end(self):
+        self.controller.start_move((500, 250), duration_s=0.05)
+        sequence = self.poller.sequence
+
+        start = time.monotonic()
+        snapshot = self.poller.wait_for_stop(sequence, timeout=2.0, target_steps=(500, 250))
+        elapsed = time.monotonic() - start
+
+        self.assertIsNotNone(snapshot)
+        self.assertEqual((snapshot.steps_x, snapshot.steps_y), (500, 250))
+        self.assertFalse(snapshot.is_moving)
+        self.assertLess(elapsed, 0.05 + 0.04)
+
+    def test_updates_are_throttled_while_moving(self):
+        self.controller.start_move((10_000, 10_000), duration_s=0.2)
+        self.poller.wait_for_stop(self.poller.sequence, timeout=2.0, target_steps=(10_000, 10_000))
+        time.sleep(0.01)
+
+        # Many polls, but only edges + one update per publish interval
+        self.assertGreater(self.controller.reads, 50)
+        self.assertLess(len(self.updates), 10)
+        self.assertTrue(any(u.is_moving for u in self.updates))
+        self.assertFalse(self.updates[-1].is_moving)
+
+    def test_stopped_away_from_target_waits_start_grace(self):
+        # Controller never starts moving: accepted only after START_GRACE_S
+        start = time.monotonic()
+        snapshot = self.poller.wait_for_stop(self.poller.sequence, timeout=2.0, target_steps=(42, 42))
+        elapsed = time.monotonic() - start
+
+        self.assertIsNotNone(snapshot)
+        self.assertGreaterEqual(elapsed, ArcusStatusPoller.START_GRACE_S - 0.005)
+
+    def test_wait_returns_none_after_stop(self):
+        self.controller.start_move((1, 1), duration_s=5.0)
+        threading.Timer(0.05, self.poller.stop).start()
+        self.assertIsNone(self.poller.wait_for_stop(self.poller.sequence, timeout=2.0))
+
+
+if __name__ == "__main__":
+    unittest.main()
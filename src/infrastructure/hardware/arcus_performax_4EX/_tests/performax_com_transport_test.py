@@ -0,0 +1,109 @@
+import ctypes
+import unittest
+import sys
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from infrastructure.hardware.arcus_performax_4EX.performax_com_transport import (
+    PerformaxComError,
+    PerformaxComStage,
+    PerformaxComTransport,
+)
+
+
+class FakePerformaxLib:
+    """In-memory stand-in for PerformaxCom.dll (same entry points, same BOOL returns)."""
+
+    def __init__(self, replies=None):
+        self.sent = []
+        self.replies = replies or {}
+        self.open_calls = 0
+        self.closed = False
+        self.timeouts = None
+
+    def fnPerformaxComGetNumDevices(self, num_devices):
+        return 1
+
+    def fnPerformaxComSetTimeouts(self, read_ms, write_ms):
+        self.timeouts = (read_ms, write_ms)
+        return 1
+
+    def fnPerformaxComOpen(self, device_index, handle):
+        self.open_calls += 1
+        return 1
+
+    def fnPerformaxComClose(self, handle):
+        self.closed = True
+        return 1
+
+    def fnPerformaxComFlush(self, handle):
+        return 1
+
+    def fnPerformaxComSendRecv(self, handle, w_buffer, n_write, n_read, r_buffer):
+        command = w_buffer.value.decode("ascii")
+        self.sent.append(command)
+        reply = self.replies.get(command, "OK").encode("ascii") + b"\x00"
+        ctypes.memmove(r_buffer, reply, len(reply))
+        return 1
+
+
+class TestPerformaxComTransport(unittest.TestCase):
+    def setUp(self):
+        self.lib = FakePerformaxLib(replies={"PX": "1200", "PY": "-35", "MST": "4:0:0:0"})
+        self.transport = PerformaxComTransport(lib=self.lib, read_timeout_ms=250, write_timeout_ms=300)
+        self.transport.open()
+
+    def test_open_sets_timeouts_once(self):
+        self.transport.open()
+        self.assertEqual(self.lib.open_calls, 1)
+        self.assertEqual(self.lib.timeouts, (250, 300))
+
+    def test_send_recv_many_preserves_order(self):
+        replies = self.transport.send_recv_many(["PX", "PY", "MST"])
+        self.assertEqual(replies, ["1200", "-35", "4:0:0:0"])
+        self.assertEqual(self.lib.sent, ["PX", "PY", "MST"])
+
+    def test_buffers_are_reused_between_commands(self):
+        # A long command followed by a short one must not leak trailing bytes
+        self.transport.send_recv("HSX=1500")
+        self.transport.send_recv("PX")
+        self.assertEqual(self.lib.sent[-1], "PX")
+
+    def test_device_error_reply_raises(self):
+        self.lib.replies["BAD"] = "?Invalid"
+        with self.assertRaises(PerformaxComError):
+            self.transport.send_recv("BAD")
+
+    def test_closed_transport_raises(self):
+        self.transport.close()
+        self.assertTrue(self.lib.closed)
+        with self.assertRaises(PerformaxComError):
+            self.transport.send_recv("PX")
+
+
+class TestPerformaxComStage(unittest.TestCase):
+    def setUp(self):
+        self.lib = FakePerformaxLib(replies={"PX": "1200", "MST": "4:32:0:0"})
+        self.stage = PerformaxComStage(PerformaxComTransport(lib=self.lib))
+
+    def test_open_configures_absolute_mode(self):
+        self.assertEqual(self.lib.sent[:2], ["ABS", "IERR=1"])
+
+    def test_move_and_home_commands(self):
+        self.stage.move_to("x", 229)
+        self.stage.home("y", direction="-", home_mode="only_home_input")
+        self.stage.set_position_reference("y", 0)
+        self.assertEqual(self.lib.sent[-3:], ["X229", "HY-0", "PY=0"])
+
+    def test_status_decoding(self):
+        self.assertEqual(self.stage.get_position("x"), 1200)
+        self.assertEqual(self.stage.is_moving(), [True, False, False, False])
+        self.assertIn("sw_minus_lim", self.stage.get_status("y"))
+
+
+if __name__ == "__main__":
+    unittest.main()
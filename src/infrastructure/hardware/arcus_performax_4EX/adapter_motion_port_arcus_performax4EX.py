@@ -15,7 +15,7 @@ Design (QCS):
 - QUERY  : read-only state (get_current_position, is_moving)
 """
 
-from typing import Optional, List, Dict, Any
+from typing import Optional, List, Dict, Any, Callable, Sequence
 import time
 import json
 import os
@@ -25,12 +25,24 @@ from uuid import uuid4
 from datetime import datetime
 from domain.events.i_domain_event_bus import IDomainEventBus
 from domain.events.motion_events import MotionStarted, MotionCompleted, MotionFailed, PositionUpdated
+from domain.events.event_topics import (
+    MOTION_COMPLETED,
+    MOTION_FAILED,
+    MOTION_STARTED,
+    POSITION_UPDATED,
+)
 
 from application.services.motion_control_service.i_motion_port import IMotionPort
+from application.services.motion_control_service.i_planned_trajectory_run import IPlannedTrajectoryRun
+from infrastructure.execution.planned_trajectory_run import ThreadedPlannedTrajectoryRun
 from domain.value_objects.geometric.position_2d import Position2D
 from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import (
     ArcusPerformax4EXController,
 )
+from infrastructure.hardware.arcus_performax_4EX.arcus_status_poller import (
+    ArcusStatusPoller,
+    MotionSnapshot,
+)
 from pathlib import Path
 
 
@@ -72,10 +84,9 @@ class ArcusAdapter(IMotionPort):
         # Async Worker Infrastructure
         self._command_queue = queue.Queue()
         self._worker_thread: Optional[threading.Thread] = None
-        self._monitor_thread: Optional[threading.Thread] = None
+        self._poller: Optional[ArcusStatusPoller] = None
         self._running = False
-        self._last_position: Optional[Position2D] = None
-        self._last_moving: bool = False
+        self._trajectory_run: Optional[ThreadedPlannedTrajectoryRun] = None
         
         # Initialize calibration with defaults
         self.MICRONS_PER_STEP = ArcusAdapter.MICRONS_PER_STEP
@@ -135,7 +146,7 @@ class ArcusAdapter(IMotionPort):
         self._stop_worker()
 
     def _start_worker(self):
-        """Start the background worker and monitor threads."""
+        """Start the background worker thread and the status poller."""
         if self._worker_thread is not None and self._worker_thread.is_alive():
             return
 
@@ -145,15 +156,16 @@ class ArcusAdapter(IMotionPort):
         self._worker_thread = threading.Thread(target=self._worker_loop, daemon=True)
         self._worker_thread.start()
         
-        # Monitor Worker
-        self._monitor_thread = threading.Thread(target=self._monitor_loop, daemon=True)
-        self._monitor_thread.start()
+        # Status Poller: single reader of PX/PY/MST, wakes the worker on motion end
+        self._poller = ArcusStatusPoller(self._controller, on_update=self._on_status_update)
+        self._poller.start()
         
-        print("[ArcusAdapter] Worker and Monitor threads started")
+        print("[ArcusAdapter] Worker thread and status poller started")
 
     def _stop_worker(self):
         """Stop the background threads."""
         self._running = False
+        self._abort_trajectory()
         
         # Stop Command Worker
         if self._worker_thread:
@@ -162,10 +174,10 @@ class ArcusAdapter(IMotionPort):
             self._worker_thread.join(timeout=2.0)
             self._worker_thread = None
             
-        # Stop Monitor Worker
-        if self._monitor_thread:
-            self._monitor_thread.join(timeout=2.0)
-            self._monitor_thread = None
+        # Stop Status Poller
+        if self._poller:
+            self._poller.stop()
+            self._poller = None
             
         print("[ArcusAdapter] Threads stopped")
 
@@ -184,29 +196,32 @@ class ArcusAdapter(IMotionPort):
                     break
                 
                 if cmd_type == "MOVE_TO":
-                    motion_id, position = args
+                    motion_id, position, timeout = args
                     start_time = time.time()
                     try:
                         self._internal_move_to(position)
-                        # Give hardware time to update status register
-                        time.sleep(0.25) 
-                        self._internal_wait_until_stopped()
+                        snapshot = self._internal_wait_until_stopped(
+                            timeout=timeout, target_steps=self._to_steps(position)
+                        )
                         
                         if self._event_bus:
                             duration = (time.time() - start_time) * 1000
-                            # CRITICAL: Read ACTUAL position from hardware to ensure truth
-                            final_pos = self.get_current_position()
+                            # CRITICAL: Report ACTUAL position read from hardware after stop
+                            if snapshot is not None:
+                                final_pos = self._snapshot_to_position(snapshot)
+                            else:
+                                final_pos = self.get_current_position()
                             
-                            self._event_bus.publish("motioncompleted", MotionCompleted(
+                            self._event_bus.publish(MOTION_COMPLETED, MotionCompleted(
                                 motion_id=motion_id,
                                 final_position=final_pos,
                                 duration_ms=duration
                             ))
-                            # Note: PositionUpdated is handled by _monitor_loop
+                            # Note: PositionUpdated is handled by the status poller
                     except Exception as e:
                         print(f"[ArcusAdapter] Motion failed: {e}")
                         if self._event_bus:
-                            self._event_bus.publish("motionfailed", MotionFailed(
+                            self._event_bus.publish(MOTION_FAILED, MotionFailed(
                                 motion_id=motion_id,
                                 error=str(e)
                             ))
@@ -229,59 +244,39 @@ class ArcusAdapter(IMotionPort):
             except Exception as e:
                 print(f"[ArcusAdapter] Worker error: {e}")
 
-    def _monitor_loop(self):
+    def _on_status_update(self, snapshot: MotionSnapshot) -> None:
         """
-        Background loop to monitor position and status.
-        Publishes PositionUpdated events when changes are detected.
+        Poller callback (throttled): publish PositionUpdated.
+        Called on start/stop edges and at most every publish interval while moving.
         """
-        POLL_INTERVAL = 0.15  # 150ms
-        
-        while self._running:
-            try:
-                if not self._controller or not self._controller.is_connected():
-                    time.sleep(1.0)
-                    continue
-                
-                # Get current state
-                current_pos = self.get_current_position()
-                is_moving = self.is_moving()
-                
-                # Check for changes
-                pos_changed = False
-                if self._last_position is None:
-                    pos_changed = True
-                else:
-                    # Epsilon check for float comparison (0.001 mm)
-                    if (abs(current_pos.x - self._last_position.x) > 0.001 or 
-                        abs(current_pos.y - self._last_position.y) > 0.001):
-                        pos_changed = True
-                
-                status_changed = (is_moving != self._last_moving)
-                
-                # Publish if changed
-                if pos_changed or status_changed:
-                    if self._event_bus:
-                        self._event_bus.publish("positionupdated", PositionUpdated(
-                            position=current_pos,
-                            is_moving=is_moving
-                        ))
-                    
-                    self._last_position = current_pos
-                    self._last_moving = is_moving
-                
-                time.sleep(POLL_INTERVAL)
-                
-            except Exception as e:
-                # Don't crash the monitor thread on transient errors
-                # print(f"[ArcusAdapter] Monitor error: {e}")
-                time.sleep(1.0)
+        if self._event_bus:
+            self._event_bus.publish(POSITION_UPDATED, PositionUpdated(
+                position=self._snapshot_to_position(snapshot),
+                is_moving=snapshot.is_moving
+            ))
+
+    def _to_steps(self, position: Position2D) -> tuple:
+        """Convert a position (mm) to commanded (steps_x, steps_y)."""
+        return int(position.x * self.STEPS_PER_MM), int(position.y * self.STEPS_PER_MM)
+
+    def _snapshot_to_position(self, snapshot: MotionSnapshot) -> Position2D:
+        """Convert a status snapshot (steps) to a position (mm)."""
+        return Position2D(x=snapshot.steps_x * self.MM_PER_STEP, y=snapshot.steps_y * self.MM_PER_STEP)
+
+    def _fresh_snapshot(self) -> Optional[MotionSnapshot]:
+        """Latest poller snapshot if recent enough to stand for a hardware read."""
+        if self._poller is None or not self._poller.is_running():
+            return None
+        snapshot = self._poller.latest()
+        if snapshot is None or time.monotonic() - snapshot.timestamp > self.FRESH_SNAPSHOT_S:
+            return None
+        return snapshot
 
     def _internal_move_to(self, position: Position2D):
         """Internal synchronous move execution."""
         try:
             # Convert mm to steps
-            steps_x = int(position.x * self.STEPS_PER_MM)
-            steps_y = int(position.y * self.STEPS_PER_MM)
+            steps_x, steps_y = self._to_steps(position)
             
             if self._controller:
                 self._controller.move_to(self._axis_x, steps_x)
@@ -308,8 +303,28 @@ class ArcusAdapter(IMotionPort):
         axis, position = args
         self._controller.set_position_reference(axis, position)
 
-    def _internal_wait_until_stopped(self, timeout: float = 30.0, poll_interval: float = 0.1):
-        """Internal synchronous wait."""
+    def _internal_wait_until_stopped(self, timeout: float = 30.0, poll_interval: float = 0.1,
+                                     target_steps: Optional[tuple] = None) -> Optional[MotionSnapshot]:
+        """
+        Internal synchronous wait.
+
+        With the status poller running, wakes up on the first post-command
+        snapshot showing the axes stopped (no fixed settle delay).
+
+        Returns:
+            The stopped snapshot when the poller is used, None otherwise.
+        """
+        if self._poller is not None and self._poller.is_running():
+            snapshot = self._poller.wait_for_stop(
+                after_sequence=self._poller.sequence,
+                timeout=timeout,
+                target_steps=target_steps,
+                should_abort=lambda: not self._running,
+            )
+            if snapshot is None and self._running:
+                print(f"[ArcusAdapter] Motion timeout after {timeout}s")
+            return snapshot
+
         start_time = time.time()
         while self.is_moving():
             if not self._running: # Abort if worker stopped
@@ -318,6 +333,7 @@ class ArcusAdapter(IMotionPort):
                 print(f"[ArcusAdapter] Motion timeout after {timeout}s")
                 break
             time.sleep(poll_interval)
+        return None
 
     # ==========================================================================
     # COMMANDS
@@ -331,32 +347,53 @@ class ArcusAdapter(IMotionPort):
     STEPS_PER_MM = 1.0 / MM_PER_STEP         # ~22.936 steps/mm
     STEPS_PER_CM = 1.0 / CM_PER_STEP         # ~229.36 steps/cm
 
+    # Poller snapshots younger than this are served instead of a DLL read
+    FRESH_SNAPSHOT_S = 0.02
+
+    # Default wait for the end of a single move (MOVE_TO), in seconds
+    MOTION_TIMEOUT_S = 30.0
+
+    # Speed range accepted by set_speed (Hz), values outside are clamped
+    MIN_SPEED_HZ = 10
+    MAX_SPEED_HZ = 100000
+
     def move_to(self, position: Position2D) -> str:
         """
         COMMAND: Move to the specified 2D position.
         
+        Async: Pushes command to worker queue and returns immediately.
+        Returns: motion_id
+        """
+        return self.move_to_within(position, self.MOTION_TIMEOUT_S)
+
+    def move_to_within(self, position: Position2D, timeout_s: float) -> str:
+        """
+        COMMAND: Move to the specified 2D position, waiting up to timeout_s for the stop.
+
         Async: Pushes command to worker queue and returns immediately.
         Returns: motion_id
         """
         if not self._controller:
             raise RuntimeError("Arcus controller not connected")
+        if self._trajectory_active():
+            raise RuntimeError("A planned trajectory is in progress")
 
         motion_id = str(uuid4())
         
         if self._event_bus:
-            self._event_bus.publish("motionstarted", MotionStarted(
+            self._event_bus.publish(MOTION_STARTED, MotionStarted(
                 motion_id=motion_id,
                 target_position=position
             ))
             # Publish position update (is_moving=True)
             current_pos = self.get_current_position()
-            self._event_bus.publish("positionupdated", PositionUpdated(
+            self._event_bus.publish(POSITION_UPDATED, PositionUpdated(
                 position=current_pos,
                 is_moving=True
             ))
 
         # Push to queue
-        self._command_queue.put(("MOVE_TO", (motion_id, position)))
+        self._command_queue.put(("MOVE_TO", (motion_id, position, timeout_s)))
         
         return motion_id
 
@@ -368,6 +405,7 @@ class ArcusAdapter(IMotionPort):
             immediate: If True, abrupt stop. If False, gradual deceleration.
         """
         # Clear pending commands
+        self._abort_trajectory()
         with self._command_queue.mutex:
             self._command_queue.queue.clear()
 
@@ -375,6 +413,62 @@ class ArcusAdapter(IMotionPort):
             self._controller.stop(self._axis_x, immediate=immediate)
             self._controller.stop(self._axis_y, immediate=immediate)
 
+    def supports_planned_trajectory(self) -> bool:
+        """QUERY: The Arcus adapter can drive a whole point list."""
+        return True
+
+    def start_planned_trajectory(
+        self,
+        points: Sequence[Position2D],
+        on_arrived: Optional[Callable[[int, Position2D], None]] = None,
+    ) -> IPlannedTrajectoryRun:
+        """
+        COMMAND: Drive a pre-planned point list.
+
+        Targets are converted to steps when their move starts (the point
+        sequence is indexed, not copied). Each move is a single
+        batched X/Y command, completion is detected by the status poller
+        and the next move starts on release(), bypassing the command queue
+        and the event bus.
+
+        Returns:
+            Handle to wait for arrivals and release the next move.
+        """
+        if not self._controller:
+            raise RuntimeError("Arcus controller not connected")
+        if self._trajectory_active():
+            raise RuntimeError("A planned trajectory is already in progress")
+
+        # Let queued single moves/homing finish before taking over the axes
+        self.wait_until_stopped()
+
+        self._trajectory_run = ThreadedPlannedTrajectoryRun(
+            points,
+            move_and_wait=lambda _index, position: self._trajectory_move(self._to_steps(position)),
+            on_arrived=on_arrived,
+            name="ArcusPlannedTrajectory",
+        ).start()
+        return self._trajectory_run
+
+    def _trajectory_move(self, target_steps: tuple) -> Position2D:
+        """Blocking move used by the planned trajectory thread."""
+        self._controller.move_to_xy(*target_steps)
+        snapshot = self._internal_wait_until_stopped(target_steps=target_steps)
+        if snapshot is not None:
+            return self._snapshot_to_position(snapshot)
+        if self._poller is not None and self._poller.is_running():
+            raise RuntimeError(f"Motion to {target_steps} steps did not complete")
+        return self.get_current_position()
+
+    def _trajectory_active(self) -> bool:
+        run = self._trajectory_run
+        return run is not None and not run.finished and not run.aborted
+
+    def _abort_trajectory(self) -> None:
+        if self._trajectory_run is not None:
+            self._trajectory_run.abort()
+            self._trajectory_run = None
+
     def emergency_stop(self) -> None:
         """
         COMMAND: Immediately stop any ongoing motion (Hard Stop).
@@ -401,7 +495,7 @@ class ArcusAdapter(IMotionPort):
             
             # Clamp to hardware limits (approx 10 to 10000 Hz usually)
             # TODO: Verify max speed with datasheet/user
-            speed_hz = max(10, min(speed_hz, 100000))
+            speed_hz = max(self.MIN_SPEED_HZ, min(speed_hz, self.MAX_SPEED_HZ))
             
             self._controller.set_speed(speed_hz)
         except Exception as e:
@@ -455,6 +549,12 @@ class ArcusAdapter(IMotionPort):
             time.sleep(poll_interval)
 
         # 2. Wait for hardware to report stopped (in case of manual moves/inertia)
+        if self._poller is not None and self._poller.is_running():
+            remaining = timeout - (time.time() - start_time)
+            if self._poller.wait_for_stop(after_sequence=self._poller.sequence, timeout=max(remaining, 0.0)) is None:
+                raise RuntimeError(f"Motion timeout after {timeout}s")
+            return
+
         while self.is_moving():
             if time.time() - start_time > timeout:
                 raise RuntimeError(f"Motion timeout after {timeout}s")
@@ -477,6 +577,10 @@ class ArcusAdapter(IMotionPort):
         if not self._controller:
             raise RuntimeError("Arcus controller not connected")
 
+        snapshot = self._fresh_snapshot()
+        if snapshot is not None:
+            return self._snapshot_to_position(snapshot)
+
         try:
             steps_x = self._controller.get_position(self._axis_x)
             steps_y = self._controller.get_position(self._axis_y)
@@ -502,6 +606,10 @@ class ArcusAdapter(IMotionPort):
         if not self._controller:
             raise RuntimeError("Arcus controller not connected")
 
+        snapshot = self._fresh_snapshot()
+        if snapshot is not None:
+            return snapshot.is_moving
+
         try:
             return self._controller.is_moving(self._axis_x) or self._controller.is_moving(self._axis_y)
         except Exception as e:
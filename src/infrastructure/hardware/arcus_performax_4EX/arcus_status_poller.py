@@ -0,0 +1,225 @@
+"""
+Arcus Status Poller - Infrastructure Layer
+
+Responsibility:
+- Single owner of periodic status reads (PX, PY, MST) on the Arcus controller
+- Wake up waiters as soon as a motion completes (condition variable)
+- Feed throttled position notifications to the motion adapter
+
+Rationale:
+- The adapter used two pollers on the same DLL handle (worker wait loop at
+  100 ms, monitor loop at 150 ms) plus a fixed 250 ms settle after each move.
+- One tight loop (1-5 ms) reading all three registers in a single batch
+  detects the end of motion within a few ms and removes handle contention.
+
+Design:
+- Each poll produces an immutable MotionSnapshot with a sequence number.
+- Waiters express "a snapshot taken after my command shows the axes stopped"
+  through the sequence number, which replaces the fixed settle sleep.
+- Notifications are throttled while moving, immediate on start/stop edges.
+"""
+
+import threading
+import time
+from dataclasses import dataclass
+from typing import Callable, Optional
+
+from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import (
+    ArcusPerformax4EXController,
+)
+
+
+@dataclass(frozen=True)
+class MotionSnapshot:
+    """One coherent read of the X/Y pulse positions and status registers."""
+    sequence: int
+    timestamp: float  # time.monotonic() at the end of the read
+    steps_x: int
+    steps_y: int
+    status_x: int
+    status_y: int
+
+    @property
+    def is_moving(self) -> bool:
+        mask = ArcusPerformax4EXController.MOVING_STATUS_MASK
+        return bool((self.status_x | self.status_y) & mask)
+
+
+class ArcusStatusPoller:
+    """
+    Background thread polling the controller status at a fixed short period.
+
+    Thread Safety:
+    - The latest snapshot is guarded by a Condition; notify_all on every poll.
+    - on_update is called from the poller thread.
+    """
+
+    DEFAULT_POLL_INTERVAL_S = 0.002
+    DEFAULT_PUBLISH_INTERVAL_S = 0.1
+    ERROR_BACKOFF_S = 0.5
+
+    # If the axes are stopped but not at target, wait this long for the
+    # status register to report the start of motion
+    START_GRACE_S = 0.1
+
+    def __init__(self, controller: ArcusPerformax4EXController,
+                 on_update: Optional[Callable[[MotionSnapshot], None]] = None,
+                 poll_interval_s: float = DEFAULT_POLL_INTERVAL_S,
+                 publish_interval_s: float = DEFAULT_PUBLISH_INTERVAL_S):
+        """
+        Args:
+            controller: Connected controller (must provide get_motion_snapshot).
+            on_update: Callback for throttled position/status notifications.
+            poll_interval_s: Target period between two reads (1-5 ms).
+            publish_interval_s: Minimum period between on_update calls while moving.
+        """
+        self._controller = controller
+        self._on_update = on_update
+        self._poll_interval_s = poll_interval_s
+        self._publish_interval_s = publish_interval_s
+
+        self._condition = threading.Condition()
+        self._snapshot: Optional[MotionSnapshot] = None
+        self._sequence = 0
+        self._running = False
+        self._thread: Optional[threading.Thread] = None
+
+        self._last_published: Optional[MotionSnapshot] = None
+        self._last_publish_time = 0.0
+
+    # ==========================================================================
+    # SETUP
+    # ==========================================================================
+
+    def start(self) -> None:
+        """Start the poller thread (no-op if already running)."""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._running = True
+        self._thread = threading.Thread(target=self._poll_loop, daemon=True, name="ArcusStatusPoller")
+        self._thread.start()
+
+    def stop(self) -> None:
+        """Stop the poller thread and release all waiters."""
+        self._running = False
+        with self._condition:
+            self._condition.notify_all()
+        if self._thread:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+
+    def is_running(self) -> bool:
+        return self._running and self._thread is not None and self._thread.is_alive()
+
+    # ==========================================================================
+    # POLL LOOP
+    # ==========================================================================
+
+    def _poll_loop(self) -> None:
+        while self._running:
+            start = time.monotonic()
+            try:
+                steps_x, steps_y, status_x, status_y = self._controller.get_motion_snapshot()
+            except Exception:
+                # Transient errors (disconnect, USB glitch): back off, keep running
+                time.sleep(self.ERROR_BACKOFF_S)
+                continue
+
+            with self._condition:
+                self._sequence += 1
+                snapshot = MotionSnapshot(
+                    sequence=self._sequence,
+                    timestamp=time.monotonic(),
+                    steps_x=int(steps_x),
+                    steps_y=int(steps_y),
+                    status_x=int(status_x),
+                    status_y=int(status_y),
+                )
+                self._snapshot = snapshot
+                self._condition.notify_all()
+
+            self._maybe_publish(snapshot)
+
+            remaining = self._poll_interval_s - (time.monotonic() - start)
+            if remaining > 0:
+                time.sleep(remaining)
+
+    def _maybe_publish(self, snapshot: MotionSnapshot) -> None:
+        if self._on_update is None:
+            return
+
+        last = self._last_published
+        if last is None or snapshot.is_moving != last.is_moving:
+            publish = True  # start/stop edge: always immediate
+        elif (snapshot.steps_x, snapshot.steps_y) == (last.steps_x, last.steps_y):
+            publish = False
+        else:
+            publish = snapshot.timestamp - self._last_publish_time >= self._publish_interval_s
+
+        if not publish:
+            return
+
+        self._last_published = snapshot
+        self._last_publish_time = snapshot.timestamp
+        try:
+            self._on_update(snapshot)
+        except Exception as e:
+            print(f"[ArcusStatusPoller] Update callback failed: {e}")
+
+    # ==========================================================================
+    # QUERIES
+    # ==========================================================================
+
+    @property
+    def sequence(self) -> int:
+        """Sequence number of the latest snapshot (0 before the first poll)."""
+        with self._condition:
+            return self._sequence
+
+    def latest(self) -> Optional[MotionSnapshot]:
+        """Latest snapshot, or None before the first poll."""
+        with self._condition:
+            return self._snapshot
+
+    def wait_for_stop(self, after_sequence: int, timeout: float,
+                      target_steps: Optional[tuple] = None,
+                      should_abort: Optional[Callable[[], bool]] = None) -> Optional[MotionSnapshot]:
+        """
+        Block until a snapshot taken after `after_sequence` shows the axes stopped.
+
+        A read can be in flight when the command is issued, so the first
+        snapshot considered is after_sequence + 2. When target_steps is given,
+        a stopped snapshot away from the target is only accepted after
+        START_GRACE_S (the motion may not have been latched yet).
+
+        Args:
+            after_sequence: Value of `sequence` read right after the command.
+            timeout: Maximum wait (seconds).
+            target_steps: Optional (steps_x, steps_y) commanded target.
+            should_abort: Optional predicate checked on each wakeup.
+
+        Returns:
+            The stopped snapshot, or None on timeout/abort/poller stop.
+        """
+        start = time.monotonic()
+        deadline = start + timeout
+        with self._condition:
+            while True:
+                snapshot = self._snapshot
+                if snapshot is not None and snapshot.sequence > after_sequence + 1 and not snapshot.is_moving:
+                    if target_steps is None or self._at_target(snapshot, target_steps):
+                        return snapshot
+                    if snapshot.timestamp - start >= self.START_GRACE_S:
+                        return snapshot
+
+                if not self._running or (should_abort is not None and should_abort()):
+                    return None
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    return None
+                self._condition.wait(timeout=min(remaining, 0.05))
+
+    @staticmethod
+    def _at_target(snapshot: MotionSnapshot, target_steps: tuple) -> bool:
+        target_x, target_y = target_steps
+        return abs(snapshot.steps_x - target_x) <= 1 and abs(snapshot.steps_y - target_y) <= 1
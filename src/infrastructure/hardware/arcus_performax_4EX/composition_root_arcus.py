@@ -17,11 +17,12 @@ from application.services.motion_control_service.i_motion_port import IMotionPor
 from application.services.system_lifecycle_service.i_hardware_initialization_port import IHardwareInitializationPort
 from application.services.hardware_configuration_service.i_hardware_advanced_configurator import IHardwareAdvancedConfigurator
 
-from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import ArcusPerformax4EXController
+from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import ArcusPerformax4EXController, AxisParams
 from infrastructure.hardware.arcus_performax_4EX.adapter_motion_port_arcus_performax4EX import ArcusAdapter
 from infrastructure.hardware.arcus_performax_4EX.adapter_lifecycle_arcus_performax4EX import ArcusPerformaxLifecycleAdapter
 from infrastructure.hardware.arcus_performax_4EX.arcus_advanced_configuration import ArcusPerformax4EXAdvancedConfigurator
 from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.value_objects.geometric.axis_motion_profile import AxisMotionProfile
 
 
 class ArcusCompositionRoot:
@@ -33,7 +34,8 @@ class ArcusCompositionRoot:
     - Adapters: ArcusAdapter, ArcusPerformaxLifecycleAdapter, ArcusPerformax4EXAdvancedConfigurator
     """
 
-    def __init__(self, port: Optional[str] = None, dll_path: Optional[str] = None, event_bus: Optional[IDomainEventBus] = None):
+    def __init__(self, port: Optional[str] = None, dll_path: Optional[str] = None, event_bus: Optional[IDomainEventBus] = None,
+                 backend: str = "auto", performax_lib=None):
         """
         Initialize the Arcus hardware stack.
 
@@ -41,6 +43,9 @@ class ArcusCompositionRoot:
             port: Serial port (e.g., 'COM3'). If None, auto-detect.
             dll_path: Path to Arcus DLL files. If None, use default.
             event_bus: Domain event bus for publishing motion events.
+            backend: Driver backend ("auto", "native" PerformaxCom.dll, or "pylablib").
+            performax_lib: Stand-in for PerformaxCom.dll (e.g. SimulatedPerformaxLib
+                for load tests without the bench).
         """
         # 1. Instantiate Driver (Private)
         # If dll_path is not provided, try to find it relative to this file
@@ -48,7 +53,7 @@ class ArcusCompositionRoot:
             # Assuming DLL64 is in the same directory as this file
             dll_path = str(Path(__file__).parent / "DLL64")
             
-        self._driver = ArcusPerformax4EXController(dll_path=dll_path)
+        self._driver = ArcusPerformax4EXController(dll_path=dll_path, backend=backend, lib=performax_lib)
         
         # 2. Instantiate Motion Adapter
         # We pass the event_bus to the adapter so it can publish events
@@ -65,3 +70,31 @@ class ArcusCompositionRoot:
             controller=self._driver,
             adapter=self.motion
         )
+
+    def axis_params(self, axis: str = "X") -> AxisParams:
+        """
+        Current HS/LS/ACC/DEC of an axis (used for fly-scan velocity planning).
+
+        Falls back to the driver defaults when the controller is not connected.
+        """
+        if self._driver.is_connected():
+            try:
+                return self._driver.get_axis_params(axis)
+            except Exception as e:
+                print(f"[ArcusCompositionRoot] Failed to read {axis} axis params, using defaults: {e}")
+        return ArcusPerformax4EXController.DEFAULT_PARAMS[axis.upper()]
+
+    def link_stats(self) -> Optional[dict]:
+        """PerformaxCom link counters (None when not on the native transport)."""
+        return self._driver.link_stats()
+
+    def motion_profile(self, axis: str = "X") -> AxisMotionProfile:
+        """Kinematics of an axis in mm/s (used for scan trajectory ordering)."""
+        params = self.axis_params(axis)
+        return AxisMotionProfile.from_step_parameters(
+            start_speed_hz=params.ls,
+            max_speed_hz=params.hs,
+            accel_ms=params.acc,
+            decel_ms=params.dec,
+            mm_per_step=ArcusAdapter.MM_PER_STEP,
+        )
@@ -3,11 +3,12 @@ Arcus Performax 4EX Controller - Infrastructure Layer
 
 Responsibility:
 - Low-level hardware communication with Arcus Performax 4EX motor controller
-- Direct interface to pylablib Arcus device
+- Direct interface to the Arcus device (native PerformaxCom.dll transport
+  or pylablib)
 - Hardware-specific operations (homing, position, speed)
 
 Rationale:
-- Encapsulates pylablib dependency
+- Encapsulates pylablib / PerformaxCom.dll dependency
 - Provides clean API for adapter layer
 - Handles hardware initialization and configuration
 
@@ -21,9 +22,14 @@ Design:
 import os
 import time
 import threading
-from typing import Optional, List, Dict
+from typing import Optional, List, Dict, Sequence, Tuple
 from dataclasses import dataclass
 
+from infrastructure.hardware.arcus_performax_4EX.performax_com_transport import (
+    PerformaxComStage,
+    PerformaxComTransport,
+)
+
 
 @dataclass
 class AxisParams:
@@ -37,7 +43,7 @@ class AxisParams:
 class ArcusPerformax4EXController:
     """
     Low-level controller for Arcus Performax 4EX motor controller.
-    Wraps pylablib Arcus device with clean API.
+    Wraps the Arcus stage (PerformaxComStage or pylablib) with clean API.
     
     Organization: QCS (Query-Command-Setup)
     - Setup: Connection, initialization
@@ -46,7 +52,17 @@ class ArcusPerformax4EXController:
     
     Thread Safety:
     - Uses RLock to protect access to the underlying _stage object.
+
+    Backends:
+    - "native": PerformaxComStage, direct calls to PerformaxCom.dll (USB only)
+    - "pylablib": pylablib Arcus.Performax4EXStage (USB or RS485 port)
+    - "auto": native for USB, falls back to pylablib if it cannot open
     """
+
+    BACKENDS = ("auto", "native", "pylablib")
+
+    # MST bits: accel | decel | moving
+    MOVING_STATUS_MASK = 0x007
     
     # Default parameters
     DEFAULT_PARAMS = {
@@ -58,15 +74,22 @@ class ArcusPerformax4EXController:
     # SETUP - Initialization & Configuration
     # ============================================================================
     
-    def __init__(self, dll_path: Optional[str] = None):
+    def __init__(self, dll_path: Optional[str] = None, backend: str = "auto", lib=None):
         """
         Initialize controller.
         
         Args:
             dll_path: Path to Arcus DLL folder. If None, auto-detect.
+            backend: "auto", "native" or "pylablib" (see class docstring).
+            lib: PerformaxCom.dll stand-in for the native transport
+                (tests, SimulatedPerformaxLib). If None, the DLL is loaded.
         """
+        if backend not in self.BACKENDS:
+            raise ValueError(f"Unknown Arcus backend '{backend}', expected one of {self.BACKENDS}")
         self._stage = None
         self._dll_path = dll_path
+        self._backend = backend
+        self._lib = lib
         self._axis_mapping = {"x": 0, "y": 1, "z": 2, "u": 3}
         self._is_homed = {"x": False, "y": False}
         self._lock = threading.RLock()
@@ -83,18 +106,7 @@ class ArcusPerformax4EXController:
         """
         with self._lock:
             try:
-                import pylablib as pll
-                from pylablib.devices import Arcus
-                
-                # Set DLL path if provided
-                if self._dll_path and os.path.isdir(self._dll_path):
-                    pll.par["devices/dlls/arcus_performax"] = self._dll_path
-                
-                # Connect to stage
-                if port:
-                    self._stage = Arcus.Performax4EXStage(conn=port)
-                else:
-                    self._stage = Arcus.Performax4EXStage()
+                self._stage = self._open_stage(port)
                 
                 # Enable axes
                 self._stage.enable_axis("x")
@@ -111,6 +123,34 @@ class ArcusPerformax4EXController:
                 print(f"[ArcusController] Connection failed: {e}")
                 return False
     
+    def _open_stage(self, port: Optional[str]):
+        """
+        Open the stage with the configured backend.
+
+        The native transport only drives the USB link, so an explicit
+        serial port always goes through pylablib.
+        """
+        if port is None and self._backend in ("auto", "native"):
+            try:
+                stage = PerformaxComStage(PerformaxComTransport(dll_path=self._dll_path, lib=self._lib))
+                print("[ArcusController] Connected through native PerformaxCom transport")
+                return stage
+            except Exception as e:
+                if self._backend == "native":
+                    raise
+                print(f"[ArcusController] Native transport unavailable ({e}), falling back to pylablib")
+
+        import pylablib as pll
+        from pylablib.devices import Arcus
+
+        # Set DLL path if provided
+        if self._dll_path and os.path.isdir(self._dll_path):
+            pll.par["devices/dlls/arcus_performax"] = self._dll_path
+
+        if port:
+            return Arcus.Performax4EXStage(conn=port)
+        return Arcus.Performax4EXStage()
+
     def disconnect(self) -> None:
         """Close connection to controller."""
         with self._lock:
@@ -124,9 +164,20 @@ class ArcusPerformax4EXController:
 
         Simplified: we only apply the default high speed (HS) on all axes,
         and leave LS/ACC/DEC to their controller defaults for now.
+
+        The device keeps HS across reconnections: it is read first and only
+        written (with the 100 ms settle delay) when it differs.
         """
         default_hs = self.DEFAULT_PARAMS["X"].hs
-        self.set_speed(default_hs)
+        axes = ["x", "y"]
+        try:
+            current_hs = [int(reply) for reply in self.query_many([f"HS{axis.upper()}" for axis in axes])]
+        except Exception as e:
+            print(f"[ArcusController] Could not read current HS ({e}), writing defaults")
+            current_hs = [None] * len(axes)
+        for axis, hs in zip(axes, current_hs):
+            if hs != default_hs:
+                self.set_axis_params(axis, hs=default_hs)
     
     def _initialize_homing_status(self) -> None:
         """Initialize homing status from hardware limit switches."""
@@ -192,12 +243,10 @@ class ArcusPerformax4EXController:
                 raise RuntimeError("Not connected")
                 
             axis_upper = axis.upper()
-            return {
-                "ls": int(self._stage.query(f"LS{axis_upper}")),
-                "hs": int(self._stage.query(f"HS{axis_upper}")),
-                "acc": int(self._stage.query(f"ACC{axis_upper}")),
-                "dec": int(self._stage.query(f"DEC{axis_upper}"))
-            }
+            ls, hs, acc, dec = self.query_many(
+                [f"LS{axis_upper}", f"HS{axis_upper}", f"ACC{axis_upper}", f"DEC{axis_upper}"]
+            )
+            return {"ls": int(ls), "hs": int(hs), "acc": int(acc), "dec": int(dec)}
 
     def set_speed(self, hs: int, axis: Optional[str] = None) -> None:
         """Legacy compatibility wrapper for set_axis_params."""
@@ -309,6 +358,27 @@ class ArcusPerformax4EXController:
             
             self._stage.move_to(axis_lower, position)
     
+    def move_to_xy(self, steps_x: float, steps_y: float) -> None:
+        """
+        Start X and Y absolute moves in a single command batch.
+
+        Args:
+            steps_x: Target X position (steps)
+            steps_y: Target Y position (steps)
+
+        Raises:
+            RuntimeError: If not homed or not connected
+        """
+        with self._lock:
+            if not self._stage:
+                raise RuntimeError("Not connected")
+
+            for axis in ("x", "y"):
+                if not self._is_homed[axis]:
+                    raise RuntimeError(f"Axis {axis.upper()} must be homed before movement")
+
+            self.query_many([f"X{steps_x:.0f}", f"Y{steps_y:.0f}"])
+
     def move_by(self, axis: str, displacement: float) -> None:
         """
         Move axis by relative displacement.
@@ -374,6 +444,28 @@ class ArcusPerformax4EXController:
     # ============================================================================
     # QUERIES - Read-only operations
     # ============================================================================
+
+    def query_many(self, commands: Sequence[str]) -> List[str]:
+        """
+        Send several raw commands and return their replies in order.
+
+        With the native backend the whole batch is a single transport call
+        (one lock acquisition, reused buffers). With pylablib it degrades to
+        sequential queries.
+
+        Args:
+            commands: Raw Arcus ASCII commands (e.g. ["PX", "PY", "MST"])
+
+        Returns:
+            List of replies, same order as commands
+        """
+        with self._lock:
+            if not self._stage:
+                raise RuntimeError("Not connected")
+
+            if hasattr(self._stage, "send_recv_many"):
+                return self._stage.send_recv_many(commands)
+            return [self._stage.query(command) for command in commands]
     
     def is_connected(self) -> bool:
         """Check if controller is connected."""
@@ -384,6 +476,13 @@ class ArcusPerformax4EXController:
                 return self._stage.is_opened()
             except:
                 return False
+
+    def link_stats(self) -> Optional[Dict[str, int]]:
+        """PerformaxCom round trips / errors (None with the pylablib backend or when closed)."""
+        stage = self._stage
+        if not isinstance(stage, PerformaxComStage):
+            return None
+        return {"round_trips": stage.transport.round_trips, "errors": stage.transport.errors}
     
     def is_homed(self, axis: str) -> bool:
         """
@@ -435,6 +534,17 @@ class ArcusPerformax4EXController:
             
             return self._stage.get_position(axis.lower())
     
+    def get_motion_snapshot(self) -> Tuple[int, int, int, int]:
+        """
+        Read X/Y pulse positions and status registers in one batch.
+
+        Returns:
+            (steps_x, steps_y, status_x, status_y)
+        """
+        px, py, mst = self.query_many(["PX", "PY", "MST"])
+        statuses = [int(s) for s in mst.split(":") if s]
+        return int(px), int(py), statuses[0], statuses[1]
+
     def get_axis_params(self, axis: str) -> AxisParams:
         """
         Get current axis parameters.
@@ -449,14 +559,8 @@ class ArcusPerformax4EXController:
             if not self._stage:
                 raise RuntimeError("Not connected")
             
-            axis_upper = axis.upper()
-            
-            ls = int(self._stage.query(f"LS{axis_upper}"))
-            hs = int(self._stage.query(f"HS{axis_upper}"))
-            acc = int(self._stage.query(f"ACC{axis_upper}"))
-            dec = int(self._stage.query(f"DEC{axis_upper}"))
-            
-            return AxisParams(ls=ls, hs=hs, acc=acc, dec=dec)
+            params = self.get_axis_params_dict(axis)
+            return AxisParams(**params)
     
     def get_status(self, axis: str) -> List[str]:
         """
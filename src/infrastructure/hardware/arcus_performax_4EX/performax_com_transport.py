@@ -0,0 +1,372 @@
+"""
+Performax Com Transport - Infrastructure Layer
+
+Responsibility:
+- Direct binding to PerformaxCom.dll (see DLL64/PerformaxCom.h)
+- Own the device handle and the preallocated send/recv buffers
+- Provide batched command round trips (send_recv_many)
+
+Rationale:
+- pylablib goes through its generic ctypes wrapper, adds a 10 ms cooldown
+  before every query and is serialized again by the controller RLock.
+- Scans issue several PX/PY/MST/HS queries per grid point: batching them
+  under a single lock acquisition with reused buffers removes most of the
+  per-query overhead.
+
+Design:
+- PerformaxComTransport: thin, thread-safe wrapper over the 4 DLL entry
+  points used by the stage (Open/Close, SetTimeouts, Flush, SendRecv).
+- PerformaxComStage: subset of pylablib's Performax4EXStage API used by
+  ArcusPerformax4EXController, implemented on top of the transport so the
+  controller can swap backends without changing its own code.
+- The DLL object can be injected (lib=...) for tests without hardware.
+- Each fnPerformaxComSendRecv call is a "performax/send_recv" span of the
+  hot-path tracer; round trips and failures are counted for the
+  performance counters.
+"""
+
+import ctypes
+import os
+import sys
+import threading
+import time
+from typing import List, Optional, Sequence
+
+from infrastructure.instrumentation.hot_path_tracer import TRACER
+
+
+class PerformaxComError(RuntimeError):
+    """Raised when a PerformaxCom.dll call fails or the device replies with '?'."""
+
+
+class PerformaxComTransport:
+    """
+    Owns a PerformaxCom.dll handle and performs command/reply round trips.
+
+    Thread Safety:
+    - A single Lock serializes access to the handle and the shared buffers.
+    - send_recv_many() takes the lock once for the whole batch.
+    """
+
+    DLL_NAME = "PerformaxCom.dll"
+
+    # The 4EX USB protocol exchanges fixed 64-byte packets
+    BUFFER_SIZE = 64
+
+    DEFAULT_READ_TIMEOUT_MS = 1000
+    DEFAULT_WRITE_TIMEOUT_MS = 1000
+
+    OPEN_RETRIES = 5
+    OPEN_RETRY_DELAY_S = 0.3
+
+    # ============================================================================
+    # SETUP - Initialization & Configuration
+    # ============================================================================
+
+    def __init__(self, dll_path: Optional[str] = None, device_index: int = 0,
+                 read_timeout_ms: int = DEFAULT_READ_TIMEOUT_MS,
+                 write_timeout_ms: int = DEFAULT_WRITE_TIMEOUT_MS,
+                 lib=None):
+        """
+        Initialize transport (does not open the device).
+
+        Args:
+            dll_path: Folder containing PerformaxCom.dll (and SiUSBXp.dll).
+            device_index: USB device index (0 for the first controller).
+            read_timeout_ms: DLL read timeout.
+            write_timeout_ms: DLL write timeout.
+            lib: Pre-loaded DLL object (tests). If None, loaded on open().
+        """
+        self._dll_path = dll_path
+        self._device_index = device_index
+        self._read_timeout_ms = read_timeout_ms
+        self._write_timeout_ms = write_timeout_ms
+        self._lib = lib
+        self._handle = ctypes.c_void_p()
+        self._opened = False
+        self._lock = threading.Lock()
+
+        # Preallocated buffers, reused by every round trip
+        self._send_buffer = ctypes.create_string_buffer(self.BUFFER_SIZE)
+        self._recv_buffer = ctypes.create_string_buffer(self.BUFFER_SIZE)
+
+        # Cumulative counters (read by PerformanceCounters)
+        self.round_trips = 0
+        self.errors = 0  # DLL failures (USB timeouts) and '?' replies
+
+    def _load_library(self):
+        """Load PerformaxCom.dll and declare the prototypes from PerformaxCom.h."""
+        if sys.platform != "win32":
+            raise PerformaxComError("PerformaxCom.dll is only available on Windows")
+
+        if self._dll_path and os.path.isdir(self._dll_path):
+            # SiUSBXp.dll is resolved from the same folder
+            if hasattr(os, "add_dll_directory"):
+                os.add_dll_directory(self._dll_path)
+            dll_file = os.path.join(self._dll_path, self.DLL_NAME)
+        else:
+            dll_file = self.DLL_NAME
+
+        try:
+            lib = ctypes.WinDLL(dll_file)
+        except OSError as e:
+            raise PerformaxComError(f"Cannot load {dll_file}: {e}")
+
+        from ctypes import wintypes
+
+        lib.fnPerformaxComGetNumDevices.argtypes = [ctypes.POINTER(wintypes.DWORD)]
+        lib.fnPerformaxComGetNumDevices.restype = wintypes.BOOL
+        lib.fnPerformaxComOpen.argtypes = [wintypes.DWORD, ctypes.POINTER(ctypes.c_void_p)]
+        lib.fnPerformaxComOpen.restype = wintypes.BOOL
+        lib.fnPerformaxComClose.argtypes = [ctypes.c_void_p]
+        lib.fnPerformaxComClose.restype = wintypes.BOOL
+        lib.fnPerformaxComSetTimeouts.argtypes = [wintypes.DWORD, wintypes.DWORD]
+        lib.fnPerformaxComSetTimeouts.restype = wintypes.BOOL
+        lib.fnPerformaxComFlush.argtypes = [ctypes.c_void_p]
+        lib.fnPerformaxComFlush.restype = wintypes.BOOL
+        lib.fnPerformaxComSendRecv.argtypes = [
+            ctypes.c_void_p, ctypes.c_void_p, wintypes.DWORD, wintypes.DWORD, ctypes.c_void_p
+        ]
+        lib.fnPerformaxComSendRecv.restype = wintypes.BOOL
+        return lib
+
+    def open(self) -> None:
+        """
+        Open the device and flush its buffers.
+
+        Raises:
+            PerformaxComError: If the DLL cannot be loaded or the device does not open.
+        """
+        with self._lock:
+            if self._opened:
+                return
+            if self._lib is None:
+                self._lib = self._load_library()
+
+            # Enumerating devices is required by the DLL before the first Open
+            num_devices = ctypes.c_ulong(0)
+            self._lib.fnPerformaxComGetNumDevices(ctypes.byref(num_devices))
+
+            if not self._lib.fnPerformaxComSetTimeouts(self._read_timeout_ms, self._write_timeout_ms):
+                raise PerformaxComError("fnPerformaxComSetTimeouts failed")
+
+            for _ in range(self.OPEN_RETRIES):
+                if self._lib.fnPerformaxComOpen(self._device_index, ctypes.byref(self._handle)):
+                    self._lib.fnPerformaxComFlush(self._handle)
+                    self._opened = True
+                    return
+                time.sleep(self.OPEN_RETRY_DELAY_S)
+
+            raise PerformaxComError(f"Cannot open Performax device {self._device_index}")
+
+    def close(self) -> None:
+        """Close the device handle (no-op if not opened)."""
+        with self._lock:
+            if not self._opened:
+                return
+            self._lib.fnPerformaxComClose(self._handle)
+            self._handle = ctypes.c_void_p()
+            self._opened = False
+
+    def set_timeouts(self, read_timeout_ms: int, write_timeout_ms: int) -> None:
+        """Update DLL read/write timeouts (global to the DLL)."""
+        with self._lock:
+            self._read_timeout_ms = read_timeout_ms
+            self._write_timeout_ms = write_timeout_ms
+            if self._lib is not None and not self._lib.fnPerformaxComSetTimeouts(read_timeout_ms, write_timeout_ms):
+                raise PerformaxComError("fnPerformaxComSetTimeouts failed")
+
+    def flush(self) -> None:
+        """Flush pending device I/O."""
+        with self._lock:
+            self._check_opened()
+            if not self._lib.fnPerformaxComFlush(self._handle):
+                raise PerformaxComError("fnPerformaxComFlush failed")
+
+    # ============================================================================
+    # COMMANDS - Round trips
+    # ============================================================================
+
+    def send_recv(self, command: str) -> str:
+        """
+        Send one ASCII command and return the reply.
+
+        Raises:
+            PerformaxComError: On DLL failure or device error reply ('?...').
+        """
+        with self._lock:
+            self._check_opened()
+            return self._send_recv_locked(command)
+
+    def send_recv_many(self, commands: Sequence[str]) -> List[str]:
+        """
+        Send a batch of commands back to back under a single lock acquisition.
+
+        Args:
+            commands: ASCII commands (e.g. ["PX", "PY", "MST"]).
+
+        Returns:
+            Replies in the same order as the commands.
+        """
+        with self._lock:
+            self._check_opened()
+            return [self._send_recv_locked(command) for command in commands]
+
+    def _send_recv_locked(self, command: str) -> str:
+        """Single round trip. Caller must hold self._lock."""
+        payload = command.encode("ascii")
+        if len(payload) >= self.BUFFER_SIZE:
+            raise PerformaxComError(f"Command too long ({len(payload)} bytes): {command}")
+
+        ctypes.memset(self._send_buffer, 0, self.BUFFER_SIZE)
+        ctypes.memmove(self._send_buffer, payload, len(payload))
+        self._recv_buffer[0] = b"\x00"
+
+        t0 = TRACER.start()
+        ok = self._lib.fnPerformaxComSendRecv(
+            self._handle, self._send_buffer, self.BUFFER_SIZE, self.BUFFER_SIZE, self._recv_buffer
+        )
+        TRACER.end("performax", "send_recv", t0)
+        self.round_trips += 1
+        if not ok:
+            self.errors += 1
+            raise PerformaxComError(f"fnPerformaxComSendRecv failed for '{command}'")
+
+        reply = self._recv_buffer.value.decode("ascii", errors="replace")
+        if reply.startswith("?"):
+            self.errors += 1
+            raise PerformaxComError(f"Device returned error for '{command}': {reply[1:]}")
+        return reply
+
+    # ============================================================================
+    # QUERIES
+    # ============================================================================
+
+    def is_opened(self) -> bool:
+        """Check if the device handle is open."""
+        return self._opened
+
+    def _check_opened(self) -> None:
+        if not self._opened:
+            raise PerformaxComError("Performax device is not opened")
+
+
+class PerformaxComStage:
+    """
+    Performax 4EX stage on top of PerformaxComTransport.
+
+    Mirrors the subset of pylablib's Arcus.Performax4EXStage used by
+    ArcusPerformax4EXController (same method names and semantics), so the
+    controller keeps a single code path for both backends.
+    """
+
+    AXES = ["X", "Y", "Z", "U"]
+
+    STATUS_BITS = {
+        "accel": 0x001, "decel": 0x002, "moving": 0x004,
+        "alarm": 0x008,
+        "sw_plus_lim": 0x010, "sw_minus_lim": 0x020, "sw_home": 0x040,
+        "err_plus_lim": 0x080, "err_minus_lim": 0x100, "err_alarm": 0x200,
+        "TOC_timeout": 0x800,
+    }
+    MOVING_MASK = 0x007
+
+    HOME_MODES = {
+        "only_home_input": 0, "only_limit_input": 1, "home_and_zidx_input": 2,
+        "only_zidx_input": 3, "only_home_input_lowspeed": 4,
+    }
+
+    WAIT_MOVE_PERIOD_S = 0.05
+
+    def __init__(self, transport: PerformaxComTransport):
+        """
+        Open the transport and put the controller in the same state as pylablib does.
+
+        Args:
+            transport: Unopened or opened transport. Ownership is taken.
+        """
+        self._transport = transport
+        self._transport.open()
+        try:
+            self._transport.send_recv_many(["ABS", "IERR=1"] + [f"CLR{a}" for a in self.AXES])
+        except Exception:
+            self._transport.close()
+            raise
+
+    @property
+    def transport(self) -> PerformaxComTransport:
+        return self._transport
+
+    def _axis(self, axis: str) -> str:
+        axis_upper = axis.upper()
+        if axis_upper not in self.AXES:
+            raise ValueError(f"Unknown axis: {axis}")
+        return axis_upper
+
+    def _axisn(self, axis: str) -> int:
+        return self.AXES.index(self._axis(axis)) + 1
+
+    # --- Connection ---
+
+    def close(self) -> None:
+        self._transport.close()
+
+    def is_opened(self) -> bool:
+        return self._transport.is_opened()
+
+    # --- Raw access ---
+
+    def query(self, command: str) -> str:
+        return self._transport.send_recv(command)
+
+    def send_recv_many(self, commands: Sequence[str]) -> List[str]:
+        return self._transport.send_recv_many(commands)
+
+    # --- Commands ---
+
+    def enable_axis(self, axis: str = "all", enable: bool = True) -> None:
+        axes = self.AXES if axis == "all" else [self._axis(axis)]
+        self._transport.send_recv_many(
+            [f"EO{self._axisn(a)}={1 if enable else 0}" for a in axes]
+        )
+
+    def move_to(self, axis: str, position: float) -> None:
+        self.query(f"{self._axis(axis)}{position:.0f}")
+
+    def move_by(self, axis: str, steps: float = 1) -> None:
+        self.move_to(axis, self.get_position(axis) + steps)
+
+    def home(self, axis: str, direction: str, home_mode: str) -> None:
+        self.query(f"H{self._axis(axis)}{direction}{self.HOME_MODES[home_mode]}")
+
+    def set_position_reference(self, axis: str, position: float = 0) -> None:
+        self.query(f"P{self._axis(axis)}={position:.0f}")
+
+    def wait_move(self, axis: str, timeout: Optional[float] = None) -> None:
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while self.is_moving(axis):
+            if deadline is not None and time.monotonic() > deadline:
+                raise PerformaxComError(f"Waiting for motion on axis {axis} timed out")
+            time.sleep(self.WAIT_MOVE_PERIOD_S)
+
+    # --- Queries ---
+
+    def get_position(self, axis: str) -> int:
+        return int(self.query(f"P{self._axis(axis)}"))
+
+    def get_status_n(self, axis: str = "all"):
+        """Status register as int (one axis) or list of ints (all axes, single MST query)."""
+        statuses = [int(x) for x in self.query("MST").split(":") if x]
+        if axis == "all":
+            return statuses
+        return statuses[self._axisn(axis) - 1]
+
+    def get_status(self, axis: str) -> List[str]:
+        status = self.get_status_n(axis)
+        return [name for name, bit in self.STATUS_BITS.items() if bit & status]
+
+    def is_moving(self, axis: str = "all"):
+        status = self.get_status_n(axis)
+        if axis == "all":
+            return [bool(s & self.MOVING_MASK) for s in status]
+        return bool(status & self.MOVING_MASK)
@@ -1,45 +1,208 @@
-from typing import List, Dict, Any
+"""
+Composite Hardware Initialization Port - Infrastructure Layer
+
+Responsibility:
+- Aggregate several IHardwareInitializationPort (Arcus, MCU, ...) into one.
+- Bring independent subsystems up concurrently, respecting declared dependencies.
+- Report the merged resources and the duration of each subsystem.
+
+Rationale:
+- Subsystems used to be initialized one after another: cold start time was
+  the sum of the Arcus connection (axis enable, speed parameters, homing
+  probe) and the MCU one, although they share no link.
+
+Design:
+- Each subsystem has a name (default "subsystem_{i}", also the prefix of its
+  resource keys) and optional dependencies on other names.
+- A subsystem starts on a worker thread as soon as its dependencies are
+  initialized; a failed subsystem cancels its dependents, independent
+  subsystems still complete, then the first failure is raised.
+- verify_all runs every verification concurrently; close_all stays
+  sequential, in reverse order.
+- Timings of the last run are exposed by `timings` and returned under the
+  TIMINGS_KEY resource.
+"""
+
+import time
+from concurrent.futures import FIRST_COMPLETED, Future, ThreadPoolExecutor, wait
+from dataclasses import dataclass
+from typing import Any, Callable, Dict, List, Mapping, Optional, Sequence, Tuple
+
 from application.services.system_lifecycle_service.i_hardware_initialization_port import IHardwareInitializationPort
 
+
+@dataclass(frozen=True)
+class SubsystemTiming:
+    """Duration of one lifecycle phase of one subsystem."""
+    name: str
+    phase: str  # "initialize" | "verify"
+    duration_s: float
+    error: Optional[str] = None
+
+
 class CompositeHardwareInitializationPort(IHardwareInitializationPort):
     """
     Aggregates multiple hardware initialization ports into one.
     Useful for initializing multiple subsystems (Arcus, MCU, etc.) via a single service call.
     """
-    
-    def __init__(self, initializers: List[IHardwareInitializationPort]):
-        self._initializers = initializers
+
+    TIMINGS_KEY = "initialization_timing_s"
+
+    def __init__(
+        self,
+        initializers: List[IHardwareInitializationPort],
+        names: Optional[Sequence[str]] = None,
+        depends_on: Optional[Mapping[str, Sequence[str]]] = None,
+        max_workers: Optional[int] = None,
+    ):
+        """
+        Args:
+            initializers: Subsystem lifecycle ports.
+            names: One name per initializer (default "subsystem_{i}").
+            depends_on: {name: names that must be initialized first}.
+            max_workers: Worker threads (default: one per subsystem).
+
+        Raises:
+            ValueError: On duplicate/unknown names or dependency cycles.
+        """
+        self._initializers = list(initializers)
+        self._names = list(names) if names is not None else [f"subsystem_{i}" for i in range(len(self._initializers))]
+        if len(self._names) != len(self._initializers) or len(set(self._names)) != len(self._names):
+            raise ValueError("names must be unique, one per initializer")
+        self._depends_on: Dict[str, Tuple[str, ...]] = {name: () for name in self._names}
+        for name, deps in (depends_on or {}).items():
+            unknown = [n for n in (name, *deps) if n not in self._depends_on]
+            if unknown:
+                raise ValueError(f"Unknown subsystem(s) in dependencies: {unknown}")
+            self._depends_on[name] = tuple(deps)
+        self._check_acyclic()
+        self._max_workers = max_workers or max(1, len(self._initializers))
+        self._timings: Tuple[SubsystemTiming, ...] = ()
+
+    @property
+    def timings(self) -> Tuple[SubsystemTiming, ...]:
+        """Per-subsystem timings of the last initialize_all / verify_all."""
+        return self._timings
 
     def initialize_all(self) -> Dict[str, Any]:
         """
         Initialize all subsystems and aggregate their resources.
-        
+
         Returns:
-            Combined dict of all initialized resources.
+            Combined dict of all initialized resources, plus TIMINGS_KEY:
+            {name: seconds}.
+
+        Raises:
+            Exception: The first subsystem failure, once the others are done.
         """
-        all_resources = {}
-        for i, initializer in enumerate(self._initializers):
-            resources = initializer.initialize_all()
-            # Merge resources with prefix to avoid collisions
-            prefix = f"subsystem_{i}"
-            for key, value in resources.items():
-                all_resources[f"{prefix}_{key}"] = value
+        started = time.perf_counter()
+        results = self._run_phase("initialize", lambda initializer: initializer.initialize_all(), self._depends_on)
+        total_s = time.perf_counter() - started
+
+        all_resources: Dict[str, Any] = {}
+        # Merge resources with prefix to avoid collisions (declaration order)
+        for name in self._names:
+            for key, value in results[name].items():
+                all_resources[f"{name}_{key}"] = value
+        all_resources[self.TIMINGS_KEY] = {t.name: t.duration_s for t in self._timings}
+
+        summary = ", ".join(f"{t.name}={t.duration_s:.2f}s" for t in self._timings)
+        print(f"[CompositeHardwareInit] Initialized {len(self._names)} subsystem(s) in {total_s:.2f}s ({summary})")
         return all_resources
 
     def verify_all(self) -> bool:
         """
         Verify all subsystems.
-        
+
         Returns:
             True if all verifications succeed.
         """
-        for initializer in self._initializers:
-            if not initializer.verify_all():
-                return False
-        return True
+        independent = {name: () for name in self._names}
+        results = self._run_phase("verify", lambda initializer: initializer.verify_all(), independent)
+        return all(results[name] for name in self._names)
 
     def close_all(self) -> None:
         # Closing in reverse order is often safer (LIFO), but standard iteration is fine if independent.
         # We'll stick to order for now, or could do reversed(self._initializers).
         for initializer in reversed(self._initializers):
             initializer.close_all()
+
+    # ------------------------------------------------------------------ #
+    # Scheduling
+    # ------------------------------------------------------------------ #
+
+    def _run_phase(
+        self,
+        phase: str,
+        action: Callable[[IHardwareInitializationPort], Any],
+        depends_on: Mapping[str, Sequence[str]],
+    ) -> Dict[str, Any]:
+        """Run `action` on every subsystem once its dependencies succeeded."""
+        initializers = dict(zip(self._names, self._initializers))
+        timings: Dict[str, SubsystemTiming] = {}
+        results: Dict[str, Any] = {}
+        failures: List[BaseException] = []
+        failed = set()
+
+        def timed(name: str):
+            start = time.perf_counter()
+            try:
+                return action(initializers[name])
+            finally:
+                timings[name] = SubsystemTiming(name, phase, time.perf_counter() - start)
+
+        pending = list(self._names)
+        if len(pending) == 1:
+            # Nothing to overlap: stay on the caller's thread
+            try:
+                results[pending[0]] = timed(pending[0])
+            finally:
+                self._timings = tuple(timings.values())
+            return results
+
+        running: Dict[Future, str] = {}
+        with ThreadPoolExecutor(max_workers=self._max_workers, thread_name_prefix=f"HardwareInit-{phase}") as pool:
+            while pending or running:
+                for name in list(pending):
+                    deps = depends_on[name]
+                    if any(dep in failed for dep in deps):
+                        pending.remove(name)
+                        failed.add(name)
+                        timings[name] = SubsystemTiming(name, phase, 0.0, error="skipped: dependency failed")
+                    elif all(dep in results for dep in deps):
+                        pending.remove(name)
+                        running[pool.submit(timed, name)] = name
+                if not running:
+                    break
+                done, _ = wait(running, return_when=FIRST_COMPLETED)
+                for future in done:
+                    name = running.pop(future)
+                    try:
+                        results[name] = future.result()
+                    except Exception as e:
+                        print(f"[CompositeHardwareInit] {phase} of '{name}' failed: {e}")
+                        failures.append(e)
+                        failed.add(name)
+                        timings[name] = SubsystemTiming(name, phase, timings[name].duration_s, error=str(e))
+
+        self._timings = tuple(timings[name] for name in self._names if name in timings)
+        if failures:
+            raise failures[0]
+        return results
+
+    def _check_acyclic(self) -> None:
+        visiting, done = set(), set()
+
+        def visit(name: str) -> None:
+            if name in done:
+                return
+            if name in visiting:
+                raise ValueError(f"Dependency cycle involving '{name}'")
+            visiting.add(name)
+            for dep in self._depends_on[name]:
+                visit(dep)
+            visiting.discard(name)
+            done.add(name)
+
+        for name in self._names:
+            visit(name)
@@ -1,11 +1,33 @@
 import serial
 import threading
 import time
+from typing import Callable, Optional, Sequence
+
+from infrastructure.hardware.micro_controller.mcu_register_protocol import (
+    RegisterWrite,
+    RegisterWriteResult,
+    encode_register_batch,
+    iter_batches,
+    parse_ack,
+)
+
+from infrastructure.instrumentation.hot_path_tracer import TRACER
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import (
+    FRAME_SIZE,
+    STREAM_START_COMMAND,
+    STREAM_STOP_COMMAND,
+    StreamBlock,
+    StreamDeframer,
+)
 
 class MCU_SerialCommunicator:
     _instance = None
     _lock = threading.Lock()
 
+    # Streaming mode: bytes requested per read (~256 frames) and read timeout
+    STREAM_READ_CHUNK = FRAME_SIZE * 256
+    STREAM_READ_TIMEOUT_S = 0.02
+
     def __new__(cls):
         if cls._instance is None:
             with cls._lock:
@@ -15,6 +37,19 @@ class MCU_SerialCommunicator:
                     cls._instance.port = None
                     cls._instance.baudrate = 9600
                     cls._instance.lock = threading.Lock()
+                    cls._instance._stream_thread = None
+                    # MCU switched to streaming (until x*) / reader thread alive
+                    cls._instance._stream_requested = False
+                    cls._instance._streaming = False
+                    cls._instance._deframer = None
+                    # Framed register batches need MCU firmware support
+                    cls._instance.register_batch_enabled = False
+                    # serial.Serial-like constructor (None: pyserial), e.g. SimulatedMcuSerial
+                    cls._instance.serial_factory = None
+                    # Cumulative counters (read by PerformanceCounters)
+                    cls._instance.exchanges = 0
+                    cls._instance.timeouts = 0  # Empty response line (read timeout)
+                    cls._instance.errors = 0  # Exceptions during an exchange
         return cls._instance
 
     def connect(self, port, baudrate=9600):
@@ -29,6 +64,11 @@ class MCU_SerialCommunicator:
             self.port = port
             self.baudrate = baudrate
             try:
+                if self.serial_factory is not None:
+                    self.ser = self.serial_factory(
+                        port=self.port, baudrate=self.baudrate, timeout=1, write_timeout=1
+                    )
+                    return True
                 self.ser = serial.Serial(
                     port=self.port,
                     baudrate=self.baudrate,
@@ -45,6 +85,7 @@ class MCU_SerialCommunicator:
 
     def disconnect(self):
         """Close serial connection."""
+        self.stop_stream()
         with self.lock:
             if self.ser and self.ser.is_open:
                 self.ser.close()
@@ -53,27 +94,195 @@ class MCU_SerialCommunicator:
         """Send command and return response."""
         if not self.ser or not self.ser.is_open:
             return False, "Not connected"
+        if not self._leave_dead_stream():
+            return False, "Streaming active"
 
         with self.lock:
             try:
-                if not command.endswith('*'):
-                    command += '*'
-                
-                self.ser.write(command.encode())
-                
-                # Special handling for acquisition command 'm'
-                if command.startswith('m') and command[1:].replace('*', '').isdigit():
-                    confirmation = self.ser.readline() # Read confirmation
-                    
-                    data_response = self.ser.readline() # Read data
-                    
-                    response_str = data_response.decode('ascii', errors='ignore').rstrip('\r\n')
-                    return True, response_str
-                else:
-                    response = self.ser.readline()
-                    
-                    response_str = response.decode('ascii', errors='ignore').rstrip('\r\n')
-                    return True, response_str
+                return True, self._exchange(command)
             except Exception as e:
+                self.errors += 1
                 print(f"[MCU_Serial] Error: {e}")
                 return False, str(e)
+
+    def _exchange(self, command: str) -> str:
+        """Write one ASCII command and read its response line (caller holds self.lock)."""
+        if not command.endswith('*'):
+            command += '*'
+
+        t0 = TRACER.start()
+        try:
+            self.ser.write(command.encode())
+
+            # Special handling for acquisition command 'm'
+            if command.startswith('m') and command[1:].replace('*', '').isdigit():
+                self.ser.readline()  # Read confirmation
+
+            response = self.ser.readline()
+        finally:
+            TRACER.end("mcu", "exchange", t0)
+        self.exchanges += 1
+        if not response:
+            self.timeouts += 1
+        return response.decode('ascii', errors='ignore').rstrip('\r\n')
+
+    # ------------------------------------------------------------------
+    # Register transactions
+    # ------------------------------------------------------------------
+
+    def write_registers(self, writes: Sequence[RegisterWrite]) -> RegisterWriteResult:
+        """
+        Write (address, value) register pairs in order, holding the link once.
+
+        With register_batch_enabled, registers go out as framed batches (one
+        write and one acknowledgement per MAX_BATCH_REGISTERS); otherwise as
+        'a{addr}' / 'd{value}' command pairs.
+        """
+        writes = tuple(writes)
+        if not writes:
+            return RegisterWriteResult()
+        if not self.ser or not self.ser.is_open:
+            return RegisterWriteResult(failed=writes, error="Not connected")
+        if not self._leave_dead_stream():
+            return RegisterWriteResult(failed=writes, error="Streaming active")
+
+        with self.lock:
+            if self.register_batch_enabled:
+                return self._write_register_batches(writes)
+            return self._write_register_pairs(writes)
+
+    def _write_register_pairs(self, writes: Sequence[RegisterWrite]) -> RegisterWriteResult:
+        for i, (address, value) in enumerate(writes):
+            try:
+                self._exchange(f"a{address}")
+                self._exchange(f"d{value}")
+            except Exception as e:
+                self.errors += 1
+                print(f"[MCU_Serial] Register write error (a{address} d{value}): {e}")
+                return RegisterWriteResult(written=writes[:i], failed=writes[i:], error=str(e))
+        return RegisterWriteResult(written=writes)
+
+    def _write_register_batches(self, writes: Sequence[RegisterWrite]) -> RegisterWriteResult:
+        written, failed, error = [], [], None
+        for batch in iter_batches(writes):
+            try:
+                self.ser.write(encode_register_batch(batch))
+                line = self.ser.readline().decode('ascii', errors='ignore')
+                status = parse_ack(line, len(batch))
+            except Exception as e:
+                self.errors += 1
+                print(f"[MCU_Serial] Register batch error: {e}")
+                failed.extend(batch)
+                error = str(e)
+                continue
+            for write, ok in zip(batch, status):
+                (written if ok else failed).append(write)
+        if failed and error is None:
+            error = "Registers rejected: " + ", ".join(f"a{a}" for a, _ in failed)
+        return RegisterWriteResult(written=tuple(written), failed=tuple(failed), error=error)
+
+    # ------------------------------------------------------------------
+    # Binary streaming mode
+    # ------------------------------------------------------------------
+
+    def start_stream(self, n_avg: int, on_block: Callable[[StreamBlock], None]) -> bool:
+        """
+        Switch the MCU to binary streaming and start the reader thread.
+
+        While streaming, the MCU pushes frames continuously and
+        send_command() is refused. on_block is called from the reader thread.
+        """
+        if not self.ser or not self.ser.is_open:
+            return False
+        if self._streaming:
+            return True
+        self._leave_dead_stream()
+
+        with self.lock:
+            try:
+                self.ser.reset_input_buffer()
+                self._stream_requested = True
+                self.ser.write(STREAM_START_COMMAND.format(n_avg=int(n_avg)).encode())
+            except Exception as e:
+                print(f"[MCU_Serial] Stream start error: {e}")
+                return False
+
+            self._deframer = StreamDeframer()
+            self._streaming = True
+            self._stream_thread = threading.Thread(
+                target=self._stream_loop, args=(on_block,), daemon=True, name="MCU_Stream_Reader"
+            )
+            self._stream_thread.start()
+        return True
+
+    def stop_stream(self):
+        """
+        Stop streaming, join the reader thread and flush pending bytes.
+
+        The stop command is sent whenever a stream was started, even if the
+        reader thread already died: the MCU keeps pushing frames until x*.
+        """
+        if not self._stream_requested:
+            return
+        self._streaming = False
+        if self._stream_thread:
+            self._stream_thread.join(timeout=2.0)
+            self._stream_thread = None
+
+        with self.lock:
+            try:
+                self.ser.write(STREAM_STOP_COMMAND.encode())
+                time.sleep(self.STREAM_READ_TIMEOUT_S)
+                self.ser.reset_input_buffer()
+            except Exception as e:
+                print(f"[MCU_Serial] Stream stop error: {e}")
+            finally:
+                self._stream_requested = False
+
+    def is_streaming(self) -> bool:
+        """True while the reader thread delivers blocks."""
+        return self._streaming
+
+    def _leave_dead_stream(self) -> bool:
+        """
+        Stop a stream whose reader thread died, before an ASCII exchange.
+
+        Returns False if a stream is still running (the link is not available).
+        """
+        if self._streaming:
+            return False
+        if self._stream_requested:
+            print("[MCU_Serial] Stream reader stopped: sending stop command before the next exchange")
+            self.stop_stream()
+        return True
+
+    def stream_stats(self) -> Optional[dict]:
+        """Deframer counters of the current/last stream (None if never started)."""
+        d = self._deframer
+        if d is None:
+            return None
+        return {
+            "frames": d.frames,
+            "crc_errors": d.crc_errors,
+            "lost_frames": d.lost_frames,
+            "skipped_bytes": d.skipped_bytes,
+        }
+
+    def _stream_loop(self, on_block: Callable[[StreamBlock], None]):
+        previous_timeout = self.ser.timeout
+        self.ser.timeout = self.STREAM_READ_TIMEOUT_S
+        try:
+            while self._streaming:
+                chunk = self.ser.read(max(self.ser.in_waiting, self.STREAM_READ_CHUNK))
+                if not chunk:
+                    continue
+                t0 = TRACER.start()
+                block = self._deframer.feed(chunk)
+                if block is not None:
+                    on_block(block)
+                TRACER.end("mcu", "stream_chunk", t0)
+        except Exception as e:
+            print(f"[MCU_Serial] Stream reader error: {e}")
+            self._streaming = False
+        finally:
+            self.ser.timeout = previous_timeout
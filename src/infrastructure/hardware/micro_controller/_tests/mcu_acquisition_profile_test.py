@@ -0,0 +1,87 @@
+import importlib.util
+import json
+import os
+import tempfile
+import unittest
+from unittest import mock
+
+from infrastructure.hardware.micro_controller.mcu_acquisition_profile import (
+    McuAcquisitionProfile,
+    McuAcquisitionSettings,
+)
+
+
+class TestMcuAcquisitionProfile(unittest.TestCase):
+
+    def test_defaults(self):
+        profile = McuAcquisitionProfile()
+        self.assertEqual(profile.n_avg, 1)
+        self.assertEqual(profile.version, 0)
+
+    def test_update_bumps_version_and_notifies(self):
+        profile = McuAcquisitionProfile()
+        seen = []
+        profile.add_listener(seen.append)
+        profile.update(n_avg=100)
+        self.assertEqual(profile.n_avg, 100)
+        self.assertEqual(profile.version, 1)
+        self.assertEqual(seen, [McuAcquisitionSettings(n_avg=100)])
+
+    def test_unchanged_update_is_silent(self):
+        profile = McuAcquisitionProfile(McuAcquisitionSettings(n_avg=10))
+        seen = []
+        profile.add_listener(seen.append)
+        profile.update(n_avg=10)
+        self.assertEqual(profile.version, 0)
+        self.assertEqual(seen, [])
+
+    def test_load_from_file(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "mcu_last_config.json")
+            with open(path, "w") as f:
+                json.dump({"n_avg": 42}, f)
+            self.assertEqual(McuAcquisitionProfile.load(path).n_avg, 42)
+            self.assertEqual(McuAcquisitionProfile.load(os.path.join(tmp, "missing.json")).n_avg, 1)
+
+    def test_settings_read_does_not_touch_filesystem(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "mcu_last_config.json")
+            with open(path, "w") as f:
+                json.dump({"n_avg": 7}, f)
+            profile = McuAcquisitionProfile.load(path)
+        with mock.patch("builtins.open", side_effect=AssertionError("file I/O on hot path")):
+            for _ in range(1000):
+                self.assertEqual(profile.n_avg, 7)
+
+
+@unittest.skipUnless(importlib.util.find_spec("numpy"), "numpy not installed")
+class TestAdapterUsesProfile(unittest.TestCase):
+
+    def test_sample_command_follows_profile(self):
+        from infrastructure.hardware.micro_controller.ads131a04.adapter_i_acquistion_port_ads131a04 import ADS131A04Adapter
+
+        class _Serial:
+            def __init__(self):
+                self.commands = []
+
+            def send_command(self, command):
+                self.commands.append(command)
+                return True, "\t".join(["0"] * 8)
+
+        serial = _Serial()
+        profile = McuAcquisitionProfile(McuAcquisitionSettings(n_avg=5))
+        adapter = ADS131A04Adapter(serial, profile)
+        adapter.load_config({
+            "channels": {str(ch): {"gain": 1} for ch in range(1, 7)},
+            "oversampling_ratio": 32,
+            "reference_voltage": 2.5,
+        })
+        with mock.patch("builtins.open", side_effect=AssertionError("file I/O on hot path")):
+            adapter.acquire_sample()
+            profile.update(n_avg=100)
+            adapter.acquire_sample()
+        self.assertEqual(serial.commands, ["m5", "m100"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,186 @@
+import sys
+import types
+import unittest
+
+# pyserial is only needed for real ports
+sys.modules.setdefault("serial", types.ModuleType("serial"))
+
+from infrastructure.hardware.micro_controller.mcu_register_protocol import (
+    MAX_BATCH_REGISTERS,
+    RegisterWriteResult,
+    decode_register_batch,
+    encode_ack,
+    encode_register_batch,
+    iter_batches,
+    parse_ack,
+)
+from infrastructure.hardware.micro_controller.MCU_serial_communicator import MCU_SerialCommunicator
+from infrastructure.hardware.micro_controller.ad9106.ad9106_controller import AD9106Controller
+from infrastructure.hardware.micro_controller.ads131a04.ads131_controller import ADS131Controller
+
+
+class FakeSerial:
+    """MCU side of the link: answers ASCII commands and register batch frames."""
+
+    def __init__(self, reject=()):
+        self.is_open = True
+        self.writes = []
+        self.registers = {}
+        self._reject = set(reject)
+        self._address = None
+        self._lines = []
+
+    def write(self, data):
+        self.writes.append(bytes(data))
+        if data[:1] == b"\xA5":
+            batch = decode_register_batch(data)
+            status = []
+            for address, value in batch:
+                ok = address not in self._reject
+                if ok:
+                    self.registers[address] = value
+                status.append(ok)
+            self._lines.append(encode_ack(status))
+            return
+        command = data.decode().rstrip("*")
+        if command.startswith("a"):
+            self._address = int(command[1:])
+        elif command.startswith("d"):
+            self.registers[self._address] = int(command[1:])
+        self._lines.append("OK")
+
+    def readline(self):
+        return (self._lines.pop(0) + "\r\n").encode()
+
+
+class FakeCommunicator:
+    def __init__(self):
+        self.calls = []
+
+    def write_registers(self, writes):
+        writes = tuple(writes)
+        self.calls.append(writes)
+        return RegisterWriteResult(written=writes)
+
+
+class TestMcuRegisterProtocol(unittest.TestCase):
+
+    def test_batch_roundtrip(self):
+        writes = [(63, 12583), (62, 8), (0xFFFF, 0)]
+        frame = encode_register_batch(writes)
+        self.assertEqual(len(frame), 2 + 1 + 4 * len(writes) + 2)
+        self.assertEqual(decode_register_batch(frame), writes)
+
+    def test_corrupted_frame_is_rejected(self):
+        frame = bytearray(encode_register_batch([(53, 1000)]))
+        frame[4] ^= 0xFF
+        with self.assertRaises(ValueError):
+            decode_register_batch(bytes(frame))
+
+    def test_batch_size_and_range_are_checked(self):
+        with self.assertRaises(ValueError):
+            encode_register_batch([])
+        with self.assertRaises(ValueError):
+            encode_register_batch([(1, 0)] * (MAX_BATCH_REGISTERS + 1))
+        with self.assertRaises(ValueError):
+            encode_register_batch([(1, 0x10000)])
+
+    def test_ack_roundtrip(self):
+        status = (True, False, True, True)
+        self.assertEqual(encode_ack(status), "B0000000d")
+        self.assertEqual(parse_ack("B0000000d\r\n", 4), status)
+        with self.assertRaises(ValueError):
+            parse_ack("OK", 4)
+
+    def test_iter_batches_splits(self):
+        writes = [(i, i) for i in range(MAX_BATCH_REGISTERS * 2 + 1)]
+        sizes = [len(batch) for batch in iter_batches(writes)]
+        self.assertEqual(sizes, [MAX_BATCH_REGISTERS, MAX_BATCH_REGISTERS, 1])
+
+
+class TestCommunicatorWriteRegisters(unittest.TestCase):
+
+    def setUp(self):
+        self.communicator = MCU_SerialCommunicator()
+        self._saved = (self.communicator.ser, self.communicator.register_batch_enabled)
+
+    def tearDown(self):
+        self.communicator.ser, self.communicator.register_batch_enabled = self._saved
+
+    def test_pairs_fallback(self):
+        self.communicator.ser = FakeSerial()
+        self.communicator.register_batch_enabled = False
+        result = self.communicator.write_registers([(53, 1000), (52, 2000)])
+        self.assertTrue(result.ok)
+        self.assertEqual(self.communicator.ser.writes, [b"a53*", b"d1000*", b"a52*", b"d2000*"])
+        self.assertEqual(self.communicator.ser.registers, {53: 1000, 52: 2000})
+
+    def test_batch_mode_single_frame_and_partial_failure(self):
+        self.communicator.ser = FakeSerial(reject={52})
+        self.communicator.register_batch_enabled = True
+        result = self.communicator.write_registers([(53, 1000), (52, 2000), (51, 3000)])
+        self.assertEqual(len(self.communicator.ser.writes), 1)
+        self.assertFalse(result.ok)
+        self.assertEqual(result.written, ((53, 1000), (51, 3000)))
+        self.assertEqual(result.failed, ((52, 2000),))
+
+    def test_not_connected(self):
+        self.communicator.ser = None
+        result = self.communicator.write_registers([(53, 1000)])
+        self.assertEqual(result.failed, ((53, 1000),))
+        self.assertEqual(result.error, "Not connected")
+
+
+class TestControllerRegisterShadow(unittest.TestCase):
+
+    def test_ad9106_skips_unchanged_registers(self):
+        fake = FakeCommunicator()
+        controller = AD9106Controller(fake)
+        self.assertTrue(controller.set_dds_gain(1, 1000).is_success)
+        self.assertTrue(controller.set_dds_gain(1, 1000).is_success)
+        self.assertEqual(len(fake.calls), 1)
+
+    def test_ad9106_transaction_sends_one_batch(self):
+        fake = FakeCommunicator()
+        controller = AD9106Controller(fake)
+        with controller.transaction():
+            controller.set_dds_gain(1, 1000)
+            controller.set_dds_gain(2, 2000)
+            controller.set_dds_phase(1, 0)
+            controller.set_dds_gain(1, 1500)
+        self.assertEqual(len(fake.calls), 1)
+        self.assertEqual(dict(fake.calls[0]), {
+            AD9106Controller.DDS_ADDRESSES["Gain"][1]: 1500,
+            AD9106Controller.DDS_ADDRESSES["Gain"][2]: 2000,
+            AD9106Controller.DDS_ADDRESSES["Phase"][1]: 0,
+        })
+
+    def test_ad9106_transaction_drops_register_restored_to_shadow(self):
+        fake = FakeCommunicator()
+        controller = AD9106Controller(fake)
+        controller.set_dds_gain(1, 1000)
+        with controller.transaction():
+            controller.set_dds_gain(1, 5000)
+            controller.set_dds_gain(1, 1000)
+        self.assertEqual(len(fake.calls), 1)
+
+    def test_ads131_channel_gains_one_batch(self):
+        fake = FakeCommunicator()
+        controller = ADS131Controller(fake)
+        success, _ = controller.set_channel_gains({1: 1, 2: 2, 3: 4, 4: 16})
+        self.assertTrue(success)
+        self.assertEqual(fake.calls, [((17, 0), (18, 1), (19, 2), (20, 4))])
+        success, _ = controller.set_channel_gains({1: 1, 2: 8, 3: 4, 4: 16})
+        self.assertTrue(success)
+        self.assertEqual(fake.calls[-1], ((18, 3),))
+
+    def test_ads131_invalid_gain_writes_nothing(self):
+        fake = FakeCommunicator()
+        controller = ADS131Controller(fake)
+        success, _ = controller.set_channel_gains({1: 1, 2: 3})
+        self.assertFalse(success)
+        self.assertEqual(fake.calls, [])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,74 @@
+import sys
+import threading
+import types
+import unittest
+
+# pyserial is only needed for real ports
+sys.modules.setdefault("serial", types.ModuleType("serial"))
+
+from infrastructure.hardware.micro_controller.MCU_serial_communicator import MCU_SerialCommunicator
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import STREAM_STOP_COMMAND
+
+
+class BrokenStreamSerial:
+    """Port whose stream reads fail: the reader thread dies, the MCU keeps streaming."""
+
+    def __init__(self):
+        self.is_open = True
+        self.timeout = 1
+        self.in_waiting = 0
+        self.writes = []
+        self.input_resets = 0
+        self.read_failed = threading.Event()
+
+    def write(self, data):
+        self.writes.append(data)
+        return len(data)
+
+    def read(self, size=1):
+        self.read_failed.set()
+        raise OSError("device reports readiness to read but returned no data")
+
+    def readline(self):
+        return b"OK\r\n"
+
+    def reset_input_buffer(self):
+        self.input_resets += 1
+
+
+class TestStreamStopAfterReaderError(unittest.TestCase):
+
+    def setUp(self):
+        self.communicator = MCU_SerialCommunicator()
+        self._saved = self.communicator.ser
+        self.communicator.ser = BrokenStreamSerial()
+        self.assertTrue(self.communicator.start_stream(4, lambda block: None))
+        self.assertTrue(self.communicator.ser.read_failed.wait(2.0))
+        self.communicator._stream_thread.join(2.0)
+
+    def tearDown(self):
+        self.communicator.stop_stream()
+        self.communicator.ser = self._saved
+
+    def test_stop_stream_sends_stop_command_when_reader_died(self):
+        self.assertFalse(self.communicator.is_streaming())
+        resets = self.communicator.ser.input_resets
+
+        self.communicator.stop_stream()
+
+        self.assertEqual(self.communicator.ser.writes[-1], STREAM_STOP_COMMAND.encode())
+        self.assertEqual(self.communicator.ser.input_resets, resets + 1)
+        writes = len(self.communicator.ser.writes)
+        self.communicator.stop_stream()  # No stream left: nothing sent
+        self.assertEqual(len(self.communicator.ser.writes), writes)
+
+    def test_next_command_stops_dead_stream_first(self):
+        success, response = self.communicator.send_command("v")
+
+        self.assertTrue(success)
+        self.assertEqual(response, "OK")
+        self.assertEqual(self.communicator.ser.writes[-2:], [STREAM_STOP_COMMAND.encode(), b"v*"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,72 @@
+import unittest
+import sys
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import (
+    FRAME_SIZE,
+    SequenceUnwrapper,
+    StreamDeframer,
+    crc16,
+    decode_frame,
+    encode_frame,
+)
+
+CODES = (0, 1, -1, 8388607, -8388608, 123456)
+
+
+def frames_of(block):
+    return [block.payload[i:i + FRAME_SIZE] for i in range(0, len(block.payload), FRAME_SIZE)]
+
+
+class TestMcuStreamProtocol(unittest.TestCase):
+    def test_crc_matches_ccitt_false_check_value(self):
+        self.assertEqual(crc16(b"123456789"), 0x29B1)
+
+    def test_encode_decode_roundtrip(self):
+        frame = encode_frame(70000, CODES)
+        self.assertEqual(len(frame), FRAME_SIZE)
+        self.assertEqual(decode_frame(frame), (70000 & 0xFFFF, CODES))
+
+    def test_frames_split_across_chunks(self):
+        stream = b"".join(encode_frame(i, CODES) for i in range(3))
+        deframer = StreamDeframer()
+
+        self.assertIsNone(deframer.feed(stream[:10]))
+        block = deframer.feed(stream[10:50])
+        self.assertEqual(block.count, 2)
+        block = deframer.feed(stream[50:])
+        self.assertEqual(block.count, 1)
+        self.assertEqual(decode_frame(block.payload)[0], 2)
+        self.assertEqual((deframer.frames, deframer.lost_frames, deframer.crc_errors), (3, 0, 0))
+
+    def test_resync_after_garbage_and_corrupted_frame(self):
+        corrupted = bytearray(encode_frame(1, CODES))
+        corrupted[10] ^= 0xFF
+        stream = b"\x00\x13\xA5" + encode_frame(0, CODES) + bytes(corrupted) + encode_frame(2, CODES)
+
+        deframer = StreamDeframer()
+        block = deframer.feed(stream)
+
+        self.assertEqual([decode_frame(f)[0] for f in frames_of(block)], [0, 2])
+        self.assertEqual(deframer.crc_errors, 1)
+        self.assertEqual(deframer.lost_frames, 1)
+        self.assertGreaterEqual(deframer.skipped_bytes, 3)
+
+    def test_sequence_wraparound_is_not_a_loss(self):
+        deframer = StreamDeframer()
+        deframer.feed(encode_frame(65535, CODES) + encode_frame(0, CODES) + encode_frame(3, CODES))
+        self.assertEqual(deframer.lost_frames, 2)
+
+    def test_sequence_unwrapper_counts_across_wraps(self):
+        unwrapper = SequenceUnwrapper()
+        self.assertEqual([unwrapper.update(s) for s in (65530, 65535, 4, 100)],
+                         [65530, 65535, 65540, 65636])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -15,9 +15,13 @@ Design (QCS):
 - SETUP: connection lifecycle (connect, disconnect, init_default_config)
 - COMMAND: configuration commands (set_dds_frequency, set_dds_gain, etc.)
 - QUERY: state queries (get_memory_state)
+- Register writes go through write_registers(): registers whose last written
+  value is unchanged are skipped, and writes staged inside transaction() go
+  out as one MCU register batch
 """
 
-from typing import Dict, Optional, Tuple
+from contextlib import contextmanager
+from typing import Dict, Iterator, List, Optional, Sequence, Tuple
 from infrastructure.hardware.micro_controller.MCU_serial_communicator import MCU_SerialCommunicator
 from domain.shared.operation_result import OperationResult
 
@@ -68,6 +72,10 @@ class AD9106Controller:
         }
         self._freq_msb: Optional[int] = None
         self._freq_lsb: Optional[int] = None
+        # Last value written per register address (hardware shadow)
+        self._registers: Dict[int, int] = {}
+        # Writes staged by transaction() (None outside a transaction)
+        self._pending: Optional[List[Tuple[int, int, bool]]] = None
     
     # ==========================================================================
     # SETUP
@@ -108,21 +116,16 @@ class AD9106Controller:
                 (64, 0),      # DDS: Phase_4
             ]
             
+            # Hardware state unknown after (re)connection: write every register
+            self._registers.clear()
+            result = self.write_registers(params_default, force=True)
+            
+            # Update memory state (registers actually written)
             for address, value in params_default:
-                # Select register
-                success, response = self._communicator.send_command(f"a{address}")
-                if not success:
-                    return OperationResult.fail(f"Failed to select address {address}: {response}")
-                
-                # Write data
-                success, response = self._communicator.send_command(f"d{value}")
-                if not success:
-                    return OperationResult.fail(f"Failed to write value {value} to address {address}: {response}")
-                
-                # Update memory state
-                self._update_memory_from_address(address, value)
+                if self._registers.get(address) == value:
+                    self._update_memory_from_address(address, value)
             
-            return OperationResult.ok(None)
+            return result
             
         except Exception as e:
             return OperationResult.fail(f"Initialization failed: {str(e)}")
@@ -154,23 +157,13 @@ class AD9106Controller:
                 return OperationResult.fail(result)
             partie_haute, partie_basse = result
             
-            # Send MSB (address 62)
-            success, response = self._communicator.send_command(f"a{self.DDS_ADDRESSES['Frequency'][0]}")
-            if not success:
-                return OperationResult.fail(f"Failed to select MSB address: {response}")
-            
-            success, response = self._communicator.send_command(f"d{partie_haute}")
-            if not success:
-                return OperationResult.fail(f"Failed to write MSB value: {response}")
-            
-            # Send LSB (address 63)
-            success, response = self._communicator.send_command(f"a{self.DDS_ADDRESSES['Frequency'][1]}")
-            if not success:
-                return OperationResult.fail(f"Failed to select LSB address: {response}")
-            
-            success, response = self._communicator.send_command(f"d{partie_basse}")
-            if not success:
-                return OperationResult.fail(f"Failed to write LSB value: {response}")
+            # Send MSB (address 62) then LSB (address 63)
+            result = self.write_registers([
+                (self.DDS_ADDRESSES['Frequency'][0], partie_haute),
+                (self.DDS_ADDRESSES['Frequency'][1], partie_basse),
+            ])
+            if result.is_failure:
+                return OperationResult.fail(f"Failed to write frequency registers: {result.error}")
             
             # Update memory state
             self._memory_state["DDS"]["Frequence"] = freq_hz
@@ -214,15 +207,6 @@ class AD9106Controller:
             # |  DDS2 (8 bits)  |  DDS1 (8 bits)  |
             valeur_dds12 = val_1 | (val_2 << 8)
             
-            # 3. Send command to Register 39
-            success, response = self._communicator.send_command(f"a{self.DDS_ADDRESSES['Mode'][1]}")
-            if not success:
-                return OperationResult.fail(f"Failed to select Mode register for DDS1/2: {response}")
-            
-            success, response = self._communicator.send_command(f"d{valeur_dds12}")
-            if not success:
-                return OperationResult.fail(f"Failed to write Mode value for DDS1/2: {response}")
-            
             # --- Configure DDS3 & DDS4 (Register 38) ---
             # Register 38 controls both DDS3 and DDS4.
             # - Lower 8 bits (0-7): Controls DDS3
@@ -234,13 +218,13 @@ class AD9106Controller:
             # Combine: DDS4 (upper) | DDS3 (lower)
             valeur_dds34 = val_3 | (val_4 << 8)
             
-            success, response = self._communicator.send_command(f"a{self.DDS_ADDRESSES['Mode'][3]}")
-            if not success:
-                return OperationResult.fail(f"Failed to select Mode register for DDS3/4: {response}")
-            
-            success, response = self._communicator.send_command(f"d{valeur_dds34}")
-            if not success:
-                return OperationResult.fail(f"Failed to write Mode value for DDS3/4: {response}")
+            # Send both mode registers (39 then 38)
+            result = self.write_registers([
+                (self.DDS_ADDRESSES['Mode'][1], valeur_dds12),
+                (self.DDS_ADDRESSES['Mode'][3], valeur_dds34),
+            ])
+            if result.is_failure:
+                return OperationResult.fail(f"Failed to write Mode registers: {result.error}")
             
             # Update memory state
             self._memory_state["DDS"]["Mode"] = {
@@ -272,13 +256,9 @@ class AD9106Controller:
         try:
             addr = self.DDS_ADDRESSES["Gain"][channel]
             
-            success, response = self._communicator.send_command(f"a{addr}")
-            if not success:
-                return OperationResult.fail(f"Failed to select Gain address: {response}")
-            
-            success, response = self._communicator.send_command(f"d{value}")
-            if not success:
-                return OperationResult.fail(f"Failed to write Gain value: {response}")
+            result = self.write_registers([(addr, value)])
+            if result.is_failure:
+                return OperationResult.fail(f"Failed to write Gain value: {result.error}")
             
             # Update memory state
             self._memory_state["DDS"]["Gain"][channel] = value
@@ -304,16 +284,10 @@ class AD9106Controller:
         
         try:
             addr = self.DDS_ADDRESSES["Phase"][channel]
-            success, response = self._communicator.send_command(f"a{addr}")
-            print(f"[AD9106 Controller] Selected Phase address: {addr}")
-            print(f"[AD9106 Controller] Sent to MCU")
-            if not success:
-                return OperationResult.fail(f"Failed to select Phase address: {response}")
-            
-            success, response = self._communicator.send_command(f"d{value}")
-            print(f"[AD9106 Controller] Sent to MCU Phase value: {value}")
-            if not success:
-                return OperationResult.fail(f"Failed to write Phase value: {response}")
+            result = self.write_registers([(addr, value)])
+            print(f"[AD9106 Controller] Phase register {addr} <- {value}")
+            if result.is_failure:
+                return OperationResult.fail(f"Failed to write Phase value: {result.error}")
             
             # Update memory state
             self._memory_state["DDS"]["Phase"][channel] = value
@@ -340,13 +314,9 @@ class AD9106Controller:
         try:
             addr = self.DDS_ADDRESSES["Offset"][channel]
             
-            success, response = self._communicator.send_command(f"a{addr}")
-            if not success:
-                return OperationResult.fail(f"Failed to select Offset address: {response}")
-            
-            success, response = self._communicator.send_command(f"d{value}")
-            if not success:
-                return OperationResult.fail(f"Failed to write Offset value: {response}")
+            result = self.write_registers([(addr, value)])
+            if result.is_failure:
+                return OperationResult.fail(f"Failed to write Offset value: {result.error}")
             
             # Update memory state
             self._memory_state["DDS"]["Offset"][channel] = value
@@ -373,13 +343,9 @@ class AD9106Controller:
         try:
             addr = self.DDS_ADDRESSES["Const"][channel]
             
-            success, response = self._communicator.send_command(f"a{addr}")
-            if not success:
-                return OperationResult.fail(f"Failed to select Const address: {response}")
-            
-            success, response = self._communicator.send_command(f"d{value}")
-            if not success:
-                return OperationResult.fail(f"Failed to write Const value: {response}")
+            result = self.write_registers([(addr, value)])
+            if result.is_failure:
+                return OperationResult.fail(f"Failed to write Const value: {result.error}")
             
             # Update memory state
             self._memory_state["DDS"]["Const"][channel] = value
@@ -432,13 +398,9 @@ class AD9106Controller:
             # Get address from dictionary
             addr = self.DDS_ADDRESSES['Mode'][channel]
             
-            success, response = self._communicator.send_command(f"a{addr}")
-            if not success:
-                return OperationResult.fail(f"Failed to select Mode register: {response}")
-            
-            success, response = self._communicator.send_command(f"d{valeur}")
-            if not success:
-                return OperationResult.fail(f"Failed to write Mode value: {response}")
+            result = self.write_registers([(addr, valeur)])
+            if result.is_failure:
+                return OperationResult.fail(f"Failed to write Mode value: {result.error}")
             
             # Update memory state
             self._memory_state["DDS"]["Mode"][channel] = mode
@@ -448,6 +410,69 @@ class AD9106Controller:
         except Exception as e:
             return OperationResult.fail(f"Set channel mode failed: {str(e)}")
     
+    def write_registers(self, writes: Sequence[Tuple[int, int]], force: bool = False) -> OperationResult[None, str]:
+        """
+        COMMAND: Write raw (address, value) registers, skipping unchanged ones.
+        
+        Inside transaction(), writes are staged and sent on exit.
+        
+        Args:
+            writes: (address, value) pairs, in write order
+            force: Write even registers whose shadow value is identical
+            
+        Returns:
+            OperationResult indicating success or failure
+        """
+        if self._pending is not None:
+            # Diffed on exit, against the final value of each register
+            self._pending.extend((a, v, force) for a, v in writes)
+            return OperationResult.ok(None)
+        return self._send_registers([(a, v) for a, v in writes if force or self._registers.get(a) != v])
+    
+    @contextmanager
+    def transaction(self) -> Iterator[None]:
+        """
+        COMMAND: Group the register writes of several set_dds_* calls into one
+        MCU register batch, sent when the block exits (nested blocks join the
+        outer one).
+        
+        Raises:
+            RuntimeError: If the batch fails (failed registers will be rewritten
+            by the next write).
+        """
+        if self._pending is not None:
+            yield
+            return
+        self._pending = []
+        try:
+            yield
+            staged = self._pending
+        finally:
+            self._pending = None
+        
+        # Last value per address wins; drop registers back to their shadow value
+        merged: Dict[int, Tuple[int, bool]] = {}
+        for address, value, force in staged:
+            previous = merged.pop(address, None)
+            merged[address] = (value, force or (previous is not None and previous[1]))
+        result = self._send_registers([
+            (a, v) for a, (v, force) in merged.items() if force or self._registers.get(a) != v
+        ])
+        if result.is_failure:
+            raise RuntimeError(f"AD9106 register transaction failed: {result.error}")
+    
+    def _send_registers(self, writes: List[Tuple[int, int]]) -> OperationResult[None, str]:
+        if not writes:
+            return OperationResult.ok(None)
+        result = self._communicator.write_registers(writes)
+        for address, value in result.written:
+            self._registers[address] = value
+        for address, _ in result.failed:
+            self._registers.pop(address, None)
+        if not result.ok:
+            return OperationResult.fail(result.error or "Register write failed")
+        return OperationResult.ok(None)
+    
     # ==========================================================================
     # QUERIES
     # ==========================================================================
@@ -15,6 +15,7 @@ Design:
 - Hexagonal Architecture: Adapter pattern
 - Translates ExcitationParameters → DDS commands
 - Uses AD9106Controller for low-level hardware control
+- One AD9106Controller.transaction() per apply_excitation call
 """
 
 # EXTERNAL PYTHON LIBS
@@ -83,6 +84,8 @@ class AdapterExcitationConfigurationAD9106(IExcitationPort):
         Optimized to minimize hardware communication:
         - Only updates parameters that have changed.
         - Strictly follows "Just change phases for mode change" rule where possible.
+        - All register writes of one update go out as a single controller
+          transaction (one MCU register batch, unchanged registers skipped).
         
         Args:
             params: Domain excitation parameters (mode, level, frequency)
@@ -94,6 +97,16 @@ class AdapterExcitationConfigurationAD9106(IExcitationPort):
         if self._current_params == params:
             return
 
+        try:
+            with self._controller.transaction():
+                self._stage_excitation(params)
+        except RuntimeError:
+            # Hardware state uncertain: the next call re-applies everything
+            self._current_params = None
+            raise
+
+    def _stage_excitation(self, params: ExcitationParameters) -> None:
+        """Issue the controller calls for params (staged by the enclosing transaction)."""
         print(f"[AD9106Adapter] apply_excitation called: mode={params.mode.name}, level={params.level.value}%, freq={params.frequency}Hz")
         
         # 1. Handle OFF mode (level=0)
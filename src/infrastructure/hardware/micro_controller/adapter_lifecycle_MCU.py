@@ -261,18 +261,10 @@ class MCULifecycleAdapter(IHardwareInitializationPort):
             (64, 0),      # DDS: Phase_4
         ]
         
-        for address, value in params_default:
-            # Select register
-            success, response = self._communicator.send_command(f"a{address}")
-            if not success:
-                print(f"[MCULifecycle] WARNING: Failed to select address {address}: {response}")
-                continue
-            
-            # Write data
-            success, response = self._communicator.send_command(f"d{value}")
-            if not success:
-                print(f"[MCULifecycle] WARNING: Failed to write value {value} to address {address}: {response}")
-                continue
+        # One register transaction for the whole default sequence
+        result = self._communicator.write_registers(params_default)
+        for address, value in result.failed:
+            print(f"[MCULifecycle] WARNING: Failed to write value {value} to address {address}: {result.error}")
         
         print(f"[MCULifecycle] Default hardware configuration applied successfully.")
         
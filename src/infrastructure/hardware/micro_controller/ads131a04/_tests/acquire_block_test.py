@@ -0,0 +1,70 @@
+import unittest
+import sys
+from pathlib import Path
+
+import numpy as np
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from infrastructure.hardware.micro_controller.ads131a04.adapter_i_acquistion_port_ads131a04 import ADS131A04Adapter
+
+CONFIG = {
+    "reference_voltage": 2.5,
+    "oversampling_ratio": 1024,
+    "channels": {str(ch): {"gain": 2 if ch == 3 else 1} for ch in range(1, 9)},
+}
+
+
+class FakeSerial:
+    """Answers 'm{n}' requests with a fixed tab-separated line (8 channels)."""
+
+    def __init__(self, codes):
+        self.line = "\t".join(str(c) for c in codes)
+        self.commands = []
+
+    def send_command(self, command):
+        self.commands.append(command)
+        return True, self.line
+
+    def is_streaming(self):
+        return False
+
+
+class TestAcquireBlock(unittest.TestCase):
+    def setUp(self):
+        self.codes = [8388607, -8388608, 1000, 0, -1, 4194304, 7, 7]
+        self.serial = FakeSerial(self.codes)
+        self.adapter = ADS131A04Adapter(self.serial)
+        self.adapter.load_config(CONFIG)
+
+    def test_block_matches_scalar_conversion(self):
+        block = self.adapter.acquire_block(4)
+
+        self.assertEqual(block.shape, (4, 6))
+        self.assertEqual(block.dtype, np.float64)
+        expected = [self.adapter._convert_raw_to_volts(code, channel=ch + 1) for ch, code in enumerate(self.codes[:6])]
+        np.testing.assert_allclose(block, np.tile(expected, (4, 1)))
+        self.assertAlmostEqual(block[0, 2], 1000 / 2**23 * 2.5 / 2)
+        self.assertEqual(len(self.serial.commands), 4)
+
+    def test_single_sample_uses_precomputed_constants(self):
+        sample = self.adapter.acquire_sample()
+        self.assertAlmostEqual(sample.voltage_x_in_phase, 8388607 / 2**23 * 2.5)
+        self.assertAlmostEqual(sample.uncertainty_estimate_volts, 2.5 / (2**24 * 1 * 32))
+
+    def test_out_of_range_code_is_rejected(self):
+        with self.assertRaises(ValueError):
+            self.adapter.convert_codes_to_volts(np.array([[0, 0, 0, 0, 0, 8388608]]))
+
+    def test_reload_config_refreshes_scales(self):
+        config = dict(CONFIG, reference_voltage=1.25)
+        self.adapter.load_config(config)
+        block = self.adapter.acquire_block(1)
+        self.assertAlmostEqual(block[0, 0], 8388607 / 2**23 * 1.25)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -52,16 +52,6 @@ class TestContinuousAcquisitionSequence(DiagramFriendlyTest):
                              data={"dependency": "AdapterIContinuousAcquisitionAds131a04", "port": "AcquisitionPort"})
         service = ContinuousAcquisitionService(executor, mock_port)
 
-        # 2. Subscribe to events to verify flow
-        received_samples = []
-        def on_sample(event):
-            self.log_interaction("EventBus", "RECEIVE", "TestSubscriber", "Sample Acquired", 
-                                 data={"index": event.sample_index})
-            received_samples.append(event)
-
-        self.log_interaction("TestSubscriber", "SUBSCRIBE", "EventBus", "continuousacquisitionsampleacquired")
-        event_bus.subscribe("continuousacquisitionsampleacquired", on_sample)
-
         # 3. Start Acquisition
         config = ContinuousAcquisitionConfig(sample_rate_hz=10.0)
         self.log_interaction("Test", "COMMAND", "Service", "start_acquisition", 
@@ -75,10 +65,16 @@ class TestContinuousAcquisitionSequence(DiagramFriendlyTest):
         self.log_interaction("Test", "COMMAND", "Service", "stop_acquisition")
         service.stop_acquisition()
 
-        # 6. Assertions
-        self.log_interaction("Test", "ASSERT", "TestSubscriber", "Verify samples received", 
-                             expect="> 0 samples", got=f"{len(received_samples)} samples")
-        self.assertTrue(len(received_samples) > 0)
+        # 6. Drain the sample buffer (consumer side)
+        self.log_interaction("Test", "QUERY", "Service", "drain_samples")
+        records = service.drain_samples()
+
+        # 7. Assertions
+        self.log_interaction("Test", "ASSERT", "Service", "Verify samples buffered", 
+                             expect="> 0 samples", got=f"{len(records)} samples")
+        self.assertTrue(len(records) > 0)
+        self.assertEqual(list(records["index"]), list(range(len(records))))
+        self.assertEqual(service.get_sample_overruns(), 0)
 
 if __name__ == '__main__':
     unittest.main()
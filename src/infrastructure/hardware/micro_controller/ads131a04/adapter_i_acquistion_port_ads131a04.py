@@ -16,16 +16,31 @@ Design:
 - Hexagonal Architecture: Adapter pattern
 - Translates MeasurementUncertainty → ADCHardwareConfig
 - Formula: Uncertainty ≈ Vref / (2^N · Gain · √OSR) + other sources
+- Conversion constants (volts/code per channel, uncertainty) are
+  precomputed on load_config; blocks are converted in one numpy expression
+- MCU n_avg comes from the in-memory McuAcquisitionProfile: no file I/O
+  on the acquisition path
 """
 
 from dataclasses import dataclass
+from datetime import datetime
 from typing import Dict, Optional, Any, List
 import math
+import time
+
+import numpy as np
 
 from application.services.scan_application_service.i_acquisition_port import IAcquisitionPort
 from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
-import json
-import os
+from infrastructure.buffers.spsc_ring_buffer import SpscRingBuffer
+from infrastructure.hardware.micro_controller.mcu_acquisition_profile import McuAcquisitionProfile
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import CHANNEL_COUNT, StreamBlock
+
+# Streamed record layout (raw codes, converted on the consumer side)
+STREAM_RECORD_DTYPE = np.dtype([("sequence", np.uint16), ("codes", np.int32, (CHANNEL_COUNT,))])
+
+# ~2 s of samples at the ADC maximum data rate
+DEFAULT_STREAM_CAPACITY = 1 << 18
 
 
 @dataclass
@@ -55,13 +70,23 @@ class ADS131A04Adapter(IAcquisitionPort):
     AVAILABLE_OSR = [4096, 2048, 1024, 800, 768, 512, 400, 384, 256, 200, 192, 128, 96, 64, 48, 32]
     MAX_DATA_RATE_HZ = 128000  # Maximum output data rate
     
-    def __init__(self, serial_communicator):
+    def __init__(self, serial_communicator, mcu_profile: Optional[McuAcquisitionProfile] = None):
         """
         Args:
             serial_communicator: MCU_serial_communicator (singleton)
+            mcu_profile: Shared MCU acquisition parameters (n_avg), updated by
+                MCUAdvancedConfigurator. Loaded once from mcu_last_config.json if omitted.
         """
         self._serial = serial_communicator
+        self._mcu_profile = mcu_profile if mcu_profile is not None else McuAcquisitionProfile.load()
+        self._sample_command_cache = ""
+        self._sample_command_version = -1
         self._current_config: Optional[ADCHardwareConfig] = None
+        self._stream_buffer: Optional[SpscRingBuffer] = None
+
+        # Conversion constants, refreshed by load_config()
+        self._channel_scales: Optional[np.ndarray] = None  # volts per code, channels 1-6
+        self._uncertainty_volts = 0.0
     
     def load_config(self, config_dict: dict) -> None:
         """
@@ -88,6 +113,7 @@ class ADS131A04Adapter(IAcquisitionPort):
                 # Calculate sampling rate based on OSR (approximate)
                 sampling_rate_hz=self.MAX_DATA_RATE_HZ / adc_config["oversampling_ratio"]
             )
+            self._refresh_conversion()
             print(f"[ADS131Adapter] Configuration loaded: {self._current_config}")
             
         except KeyError as e:
@@ -96,6 +122,23 @@ class ADS131A04Adapter(IAcquisitionPort):
         except Exception as e:
             print(f"[ADS131Adapter] Failed to load config: {e}")
             raise e
+
+    def _refresh_conversion(self) -> None:
+        """Precompute per-channel volts/code and the uncertainty estimate."""
+        config = self._current_config
+        # ADS131A04 conversion formula (datasheet)
+        # V = (raw / 2^23) * (Vref / Gain)
+        # 2^23 because 24-bit signed (one bit for sign)
+        self._channel_scales = np.array(
+            [config.reference_voltage / (config.channel_gains[ch] * 2**23) for ch in range(1, CHANNEL_COUNT + 1)],
+            dtype=np.float64,
+        )
+
+        gain = list(config.channel_gains.values())[0]  # Assume same for all
+        # Uncertainty (quantization component) = Vref / (2^N · Gain · √OSR)
+        self._uncertainty_volts = config.reference_voltage / (
+            2**self.ADC_RESOLUTION_BITS * gain * math.sqrt(config.oversampling_ratio)
+        )
     
     def acquire_sample(self) -> VoltageMeasurement:
         """
@@ -111,28 +154,11 @@ class ADS131A04Adapter(IAcquisitionPort):
         Raises:
             RuntimeError: If acquisition or parsing fails
         """
-        from datetime import datetime
-        import json
-        import os
-        
-        # Get n_avg from MCU config (default: 1)
-        n_avg = 1
-        try:
-            mcu_config_path = os.path.join(
-                os.path.dirname(os.path.dirname(__file__)), 
-                "mcu_last_config.json"
-            )
-            if os.path.exists(mcu_config_path):
-                with open(mcu_config_path, 'r') as f:
-                    mcu_config = json.load(f)
-                    n_avg = int(mcu_config.get("n_avg", 1))
-        except Exception as e:
-            print(f"[ADS131Adapter] Failed to read MCU config, using default n_avg=1: {e}")
-        
         # Acquire via MCU: command 'm{n_avg}' (n_avg samples averaged by MCU)
+        command = self._sample_command()
         # DEBUG: Trace acquisition start
-        # print(f"[ADS131Adapter] Requesting sample 'm{n_avg}'")
-        success, response = self._serial.send_command(f'm{n_avg}')
+        # print(f"[ADS131Adapter] Requesting sample '{command}'")
+        success, response = self._serial.send_command(command)
         
         if not success:
             print(f"[ADS131Adapter] Acquisition failed. Response: {response}")
@@ -151,17 +177,155 @@ class ADS131A04Adapter(IAcquisitionPort):
             print(f"[ADS131Adapter] Parsing error: {e}")
             raise RuntimeError(f"Failed to parse ADC data: {e}, response: '{response}'")
         
-        # Convert raw codes to voltages
+        return self._codes_to_measurement(raw_codes)
+
+    def _sample_command(self) -> str:
+        """'m{n_avg}' for the current MCU profile, rebuilt only when the profile changes."""
+        profile = self._mcu_profile
+        if profile.version != self._sample_command_version:
+            self._sample_command_cache = f'm{profile.n_avg}'
+            self._sample_command_version = profile.version
+        return self._sample_command_cache
+
+    def _codes_to_measurement(self, raw_codes) -> VoltageMeasurement:
+        """Convert 6 raw codes (channels 1-6) to a domain VoltageMeasurement."""
+        volts = self.convert_codes_to_volts(np.asarray(raw_codes, dtype=np.float64))
         return VoltageMeasurement(
-            voltage_x_in_phase=self._convert_raw_to_volts(raw_codes[0], channel=1),
-            voltage_x_quadrature=self._convert_raw_to_volts(raw_codes[1], channel=2),
-            voltage_y_in_phase=self._convert_raw_to_volts(raw_codes[2], channel=3),
-            voltage_y_quadrature=self._convert_raw_to_volts(raw_codes[3], channel=4),
-            voltage_z_in_phase=self._convert_raw_to_volts(raw_codes[4], channel=5),
-            voltage_z_quadrature=self._convert_raw_to_volts(raw_codes[5], channel=6),
+            voltage_x_in_phase=float(volts[0]),
+            voltage_x_quadrature=float(volts[1]),
+            voltage_y_in_phase=float(volts[2]),
+            voltage_y_quadrature=float(volts[3]),
+            voltage_z_in_phase=float(volts[4]),
+            voltage_z_quadrature=float(volts[5]),
             timestamp=datetime.now(),
-            uncertainty_estimate_volts=self._estimate_uncertainty()
+            uncertainty_estimate_volts=self._uncertainty_volts
         )
+
+    def convert_codes_to_volts(self, codes: np.ndarray) -> np.ndarray:
+        """
+        Vectorized conversion of raw codes to volts.
+
+        Args:
+            codes: (..., 6) raw codes, channels 1-6 on the last axis.
+
+        Returns:
+            float64 array of the same shape, in volts.
+
+        Raises:
+            ValueError: If any code is out of the 24-bit signed range
+            RuntimeError: If ADC not configured
+        """
+        if self._channel_scales is None:
+            raise RuntimeError("ADC not configured")
+        out_of_range = (codes < -8388608) | (codes > 8388607)
+        if out_of_range.any():
+            raise ValueError(f"Invalid 24-bit ADC code: {codes[out_of_range].flat[0]}")
+        return codes * self._channel_scales
+
+    def acquire_block(self, n: int) -> np.ndarray:
+        """
+        Acquire n samples as an (n, 6) float64 array of volts.
+
+        Uses the binary stream when it is running (waits for n records),
+        otherwise n 'm{n_avg}' requests; conversion is done once for the block.
+
+        Raises:
+            RuntimeError: If acquisition, parsing or the stream fails
+        """
+        if self._stream_buffer is not None and self._serial.is_streaming():
+            codes = self._read_stream_codes(n)
+        else:
+            codes = self._request_codes(n)
+        return self.convert_codes_to_volts(codes)
+
+    def _request_codes(self, n: int) -> np.ndarray:
+        codes = np.empty((n, CHANNEL_COUNT), dtype=np.int32)
+        command = self._sample_command()
+        for i in range(n):
+            success, response = self._serial.send_command(command)
+            if not success:
+                raise RuntimeError(f"Acquisition failed: {response}")
+            row = response.split('\t')
+            try:
+                codes[i] = [int(x) for x in row[:CHANNEL_COUNT]]
+            except ValueError as e:
+                raise RuntimeError(f"Failed to parse ADC data: {e}, response: '{response}'")
+        return codes
+
+    def _read_stream_codes(self, n: int) -> np.ndarray:
+        # Generous timeout: n samples at the configured data rate, plus 1 s
+        rate = self._current_config.sampling_rate_hz if self._current_config else 1.0
+        deadline = time.monotonic() + 1.0 + n / max(rate, 1.0)
+        blocks = []
+        remaining = n
+        while remaining > 0:
+            records = self._stream_buffer.read(remaining)
+            if len(records):
+                blocks.append(records["codes"])
+                remaining -= len(records)
+                continue
+            if not self._serial.is_streaming() or time.monotonic() > deadline:
+                raise RuntimeError(f"Stream delivered {n - remaining}/{n} samples")
+            time.sleep(0.001)
+        return np.concatenate(blocks)
+
+    # ------------------------------------------------------------------
+    # Binary streaming
+    # ------------------------------------------------------------------
+
+    def supports_streaming(self) -> bool:
+        """True if the serial link offers the MCU binary streaming mode."""
+        return callable(getattr(self._serial, "start_stream", None))
+
+    def start_streaming(self, capacity: int = DEFAULT_STREAM_CAPACITY) -> None:
+        """
+        Switch the MCU to binary streaming; records accumulate in a ring buffer.
+
+        Raises:
+            RuntimeError: If the MCU stream cannot be started.
+        """
+        self._stream_buffer = SpscRingBuffer(capacity, STREAM_RECORD_DTYPE)
+        n_avg = self._mcu_profile.n_avg
+        if not self._serial.start_stream(n_avg, self._on_stream_block):
+            self._stream_buffer = None
+            raise RuntimeError("Failed to start MCU stream")
+        print(f"[ADS131Adapter] Streaming started (n_avg={n_avg}, capacity={capacity})")
+
+    def stop_streaming(self) -> None:
+        """Leave streaming mode (back to request/response)."""
+        self._serial.stop_stream()
+        stats = self._serial.stream_stats()
+        overruns = self._stream_buffer.overruns if self._stream_buffer is not None else 0
+        print(f"[ADS131Adapter] Streaming stopped: {stats}, overruns={overruns}")
+
+    def read_stream(self, max_samples: Optional[int] = None) -> np.ndarray:
+        """
+        Drain streamed records (fields: 'sequence' uint16, 'codes' int32 (6,)).
+
+        Returns:
+            Oldest-first records (empty if none or not streaming).
+        """
+        if self._stream_buffer is None:
+            return np.zeros(0, dtype=STREAM_RECORD_DTYPE)
+        return self._stream_buffer.read(max_samples)
+
+    def stream_to_measurement(self, records: np.ndarray) -> VoltageMeasurement:
+        """Average a block of streamed records into one VoltageMeasurement."""
+        if len(records) == 0:
+            raise ValueError("Cannot build a measurement from an empty block")
+        return self._codes_to_measurement(records["codes"].mean(axis=0))
+
+    @property
+    def stream_overruns(self) -> int:
+        return self._stream_buffer.overruns if self._stream_buffer is not None else 0
+
+    def _on_stream_block(self, block: StreamBlock) -> None:
+        """Reader thread: deframed block -> ring buffer (never blocks)."""
+        sequences, codes = block.to_arrays()
+        records = np.empty(len(sequences), dtype=STREAM_RECORD_DTYPE)
+        records["sequence"] = sequences
+        records["codes"] = codes
+        self._stream_buffer.write(records)
     
     def _convert_raw_to_volts(self, raw_code: int, channel: int) -> float:
         """
@@ -182,18 +346,10 @@ class ADS131A04Adapter(IAcquisitionPort):
         if not (-8388608 <= raw_code <= 8388607):
             raise ValueError(f"Invalid 24-bit ADC code: {raw_code}")
         
-        if self._current_config is None:
+        if self._channel_scales is None:
             raise RuntimeError("ADC not configured")
         
-        gain = self._current_config.channel_gains[channel]
-        vref = self._current_config.reference_voltage
-        
-        # ADS131A04 conversion formula (datasheet)
-        # V = (raw / 2^23) * (Vref / Gain)
-        # 2^23 because 24-bit signed (one bit for sign)
-        voltage = (raw_code / (2**23)) * (vref / gain)
-        
-        return voltage
+        return raw_code * float(self._channel_scales[channel - 1])
     
     def _estimate_uncertainty(self) -> float:
         """
@@ -205,17 +361,8 @@ class ADS131A04Adapter(IAcquisitionPort):
         Returns:
             Estimated measurement uncertainty in volts (±V)
         """
-        if self._current_config is None:
-            return 0.0
-        
-        vref = self._current_config.reference_voltage
-        gain = list(self._current_config.channel_gains.values())[0]  # Assume same for all
-        osr = self._current_config.oversampling_ratio
-        
-        # Uncertainty (quantization component) = Vref / (2^N · Gain · √OSR)
-        uncertainty = vref / (2**self.ADC_RESOLUTION_BITS * gain * math.sqrt(osr))
-        
-        return uncertainty
+        # Precomputed in _refresh_conversion (0.0 until configured)
+        return self._uncertainty_volts
     
     def is_ready(self) -> bool:
         """Check if ADC is ready for acquisition."""
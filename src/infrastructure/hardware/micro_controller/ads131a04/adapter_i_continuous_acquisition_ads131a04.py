@@ -4,11 +4,16 @@ ADS131A04 Continuous Acquisition Adapter
 Responsibility:
 - Implement IContinuousAcquisitionExecutor for the ADS131A04 hardware.
 - Manage the continuous acquisition loop using a background thread.
-- Publish events via the EventBus.
+- Write samples into a ContinuousSampleBuffer (drained by consumers) and
+  publish lifecycle events (failed, stopped) via the EventBus.
 
 Rationale:
 - Provides a concrete implementation for continuous acquisition specific to this hardware context.
-- Currently uses polling (threading) but can be extended to use hardware interrupts/streaming if available.
+- Uses the MCU binary stream when the acquisition port supports it
+  (one start command, records drained from a ring buffer); otherwise polls
+  the single-shot acquisition.
+- Both loops are paced by a DeadlineScheduler (absolute monotonic deadlines)
+  so the achieved rate does not drift below sample_rate_hz.
 """
 
 from __future__ import annotations
@@ -25,10 +30,19 @@ from application.services.continuous_acquisition_service.i_continuous_acquisitio
 from application.services.scan_application_service.i_acquisition_port import IAcquisitionPort
 from domain.events.i_domain_event_bus import IDomainEventBus
 from domain.events.continuous_acquisition_events import (
-    ContinuousAcquisitionSampleAcquired,
     ContinuousAcquisitionFailed,
     ContinuousAcquisitionStopped,
 )
+from domain.events.event_topics import (
+    CONTINUOUS_ACQUISITION_FAILED,
+    CONTINUOUS_ACQUISITION_STOPPED,
+)
+from application.services.continuous_acquisition_service.dtos.continuous_acquisition_dtos import (
+    ContinuousAcquisitionTimingStats,
+)
+from infrastructure.buffers.continuous_sample_buffer import ContinuousSampleBuffer
+from infrastructure.execution.deadline_scheduler import DeadlineScheduler
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import SequenceUnwrapper
 
 class AdapterIContinuousAcquisitionAds131a04(IContinuousAcquisitionExecutor):
     """
@@ -40,6 +54,8 @@ class AdapterIContinuousAcquisitionAds131a04(IContinuousAcquisitionExecutor):
         self._thread: Optional[threading.Thread] = None
         self._stop_flag = threading.Event()
         self._current_acquisition_id: Optional[UUID] = None
+        self._samples = ContinuousSampleBuffer()
+        self._scheduler: Optional[DeadlineScheduler] = None
 
     def start(self, config: ContinuousAcquisitionConfig, acquisition_port: IAcquisitionPort) -> None:
         """
@@ -49,6 +65,7 @@ class AdapterIContinuousAcquisitionAds131a04(IContinuousAcquisitionExecutor):
             return
 
         self._stop_flag.clear()
+        self._samples.clear()
         self._current_acquisition_id = uuid4()
         
         # Start background worker
@@ -68,9 +85,24 @@ class AdapterIContinuousAcquisitionAds131a04(IContinuousAcquisitionExecutor):
             self._thread = None
 
     def update_config(self, config: ContinuousAcquisitionConfig) -> None:
-        """Update configuration (not fully supported in this simple version yet)."""
-        # TODO: Implement dynamic config update if needed
-        pass
+        """Update configuration (only the sample rate is applied on the fly)."""
+        scheduler = self._scheduler
+        if scheduler is not None and config.sample_rate_hz and config.sample_rate_hz > 0:
+            scheduler.set_rate(config.sample_rate_hz)
+
+    def drain_samples(self, max_samples: Optional[int] = None):
+        """Buffered sample records (consumer side, see ContinuousSampleBuffer)."""
+        return self._samples.read(max_samples)
+
+    def get_sample_overruns(self) -> int:
+        return self._samples.overruns
+
+    def get_current_acquisition_id(self) -> Optional[UUID]:
+        return self._current_acquisition_id
+
+    def get_timing_stats(self) -> Optional[ContinuousAcquisitionTimingStats]:
+        scheduler = self._scheduler
+        return scheduler.stats() if scheduler is not None else None
 
     def _worker(
         self,
@@ -84,48 +116,118 @@ class AdapterIContinuousAcquisitionAds131a04(IContinuousAcquisitionExecutor):
             print("[ContinuousAcquisition] Invalid sample rate.")
             return
 
-        dt = 1.0 / config.sample_rate_hz
-        t0 = time.time()
+        supports_streaming = getattr(acquisition_port, "supports_streaming", None)
+        if callable(supports_streaming) and supports_streaming() is True:
+            self._stream_worker(acquisition_id, config, acquisition_port)
+            return
+
+        scheduler = DeadlineScheduler(config.sample_rate_hz)
+        self._scheduler = scheduler
+        t0 = time.monotonic()
         index = 0
 
         try:
+            scheduler.start()
             while not self._stop_flag.is_set():
                 # Check duration limit
-                if config.max_duration_s is not None and (time.time() - t0) > config.max_duration_s:
+                if config.max_duration_s is not None and (time.monotonic() - t0) > config.max_duration_s:
                     print("[ContinuousAcquisition] Max duration reached.")
                     break
 
+                if scheduler.wait_next(self._stop_flag) is None:
+                    break
+
                 # Acquire sample
                 # Note: In a real hardware streaming scenario, we might block here waiting for an interrupt
                 # or read from a buffer. For now, we poll the single-shot acquisition.
                 try:
+                    t_request = time.monotonic_ns()
                     sample = acquisition_port.acquire_sample()
+                    t_reply = time.monotonic_ns()
                 except Exception as e:
                     print(f"[ContinuousAcquisition] Error acquiring sample: {e}")
                     raise e
 
-                # Publish event
-                event = ContinuousAcquisitionSampleAcquired(
-                    acquisition_id=acquisition_id,
-                    sample_index=index,
-                    sample=sample,
-                )
-                self._event_bus.publish("continuousacquisitionsampleacquired", event)
+                # Never blocks: consumers drain the buffer on their own cadence.
+                # Sample instant taken at the middle of the request/reply.
+                self._samples.push(index, sample, monotonic_ns=(t_request + t_reply) // 2)
 
                 index += 1
                 
-                # Simple timing control (drift prone but sufficient for basic polling)
-                # For high precision, we would rely on hardware timing.
-                time.sleep(dt)
-                
         except Exception as e:
             print(f"[ContinuousAcquisition] Loop failed: {e}")
             error_event = ContinuousAcquisitionFailed(
                 acquisition_id=acquisition_id,
                 reason=str(e)
             )
-            self._event_bus.publish("continuousacquisitionfailed", error_event)
+            self._event_bus.publish(CONTINUOUS_ACQUISITION_FAILED, error_event)
+        finally:
+            self._log_timing(scheduler)
+            print("[ContinuousAcquisition] Worker stopping.")
+            stop_event = ContinuousAcquisitionStopped(acquisition_id=acquisition_id)
+            self._event_bus.publish(CONTINUOUS_ACQUISITION_STOPPED, stop_event)
+
+    def _stream_worker(
+        self,
+        acquisition_id: UUID,
+        config: ContinuousAcquisitionConfig,
+        acquisition_port: IAcquisitionPort,
+    ) -> None:
+        """
+        Streaming loop: the MCU pushes records at the ADC rate; every 1/sample_rate_hz
+        the records received since the last tick are averaged into one buffered sample,
+        tagged with the MCU counter of its last record.
+        """
+        scheduler = DeadlineScheduler(config.sample_rate_hz)
+        self._scheduler = scheduler
+        sequence = SequenceUnwrapper()
+        t0 = time.monotonic()
+        index = 0
+
+        try:
+            acquisition_port.start_streaming()
+            scheduler.start()
+            while not self._stop_flag.is_set():
+                if config.max_duration_s is not None and (time.monotonic() - t0) > config.max_duration_s:
+                    print("[ContinuousAcquisition] Max duration reached.")
+                    break
+
+                if scheduler.wait_next(self._stop_flag) is None:
+                    break
+                records = acquisition_port.read_stream()
+                if len(records) == 0:
+                    continue
+
+                self._samples.push(
+                    index,
+                    acquisition_port.stream_to_measurement(records),
+                    monotonic_ns=time.monotonic_ns(),
+                    mcu_counter=sequence.update(records["sequence"][-1]),
+                )
+                index += 1
+
+        except Exception as e:
+            print(f"[ContinuousAcquisition] Stream failed: {e}")
+            error_event = ContinuousAcquisitionFailed(
+                acquisition_id=acquisition_id,
+                reason=str(e)
+            )
+            self._event_bus.publish(CONTINUOUS_ACQUISITION_FAILED, error_event)
         finally:
+            try:
+                acquisition_port.stop_streaming()
+            except Exception as e:
+                print(f"[ContinuousAcquisition] Failed to stop stream: {e}")
+            self._log_timing(scheduler)
             print("[ContinuousAcquisition] Worker stopping.")
             stop_event = ContinuousAcquisitionStopped(acquisition_id=acquisition_id)
-            self._event_bus.publish("continuousacquisitionstopped", stop_event)
+            self._event_bus.publish(CONTINUOUS_ACQUISITION_STOPPED, stop_event)
+
+    @staticmethod
+    def _log_timing(scheduler: DeadlineScheduler) -> None:
+        stats = scheduler.stats()
+        print(
+            f"[ContinuousAcquisition] Rate {stats.achieved_rate_hz:.2f}/{stats.target_rate_hz:.2f} Hz, "
+            f"jitter mean {stats.jitter_mean_us:.0f} us / max {stats.jitter_max_us:.0f} us, "
+            f"skipped {stats.skipped_ticks}"
+        )
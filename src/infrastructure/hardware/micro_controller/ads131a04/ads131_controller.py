@@ -4,6 +4,10 @@ from infrastructure.hardware.micro_controller.MCU_serial_communicator import MCU
 class ADS131Controller:
     """
     Controller for ADS131A04 Acquisition Device.
+
+    Register writes go through write_registers(): registers whose last
+    written value is unchanged are skipped, the others are sent as one MCU
+    register transaction.
     """
     def __init__(self, serial_communicator=None):
         # Allow injection of existing communicator, or create new
@@ -16,10 +20,31 @@ class ADS131Controller:
             "ICLK_divider_ratio": 2,
             "Oversampling_ratio": 32
         }
+        # Last value written per register address (hardware shadow)
+        self._registers = {}
 
     def connect(self, port, baudrate=1500000):
+        # Hardware state unknown after (re)connection
+        self._registers.clear()
         return self.communicator.connect(port, baudrate)
 
+    def write_registers(self, writes, force=False) -> tuple[bool, str]:
+        """
+        Write raw (address, value) registers in one transaction, skipping
+        registers whose shadow value is unchanged (unless force).
+        """
+        changes = [(a, v) for a, v in writes if force or self._registers.get(a) != v]
+        if not changes:
+            return True, "Registers unchanged"
+        result = self.communicator.write_registers(changes)
+        for address, value in result.written:
+            self._registers[address] = value
+        for address, _ in result.failed:
+            self._registers.pop(address, None)
+        if not result.ok:
+            return False, result.error or "Register write failed"
+        return True, f"{len(changes)} register(s) written"
+
     def disconnect(self):
         self.communicator.disconnect()
 
@@ -49,9 +74,7 @@ class ADS131Controller:
         
         combined_value = (iclk_code * 32) + oversampling_code
         
-        success, response = self.communicator.send_command(f"a14")
-        if not success: return False, response
-        success, response = self.communicator.send_command(f"d{combined_value}")
+        success, response = self.write_registers([(14, combined_value)])
         if not success: return False, response
         
         self.memory_state["ICLK_divider_ratio"] = iclk_value
@@ -77,9 +100,7 @@ class ADS131Controller:
         if ref_voltage == 1: val_combinee += 16
         if ref_selection == 1: val_combinee += 8
         
-        success, response = self.communicator.send_command(f"a11")
-        if not success: return False, response
-        success, response = self.communicator.send_command(f"d{val_combinee}")
+        success, response = self.write_registers([(11, val_combinee)])
         if not success: return False, response
         
         return True, f"Références configurées (valeur: {val_combinee})"
@@ -96,6 +117,38 @@ class ADS131Controller:
         Returns:
             (success, message)
         """
+        valid, register = self._channel_gain_register(channel_index, gain)
+        if not valid:
+            return False, register
+        address, gain_code = register
+        
+        success, response = self.write_registers([(address, gain_code)])
+        if not success:
+            return False, f"Failed to write gain {gain} to address {address}: {response}"
+            
+        return True, f"Set Digital Gain {gain} (Code {gain_code}) for Register ADC{channel_index} (Addr {address})"
+
+    def set_channel_gains(self, gains: dict) -> tuple[bool, str]:
+        """
+        Set the Digital Gain of several ADCx registers in one transaction.
+        
+        Args:
+            gains: {channel_index (1-4): gain (1, 2, 4, 8, 16)}
+            
+        Returns:
+            (success, message)
+        """
+        writes = []
+        for channel_index, gain in gains.items():
+            valid, register = self._channel_gain_register(channel_index, gain)
+            if not valid:
+                return False, register
+            writes.append(register)
+        return self.write_registers(writes)
+
+    @staticmethod
+    def _channel_gain_register(channel_index: int, gain: int):
+        """(True, (address, gain_code)) of an ADCx gain, or (False, message)."""
         if channel_index not in [1, 2, 3, 4]:
             return False, f"Invalid channel index: {channel_index}"
             
@@ -114,18 +167,7 @@ class ADS131Controller:
         # ADC3: 13h (19d)
         # ADC4: 14h (20d)
         address = 16 + channel_index
-        
-        # 1. Set Address
-        success_a, resp_a = self.communicator.send_command(f"a{address}")
-        if not success_a:
-            return False, f"Failed to set address {address}: {resp_a}"
-            
-        # 2. Set Data
-        success_d, resp_d = self.communicator.send_command(f"d{gain_code}")
-        if not success_d:
-            return False, f"Failed to write gain {gain} to address {address}: {resp_d}"
-            
-        return True, f"Set Digital Gain {gain} (Code {gain_code}) for Register ADC{channel_index} (Addr {address})"
+        return True, (address, gain_code)
 
     def acquisition(self, n_avg=127):
         """
@@ -211,13 +211,13 @@ class ADS131A04AdvancedConfigurator(IHardwareAdvancedConfigurator):
         
         gain_map = {}
         for pair_idx in range(1, 5):
-            gain_val = int(config.get(f"gain_pair_{pair_idx}", 1))
-            gain_map[pair_idx] = gain_val
+            gain_map[pair_idx] = int(config.get(f"gain_pair_{pair_idx}", 1))
             
-            # Apply to hardware immediately via Controller
-            success, msg = self._controller.set_channel_gain(pair_idx, gain_val)
-            if not success:
-                print(f"[ADS131Configurator] Failed to set gain for pair {pair_idx}: {msg}")
+        # Apply to hardware immediately via Controller (one register transaction,
+        # unchanged gains skipped)
+        success, msg = self._controller.set_channel_gains(gain_map)
+        if not success:
+            print(f"[ADS131Configurator] Failed to set gains {gain_map}: {msg}")
             
         # Populate JSON config for Adapter (used for conversion)
         # We assume standard mapping:
@@ -0,0 +1,93 @@
+"""
+MCU Acquisition Profile - Infrastructure Layer
+
+Responsibility:
+- Hold the MCU acquisition parameters (n_avg) in memory, shared by the
+  MCU configurator (writer) and the ADS131A04 adapter (reader).
+- Load the last applied configuration (mcu_last_config.json) once.
+
+Rationale:
+- The adapter used to open and parse mcu_last_config.json on every sample
+  to obtain n_avg: ~640k file opens for a 6400-point scan with 100 averages.
+
+Design:
+- Immutable `McuAcquisitionSettings` snapshot swapped atomically by `update`:
+  readers get a consistent snapshot without locking.
+- `version` increments on every update, so readers can cache values derived
+  from the settings (e.g. the 'm{n_avg}' command) and rebuild them on change.
+- Listeners are notified after each update (change notification).
+"""
+
+import json
+import os
+import threading
+from dataclasses import dataclass, replace
+from typing import Callable, List, Optional
+
+LAST_CONFIG_PATH = os.path.join(os.path.dirname(__file__), "mcu_last_config.json")
+
+
+@dataclass(frozen=True)
+class McuAcquisitionSettings:
+    """MCU-side acquisition parameters."""
+    n_avg: int = 1  # software averaging on the MCU ('m{n_avg}' / stream start)
+
+
+class McuAcquisitionProfile:
+    """Versioned, change-notified holder of the current McuAcquisitionSettings."""
+
+    def __init__(self, settings: Optional[McuAcquisitionSettings] = None):
+        self._settings = settings or McuAcquisitionSettings()
+        self._version = 0
+        self._lock = threading.Lock()
+        self._listeners: List[Callable[[McuAcquisitionSettings], None]] = []
+
+    @classmethod
+    def load(cls, path: str = LAST_CONFIG_PATH) -> "McuAcquisitionProfile":
+        """Profile initialized from a saved MCU config file (defaults if missing/invalid)."""
+        settings = McuAcquisitionSettings()
+        try:
+            if os.path.exists(path):
+                with open(path, 'r') as f:
+                    saved = json.load(f)
+                settings = McuAcquisitionSettings(n_avg=int(saved.get("n_avg", 1)))
+        except Exception as e:
+            print(f"[McuAcquisitionProfile] Failed to read {path}, using defaults: {e}")
+        return cls(settings)
+
+    @property
+    def settings(self) -> McuAcquisitionSettings:
+        return self._settings
+
+    @property
+    def n_avg(self) -> int:
+        return self._settings.n_avg
+
+    @property
+    def version(self) -> int:
+        return self._version
+
+    def update(self, **changes) -> McuAcquisitionSettings:
+        """Replace some settings, bump the version and notify listeners."""
+        with self._lock:
+            settings = replace(self._settings, **changes)
+            if settings == self._settings:
+                return settings
+            self._settings = settings
+            self._version += 1
+            listeners = tuple(self._listeners)
+        for listener in listeners:
+            try:
+                listener(settings)
+            except Exception as e:
+                print(f"[McuAcquisitionProfile] Listener error: {e}")
+        return settings
+
+    def add_listener(self, listener: Callable[[McuAcquisitionSettings], None]) -> None:
+        with self._lock:
+            self._listeners.append(listener)
+
+    def remove_listener(self, listener: Callable[[McuAcquisitionSettings], None]) -> None:
+        with self._lock:
+            if listener in self._listeners:
+                self._listeners.remove(listener)
@@ -1,4 +1,4 @@
-from typing import List, Dict, Any
+from typing import List, Dict, Any, Optional
 import json
 import os
 from dataclasses import replace
@@ -8,6 +8,7 @@ from domain.value_objects.hardware_configuration.hardware_advanced_parameter_sch
     HardwareAdvancedParameterSchema, NumberParameterSchema
 )
 from infrastructure.hardware.micro_controller.MCU_serial_communicator import MCU_SerialCommunicator
+from infrastructure.hardware.micro_controller.mcu_acquisition_profile import McuAcquisitionProfile, LAST_CONFIG_PATH
 
 class MCUAdvancedConfigurator(IHardwareAdvancedConfigurator):
     """
@@ -17,18 +18,27 @@ class MCUAdvancedConfigurator(IHardwareAdvancedConfigurator):
     - Expose MCU parameters to the UI.
     - Update configuration files.
     - Store n_avg parameter for acquisition averaging.
+    - Push applied values to the shared McuAcquisitionProfile (read by the
+      acquisition adapter without file I/O).
     """
     
     # MCU acquisition averaging limits (from legacy code)
     NAVG_MIN = 1
     NAVG_MAX = 127
 
-    def __init__(self, serial_communicator: MCU_SerialCommunicator):
+    def __init__(self, serial_communicator: MCU_SerialCommunicator,
+                 profile: Optional[McuAcquisitionProfile] = None):
         """
         Args:
             serial_communicator: MCU serial communicator instance
+            profile: Shared MCU acquisition profile (loaded from the last config if omitted)
         """
         self._serial = serial_communicator
+        self._profile = profile if profile is not None else McuAcquisitionProfile.load()
+
+    @property
+    def profile(self) -> McuAcquisitionProfile:
+        return self._profile
 
     @property
     def hardware_id(self) -> str:
@@ -103,7 +113,7 @@ class MCUAdvancedConfigurator(IHardwareAdvancedConfigurator):
         
         # 3. Persist to JSON file
         try:
-            config_path = os.path.join(os.path.dirname(__file__), "mcu_last_config.json")
+            config_path = LAST_CONFIG_PATH
             with open(config_path, 'w') as f:
                 json.dump(json_config, f, indent=4)
             print(f"[MCUConfigurator] Config saved to {config_path}: n_avg={n_avg}")
@@ -111,6 +121,9 @@ class MCUAdvancedConfigurator(IHardwareAdvancedConfigurator):
             print(f"[MCUConfigurator] Failed to save config: {e}")
             raise
 
+        # 4. Publish to the in-memory profile (acquisition hot path)
+        self._profile.update(n_avg=n_avg)
+
     def save_config_as_default(self, config: Dict[str, Any]) -> None:
         """
         Save configuration as default.
@@ -135,22 +148,9 @@ class MCUAdvancedConfigurator(IHardwareAdvancedConfigurator):
     
     def get_n_avg(self) -> int:
         """
-        Get current n_avg value from saved configuration.
+        Get current n_avg value (last applied configuration).
         
         Returns:
             Current n_avg value (default: 1)
         """
-        try:
-            config_path = os.path.join(os.path.dirname(__file__), "mcu_last_config.json")
-            if os.path.exists(config_path):
-                with open(config_path, 'r') as f:
-                    saved_config = json.load(f)
-                    return int(saved_config.get("n_avg", 1))
-        except Exception as e:
-            print(f"[MCUConfigurator] Failed to read saved config: {e}")
-        
-        # Fallback to default
-        return 1
-
-
-
+        return self._profile.n_avg
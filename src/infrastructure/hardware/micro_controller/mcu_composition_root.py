@@ -32,6 +32,7 @@ from application.services.hardware_configuration_service.i_hardware_advanced_con
 
 from infrastructure.hardware.micro_controller.ads131a04.ads131a04_advanced_configurator import ADS131A04AdvancedConfigurator
 from infrastructure.hardware.micro_controller.mcu_advanced_configurator import MCUAdvancedConfigurator
+from infrastructure.hardware.micro_controller.mcu_acquisition_profile import McuAcquisitionProfile
 
 class MCUCompositionRoot:
     """
@@ -46,7 +47,8 @@ class MCUCompositionRoot:
       - AdapterIContinuousAcquisitionAds131a04 (continuous acquisition)
     """
 
-    def __init__(self, event_bus: IDomainEventBus, port: str = "COM10", baudrate: int = 1500000):
+    def __init__(self, event_bus: IDomainEventBus, port: str = "COM10", baudrate: int = 1500000,
+                 register_batch: bool = False, serial_factory=None):
         """
         Initialize the MCU hardware stack.
 
@@ -54,15 +56,24 @@ class MCUCompositionRoot:
             event_bus: Domain event bus (required for continuous acquisition)
             port: Serial port (e.g., 'COM10')
             baudrate: Serial baudrate
+            register_batch: Send register writes as framed batches
+                (requires MCU firmware support, see mcu_register_protocol)
+            serial_factory: serial.Serial-like constructor replacing pyserial
+                (e.g. SimulatedMcuSerial.factory(...) for load tests)
         """
         # 1. Instantiate Driver (Shared by all adapters)
         # Note: MCU_SerialCommunicator is a Singleton, but we can instantiate it.
         # Ideally we should use the instance.
         self._driver = MCU_SerialCommunicator()
+        self._driver.register_batch_enabled = register_batch
+        self._driver.serial_factory = serial_factory
         
+        # 1b. MCU acquisition parameters (n_avg), shared by configurator and adapter
+        self._mcu_profile = McuAcquisitionProfile.load()
+
         # 2. Instantiate Acquisition Adapter
         # Injects the driver
-        self.acquisition: IAcquisitionPort = ADS131A04Adapter(self._driver)
+        self.acquisition: IAcquisitionPort = ADS131A04Adapter(self._driver, self._mcu_profile)
         
         # 2b. Instantiate Acquisition Controller (for low-level config)
         from infrastructure.hardware.micro_controller.ads131a04.ads131_controller import ADS131Controller
@@ -80,7 +91,7 @@ class MCUCompositionRoot:
         self._ad9106_configurator = AD9106AdvancedConfigurator(self._ad9106_controller)
         
         # 3c. Instantiate MCU General Configurator
-        self._mcu_configurator = MCUAdvancedConfigurator(self._driver)
+        self._mcu_configurator = MCUAdvancedConfigurator(self._driver, self._mcu_profile)
         
         # 4. Instantiate Lifecycle Adapter
         # Injects the driver to manage connection
@@ -171,3 +182,13 @@ class MCUCompositionRoot:
         configs.append(self._ad9106_configurator)
         configs.append(self._mcu_configurator)
         return configs
+
+    def link_stats(self) -> dict:
+        """Serial link counters (exchanges, timeouts, errors + deframer counters of the stream)."""
+        stats = {
+            "exchanges": self._driver.exchanges,
+            "timeouts": self._driver.timeouts,
+            "errors": self._driver.errors,
+        }
+        stats.update(self._driver.stream_stats() or {})
+        return stats
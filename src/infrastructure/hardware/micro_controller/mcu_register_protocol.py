@@ -0,0 +1,111 @@
+"""
+MCU Register Batch Protocol - Infrastructure Layer
+
+Responsibility:
+- Define the framed "write N registers" transaction of the MCU serial link
+  and its single acknowledgement line (per-register status bitmap).
+- Describe the outcome of a register write sequence (RegisterWriteResult).
+
+Rationale:
+- The ASCII protocol selects then writes one register per command pair
+  ('a{addr}*', 'd{value}*'), each waiting for a response line: a 20-register
+  AD9106 configuration costs 40 serial round trips.
+
+Design:
+- Request frame (little-endian):
+    [0:2]   sync word 0xA5 0xB4
+    [2]     register count N, uint8 (1..MAX_BATCH_REGISTERS)
+    [3:3+4N] N x (address uint16, value uint16)
+    [-2:]   CRC-16/CCITT-FALSE of [2:3+4N]
+- Acknowledgement: one ASCII line 'B' + 8 hex digits, bit i set when
+  register i of the frame was written (e.g. 'B0000000f' for 4 registers).
+- The sync byte 0xA5 is not an ASCII command letter, so the MCU firmware can
+  dispatch on the first byte. Batches larger than MAX_BATCH_REGISTERS are split.
+- `decode_register_batch` / `encode_ack` reproduce the MCU side for
+  tests and simulation.
+"""
+
+import struct
+from dataclasses import dataclass
+from typing import Iterable, List, Optional, Sequence, Tuple
+
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import crc16
+
+BATCH_SYNC_WORD = b"\xA5\xB4"
+MAX_BATCH_REGISTERS = 32  # status bitmap is 32 bits
+ACK_PREFIX = "B"
+
+_ENTRY = struct.Struct("<HH")
+
+RegisterWrite = Tuple[int, int]  # (address, value)
+
+
+@dataclass(frozen=True)
+class RegisterWriteResult:
+    """Outcome of writing a list of registers."""
+    written: Tuple[RegisterWrite, ...] = ()
+    failed: Tuple[RegisterWrite, ...] = ()
+    error: Optional[str] = None
+
+    @property
+    def ok(self) -> bool:
+        return not self.failed and self.error is None
+
+
+def encode_register_batch(writes: Sequence[RegisterWrite]) -> bytes:
+    """Build one request frame for up to MAX_BATCH_REGISTERS (address, value) pairs."""
+    if not 1 <= len(writes) <= MAX_BATCH_REGISTERS:
+        raise ValueError(f"Batch must hold 1..{MAX_BATCH_REGISTERS} registers, got {len(writes)}")
+    body = bytearray((len(writes),))
+    for address, value in writes:
+        if not (0 <= address <= 0xFFFF and 0 <= value <= 0xFFFF):
+            raise ValueError(f"Register write out of range: a{address} d{value}")
+        body += _ENTRY.pack(address, value)
+    return BATCH_SYNC_WORD + bytes(body) + crc16(bytes(body)).to_bytes(2, "little")
+
+
+def decode_register_batch(frame: bytes) -> List[RegisterWrite]:
+    """
+    Decode a request frame (MCU side; tests and simulation).
+
+    Raises:
+        ValueError: On bad sync, length or CRC.
+    """
+    if frame[:2] != BATCH_SYNC_WORD or len(frame) < 5:
+        raise ValueError("Not a register batch frame")
+    count = frame[2]
+    end = 3 + count * _ENTRY.size
+    if len(frame) != end + 2:
+        raise ValueError(f"Register batch length mismatch ({len(frame)} bytes for {count} registers)")
+    if crc16(frame[2:end]) != int.from_bytes(frame[end:end + 2], "little"):
+        raise ValueError("Register batch CRC mismatch")
+    return [_ENTRY.unpack_from(frame, 3 + i * _ENTRY.size) for i in range(count)]
+
+
+def encode_ack(status: Iterable[bool]) -> str:
+    """Acknowledgement line for per-register statuses (MCU side; without line ending)."""
+    bitmap = 0
+    for i, written in enumerate(status):
+        if written:
+            bitmap |= 1 << i
+    return f"{ACK_PREFIX}{bitmap:08x}"
+
+
+def parse_ack(line: str, count: int) -> Tuple[bool, ...]:
+    """
+    Per-register statuses of an acknowledgement line.
+
+    Raises:
+        ValueError: If the line is not a batch acknowledgement.
+    """
+    line = line.strip()
+    if not line.startswith(ACK_PREFIX) or len(line) != len(ACK_PREFIX) + 8:
+        raise ValueError(f"Invalid register batch acknowledgement: '{line}'")
+    bitmap = int(line[len(ACK_PREFIX):], 16)
+    return tuple(bool(bitmap >> i & 1) for i in range(count))
+
+
+def iter_batches(writes: Sequence[RegisterWrite]) -> Iterable[Sequence[RegisterWrite]]:
+    """Split a register list into frames of at most MAX_BATCH_REGISTERS."""
+    for start in range(0, len(writes), MAX_BATCH_REGISTERS):
+        yield writes[start:start + MAX_BATCH_REGISTERS]
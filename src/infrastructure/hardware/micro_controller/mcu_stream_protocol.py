@@ -0,0 +1,196 @@
+"""
+MCU Binary Stream Protocol - Infrastructure Layer
+
+Responsibility:
+- Define the binary record format pushed by the MCU in streaming mode
+- Deframe a raw serial byte stream into validated records (sync, CRC, sequence)
+
+Rationale:
+- The ASCII 'm{n}' request/response costs one serial round trip and ~100
+  bytes of text per sample. In streaming mode the MCU pushes fixed 24-byte
+  frames continuously after a single start command.
+
+Design:
+- Frame (24 bytes):
+    [0:2]   sync word 0xA5 0x5A
+    [2:4]   sequence number, uint16 little-endian (wraps at 65536)
+    [4:22]  6 x int24 ADC codes, big-endian two's complement (ADC order)
+    [22:24] CRC-16/CCITT-FALSE of bytes [2:22], little-endian
+- The deframer only validates and concatenates good frames (stdlib, CRC in C
+  via binascii). Conversion to numpy arrays is done on whole blocks.
+- Resynchronisation: on a bad sync or CRC, skip to the next sync word.
+"""
+
+import binascii
+from dataclasses import dataclass
+from typing import List, Optional, Sequence, Tuple
+
+SYNC_WORD = b"\xA5\x5A"
+CHANNEL_COUNT = 6
+FRAME_SIZE = 24
+
+_PAYLOAD_START = 2
+_CODES_START = 4
+_CRC_START = 22
+
+# MCU commands (ASCII, same '*' terminator as the request/response protocol)
+STREAM_START_COMMAND = "s{n_avg}*"
+STREAM_STOP_COMMAND = "x*"
+
+INT24_MIN = -(1 << 23)
+INT24_MAX = (1 << 23) - 1
+
+
+def crc16(data: bytes) -> int:
+    """CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)."""
+    return binascii.crc_hqx(data, 0xFFFF)
+
+
+def encode_frame(sequence: int, codes: Sequence[int]) -> bytes:
+    """
+    Build one stream frame (MCU side format; used by tests and simulation).
+
+    Args:
+        sequence: Sample counter (taken modulo 65536).
+        codes: 6 signed 24-bit ADC codes.
+    """
+    if len(codes) != CHANNEL_COUNT:
+        raise ValueError(f"Expected {CHANNEL_COUNT} codes, got {len(codes)}")
+    body = bytearray((sequence & 0xFFFF).to_bytes(2, "little"))
+    for code in codes:
+        if not (INT24_MIN <= code <= INT24_MAX):
+            raise ValueError(f"Invalid 24-bit ADC code: {code}")
+        body += (code & 0xFFFFFF).to_bytes(3, "big")
+    return SYNC_WORD + bytes(body) + crc16(bytes(body)).to_bytes(2, "little")
+
+
+def decode_frame(frame: bytes) -> Tuple[int, Tuple[int, ...]]:
+    """Decode one validated frame into (sequence, codes). Scalar path, for debugging."""
+    sequence = int.from_bytes(frame[_PAYLOAD_START:_CODES_START], "little")
+    codes = tuple(
+        int.from_bytes(frame[i:i + 3], "big", signed=True)
+        for i in range(_CODES_START, _CRC_START, 3)
+    )
+    return sequence, codes
+
+
+@dataclass(frozen=True)
+class StreamBlock:
+    """Consecutive validated frames from one read, kept as raw bytes."""
+    payload: bytes  # count * FRAME_SIZE bytes, frame aligned
+
+    @property
+    def count(self) -> int:
+        return len(self.payload) // FRAME_SIZE
+
+    def to_arrays(self):
+        """
+        Vectorized decode of the whole block.
+
+        Returns:
+            (sequences, codes): uint16 array (n,), int32 array (n, 6)
+        """
+        import numpy as np
+
+        frames = np.frombuffer(self.payload, dtype=np.uint8).reshape(-1, FRAME_SIZE)
+        sequences = frames[:, _PAYLOAD_START].astype(np.uint16) | (
+            frames[:, _PAYLOAD_START + 1].astype(np.uint16) << 8
+        )
+        b = frames[:, _CODES_START:_CRC_START].reshape(-1, CHANNEL_COUNT, 3).astype(np.int32)
+        codes = (b[..., 0] << 16) | (b[..., 1] << 8) | b[..., 2]
+        codes = np.where(codes & 0x800000, codes - (1 << 24), codes).astype(np.int32)
+        return sequences, codes
+
+
+class SequenceUnwrapper:
+    """
+    Extend the 16-bit frame sequence into a monotonic MCU sample counter.
+
+    Assumes fewer than 65536 frames between two calls.
+    """
+
+    def __init__(self) -> None:
+        self._last: Optional[int] = None
+        self._counter = 0
+
+    def update(self, sequence: int) -> int:
+        """Return the unwrapped counter of the given (latest) sequence number."""
+        sequence = int(sequence) & 0xFFFF
+        if self._last is None:
+            self._counter = sequence
+        else:
+            self._counter += (sequence - self._last) & 0xFFFF
+        self._last = sequence
+        return self._counter
+
+
+class StreamDeframer:
+    """
+    Incremental deframer: feed raw chunks, get validated frame blocks.
+
+    Not thread-safe: owned by the serial reader thread.
+
+    Counters:
+    - frames: valid frames delivered
+    - crc_errors: candidate frames rejected by CRC
+    - lost_frames: frames missing according to the sequence numbers
+    - skipped_bytes: bytes discarded while searching for a sync word
+    """
+
+    def __init__(self) -> None:
+        self._buffer = bytearray()
+        self._last_sequence: Optional[int] = None
+        self.frames = 0
+        self.crc_errors = 0
+        self.lost_frames = 0
+        self.skipped_bytes = 0
+
+    def reset(self) -> None:
+        self._buffer.clear()
+        self._last_sequence = None
+
+    def feed(self, chunk: bytes) -> Optional[StreamBlock]:
+        """
+        Append a chunk and extract every complete valid frame.
+
+        Returns:
+            A StreamBlock, or None if no complete valid frame is available yet.
+        """
+        buf = self._buffer
+        buf += chunk
+        good: List[bytes] = []
+        pos = 0
+        end = len(buf)
+
+        while end - pos >= FRAME_SIZE:
+            if buf[pos] != 0xA5 or buf[pos + 1] != 0x5A:
+                next_sync = buf.find(SYNC_WORD, pos + 1)
+                if next_sync < 0:
+                    # Keep a trailing 0xA5: it may be the first half of a sync word
+                    next_sync = end - 1 if buf[end - 1] == 0xA5 else end
+                self.skipped_bytes += next_sync - pos
+                pos = next_sync
+                continue
+
+            frame = bytes(buf[pos:pos + FRAME_SIZE])
+            if crc16(frame[_PAYLOAD_START:_CRC_START]) != int.from_bytes(frame[_CRC_START:], "little"):
+                self.crc_errors += 1
+                self.skipped_bytes += 1
+                pos += 1
+                continue
+
+            self._track_sequence(int.from_bytes(frame[_PAYLOAD_START:_CODES_START], "little"))
+            good.append(frame)
+            pos += FRAME_SIZE
+
+        del buf[:pos]
+        if not good:
+            return None
+        self.frames += len(good)
+        return StreamBlock(payload=b"".join(good))
+
+    def _track_sequence(self, sequence: int) -> None:
+        if self._last_sequence is not None:
+            gap = (sequence - self._last_sequence - 1) & 0xFFFF
+            self.lost_frames += gap
+        self._last_sequence = sequence
@@ -0,0 +1,126 @@
+import unittest
+import sys
+import time
+import types
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+# pyserial is not needed behind the simulated port
+sys.modules.setdefault("serial", types.ModuleType("serial"))
+
+from infrastructure.hardware.micro_controller.MCU_serial_communicator import MCU_SerialCommunicator
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import FRAME_SIZE, StreamDeframer, decode_frame
+from infrastructure.hardware.simulation.simulated_mcu_serial import SimulatedMcuSerial
+from infrastructure.hardware.simulation.simulation_profile import SimulationProfile
+
+
+class TestSimulatedMcuSerialAscii(unittest.TestCase):
+    def setUp(self):
+        self.communicator = MCU_SerialCommunicator()
+        self.communicator.disconnect()
+        self.communicator.port = None
+
+    def tearDown(self):
+        self.communicator.disconnect()
+        self.communicator.port = None
+        self.communicator.serial_factory = None
+        self.communicator.register_batch_enabled = False
+
+    def _connect(self, **options):
+        self.communicator.serial_factory = SimulatedMcuSerial.factory(**options)
+        self.assertTrue(self.communicator.connect("sim://mcu", 1500000))
+        return self.communicator.ser
+
+    def test_sample_request_returns_averaged_codes_at_the_adc_rate(self):
+        self._connect(profile=SimulationProfile(sample_rate_hz=10000, seed=1))
+        start = time.monotonic()
+        ok, response = self.communicator.send_command("m200")
+        elapsed = time.monotonic() - start
+
+        self.assertTrue(ok)
+        codes = [int(x) for x in response.split("\t")]
+        self.assertEqual(len(codes), SimulatedMcuSerial.ASCII_CHANNELS)
+        for code, expected in zip(codes, SimulatedMcuSerial.DEFAULT_CODES):
+            self.assertAlmostEqual(code, expected, delta=100)
+        self.assertGreaterEqual(elapsed, 200 / 10000)
+
+    def test_signal_source_drives_the_codes(self):
+        self._connect(signal=lambda t: (1000, 2000, 3000, 4000, 5000, 6000), noise_codes=0.0)
+        ok, response = self.communicator.send_command("m1")
+        self.assertEqual(response, "1000\t2000\t3000\t4000\t5000\t6000\t0\t0")
+
+    def test_register_pairs_and_batches_are_written(self):
+        port = self._connect()
+        self.assertTrue(self.communicator.write_registers([(17, 2), (18, 3)]).ok)
+        self.communicator.register_batch_enabled = True
+        self.assertTrue(self.communicator.write_registers([(64, 10000), (65, 12)]).ok)
+        self.assertEqual(port.registers, {17: 2, 18: 3, 64: 10000, 65: 12})
+
+    def test_dropped_reply_times_out(self):
+        port = self._connect(profile=SimulationProfile(drop_rate=1.0))
+        port.write(b"m1*")
+        port.timeout = 0.05
+        self.assertEqual(port.readline(), b"m1\r\n")  # Confirmation is never dropped
+        self.assertEqual(port.readline(), b"")
+        self.assertEqual(port.stats()["dropped"], 1)
+
+    def test_latency_delays_the_reply(self):
+        port = self._connect(profile=SimulationProfile(latency_s=0.05))
+        start = time.monotonic()
+        port.write(b"a17*")
+        self.assertEqual(port.readline(), b"OK\r\n")
+        self.assertGreaterEqual(time.monotonic() - start, 0.05)
+
+
+class TestSimulatedMcuSerialStream(unittest.TestCase):
+    def _stream(self, port, n_avg, duration_s):
+        deframer = StreamDeframer()
+        frames = []
+        port.timeout = 0.02
+        port.write(f"s{n_avg}*".encode())
+        deadline = time.monotonic() + duration_s
+        stopped = False
+        while not stopped:
+            if time.monotonic() >= deadline:
+                port.write(b"x*")  # Producer joined: drain what is left
+                stopped = True
+            block = deframer.feed(port.read(max(port.in_waiting, FRAME_SIZE)))
+            if block is not None:
+                frames += [block.payload[i:i + FRAME_SIZE] for i in range(0, len(block.payload), FRAME_SIZE)]
+        port.close()
+        return frames, deframer
+
+    def test_stream_delivers_consecutive_frames_at_the_configured_rate(self):
+        port = SimulatedMcuSerial(profile=SimulationProfile(sample_rate_hz=4000, seed=2))
+        frames, deframer = self._stream(port, n_avg=2, duration_s=0.3)
+
+        sequences = [decode_frame(f)[0] for f in frames]
+        self.assertEqual(sequences, list(range(len(sequences))))
+        self.assertGreater(len(frames), 0.5 * 2000 * 0.3)
+        self.assertLessEqual(len(frames), 2000 * 0.3 + 10)
+        self.assertEqual((deframer.crc_errors, deframer.lost_frames), (0, 0))
+
+    def test_link_capacity_limits_the_frame_rate(self):
+        # 96000 baud carries 400 frames/s: the other 3600 samples/s are lost
+        port = SimulatedMcuSerial(baudrate=96000, profile=SimulationProfile(sample_rate_hz=4000))
+        frames, deframer = self._stream(port, n_avg=1, duration_s=0.3)
+        self.assertLessEqual(len(frames), 400 * 0.3 + 2)
+        self.assertGreater(port.stats()["overrun_frames"], 0)
+        self.assertGreater(deframer.lost_frames, 0)
+
+    def test_injected_faults_are_detected_by_the_deframer(self):
+        port = SimulatedMcuSerial(profile=SimulationProfile(
+            sample_rate_hz=4000, drop_rate=0.05, corrupt_rate=0.05, seed=7))
+        frames, deframer = self._stream(port, n_avg=1, duration_s=0.3)
+        stats = port.stats()
+        self.assertGreater(stats["dropped"], 0)
+        self.assertEqual(deframer.crc_errors, stats["corrupted"])
+        self.assertEqual(len(frames), stats["frames_sent"] - stats["corrupted"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,136 @@
+import unittest
+import sys
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from domain.value_objects.geometric.axis_motion_profile import AxisMotionProfile
+from infrastructure.hardware.arcus_performax_4EX.driver_arcus_performax4EX import ArcusPerformax4EXController
+from infrastructure.hardware.arcus_performax_4EX.performax_com_transport import (
+    PerformaxComError,
+    PerformaxComStage,
+    PerformaxComTransport,
+)
+from infrastructure.hardware.simulation.simulated_performax_lib import SimulatedPerformaxLib
+from infrastructure.hardware.simulation.simulation_profile import SimulationProfile
+
+
+class FakeClock:
+    def __init__(self):
+        self.now = 100.0
+        self.sleeps = []
+
+    def __call__(self):
+        return self.now
+
+    def sleep(self, seconds):
+        self.sleeps.append(seconds)
+        self.now += seconds
+
+
+class TestSimulatedPerformaxLib(unittest.TestCase):
+    def setUp(self):
+        self.clock = FakeClock()
+        self.lib = SimulatedPerformaxLib(clock=self.clock, sleep=self.clock.sleep)
+        self.stage = PerformaxComStage(PerformaxComTransport(lib=self.lib))
+
+    def tearDown(self):
+        self.stage.close()
+
+    def test_move_duration_matches_axis_motion_profile(self):
+        self.stage.send_recv_many(["LSX=10", "HSX=5000", "ACCX=300", "DECX=300"])
+        profile = AxisMotionProfile.from_step_parameters(10, 5000, 300, 300, mm_per_step=1.0)
+        for distance in (2000, 400):  # trapezoid, triangle
+            start = self.stage.get_position("x")
+            self.stage.move_to("x", start + distance)
+            duration = profile.move_time(distance)
+
+            self.clock.now += duration / 2
+            self.assertTrue(self.stage.is_moving("x"))
+            self.assertLess(self.stage.get_position("x"), start + distance)
+
+            self.clock.now += duration / 2 + 1e-9
+            self.assertFalse(self.stage.is_moving("x"))
+            self.assertEqual(self.stage.get_position("x"), start + distance)
+
+    def test_status_reports_ramps_and_home_switch(self):
+        self.assertIn("sw_minus_lim", self.stage.get_status("x"))
+        self.stage.move_to("x", 5000)
+        self.clock.now += 0.05  # Off the switch, still accelerating
+        self.assertEqual(set(self.stage.get_status("x")), {"accel", "moving"})
+        self.clock.now += 10.0
+        self.assertEqual(self.stage.get_status("x"), [])
+
+    def test_homing_returns_to_switch_and_reference_shifts_position(self):
+        self.lib.execute("X1500")
+        self.clock.now += 10.0
+        self.stage.home("x", direction="-", home_mode="only_home_input")
+        self.clock.now += 10.0
+        self.assertIn("sw_home", self.stage.get_status("x"))
+
+        self.stage.set_position_reference("x", 250)
+        self.assertEqual(self.stage.get_position("x"), 250)
+        self.stage.move_to("x", 300)
+        self.clock.now += 10.0
+        self.assertEqual(self.lib.execute("PX"), "300")
+
+    def test_incremental_mode_and_stop(self):
+        self.lib.execute("INC")
+        self.lib.execute("Y1000")
+        self.clock.now += 0.2
+        self.lib.execute("STOPY")
+        stopped = self.stage.get_position("y")
+        self.assertGreater(stopped, 0)
+        self.assertLess(stopped, 1000)
+        self.clock.now += 10.0
+        self.assertEqual(self.stage.get_position("y"), stopped)
+
+    def test_unknown_command_is_a_device_error(self):
+        with self.assertRaises(PerformaxComError):
+            self.stage.query("BOGUS")
+
+    def test_controller_runs_unchanged_on_the_simulated_dll(self):
+        controller = ArcusPerformax4EXController(backend="native", lib=SimulatedPerformaxLib())
+        self.assertTrue(controller.connect())
+        try:
+            self.assertTrue(controller.is_homed("x"))
+            self.assertEqual(controller.get_axis_params("x"), ArcusPerformax4EXController.DEFAULT_PARAMS["X"])
+            self.assertEqual(controller.get_motion_snapshot()[:2], (0, 0))
+        finally:
+            controller.disconnect()
+
+
+class TestSimulatedPerformaxFaults(unittest.TestCase):
+    def _stage(self, profile):
+        clock = FakeClock()
+        lib = SimulatedPerformaxLib(profile=profile, clock=clock, sleep=clock.sleep)
+        transport = PerformaxComTransport(lib=lib)
+        transport.open()
+        return transport, lib, clock
+
+    def test_error_rate_produces_error_replies(self):
+        transport, lib, _ = self._stage(SimulationProfile(error_rate=1.0))
+        with self.assertRaises(PerformaxComError):
+            transport.send_recv("PX")
+        self.assertEqual(lib.fault_counts()["errors"], 1)
+
+    def test_drop_rate_times_out_the_round_trip(self):
+        transport, _, clock = self._stage(SimulationProfile(drop_rate=1.0))
+        with self.assertRaises(PerformaxComError):
+            transport.send_recv("PX")
+        self.assertEqual(clock.sleeps, [PerformaxComTransport.DEFAULT_READ_TIMEOUT_MS / 1000.0])
+
+    def test_latency_and_jitter_delay_each_round_trip(self):
+        transport, _, clock = self._stage(SimulationProfile(latency_s=0.001, jitter_s=0.002, seed=3))
+        transport.send_recv_many(["PX", "PY", "MST"])
+        self.assertEqual(len(clock.sleeps), 3)
+        for delay in clock.sleeps:
+            self.assertGreaterEqual(delay, 0.001)
+            self.assertLessEqual(delay, 0.003)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,372 @@
+"""
+Simulated MCU Serial Port - Infrastructure Layer
+
+Responsibility:
+- Stand in for the pyserial port opened by MCU_SerialCommunicator: same
+  methods and attributes (write, read, readline, in_waiting, timeout,
+  reset_input_buffer, close, is_open).
+- Emulate the MCU firmware behind it: ASCII 'm{n}' acquisition, 'a{addr}' /
+  'd{value}' register writes, framed register batches and the binary
+  's{n_avg}' / 'x' stream.
+
+Rationale:
+- The mocks return one Python object per sample: they never load the
+  serial reader, the deframer, the ring buffer or the numpy conversion.
+  Behind this port the whole acquisition stack runs unchanged, at the rate,
+  latency and fault level of a SimulationProfile.
+
+Design:
+- Replies are queued with the time they "arrive" on the host; reads block
+  on a Condition until the bytes are due or `timeout` expires (pyserial
+  semantics: partial data on timeout, b'' when nothing arrived).
+- 'm{n}': confirmation line at once, data line (8 tab separated codes) after
+  n conversions at sample_rate_hz; conversions never overlap.
+- Stream: a producer thread emits encode_frame() frames at
+  sample_rate_hz / n_avg, capped by the link (8N1: baudrate / 10 bytes/s):
+  frames the link cannot carry are lost, like a firmware TX overrun. Dropped
+  frames keep their sequence number, corrupted frames fail the CRC.
+- Signal: `signal(t)` gives the 6 mean codes at device time t (default:
+  constant codes); noise is drawn from a precomputed normal table scaled by
+  noise_codes / sqrt(n_avg).
+"""
+
+from collections import deque
+import functools
+import math
+import random
+import threading
+import time
+from typing import Callable, Deque, Dict, Optional, Sequence, Tuple
+
+from infrastructure.hardware.micro_controller.mcu_register_protocol import (
+    BATCH_SYNC_WORD,
+    decode_register_batch,
+    encode_ack,
+)
+from infrastructure.hardware.micro_controller.mcu_stream_protocol import (
+    CHANNEL_COUNT,
+    FRAME_SIZE,
+    INT24_MAX,
+    INT24_MIN,
+    encode_frame,
+)
+from infrastructure.hardware.simulation.simulation_profile import FaultInjector, SimulationProfile
+
+SignalSource = Callable[[float], Sequence[float]]
+
+# Register batch entry: uint16 address + uint16 value (mcu_register_protocol)
+_BATCH_ENTRY_SIZE = 4
+
+
+class SimulatedMcuSerial:
+    """
+    pyserial-compatible port backed by an emulated MCU firmware.
+    """
+
+    ASCII_CHANNELS = 8  # 'm{n}' replies carry both ADS131A04 (8 channels)
+    DEFAULT_CODES = (400000, -120000, 250000, 80000, -300000, 50000)
+    DEFAULT_NOISE_CODES = 150.0
+    NOISE_TABLE_SIZE = 4099  # Prime: no short period against 6 channels
+
+    RX_BUFFER_SIZE = 1 << 20  # Host driver buffer; stream bytes beyond it are lost
+    STREAM_TICK_S = 0.002
+
+    def __init__(
+        self,
+        port: str = "sim://mcu",
+        baudrate: int = 1500000,
+        timeout: Optional[float] = 1,
+        write_timeout: Optional[float] = 1,
+        profile: Optional[SimulationProfile] = None,
+        signal: Optional[SignalSource] = None,
+        noise_codes: float = DEFAULT_NOISE_CODES,
+        clock: Callable[[], float] = time.monotonic,
+        **serial_options,
+    ):
+        """
+        Open the simulated port (same keyword arguments as serial.Serial).
+
+        Args:
+            profile: Sample rate, latency, jitter and faults.
+            signal: Mean codes of channels 1-6 at device time t (s since open).
+            noise_codes: Standard deviation of one conversion, in codes.
+            clock: Time source (seconds); must match the Condition waits.
+        """
+        self.port = port
+        self.baudrate = baudrate
+        self.timeout = timeout
+        self.write_timeout = write_timeout
+        self.is_open = True
+
+        self._profile = profile or SimulationProfile()
+        self._faults = FaultInjector(self._profile)
+        self._signal = signal or (lambda t: self.DEFAULT_CODES)
+        self._noise_codes = noise_codes
+        rng = random.Random(self._profile.seed)
+        self._noise = [rng.gauss(0.0, 1.0) for _ in range(self.NOISE_TABLE_SIZE)]
+        self._noise_index = 0
+        self._clock = clock
+        self._t0 = clock()
+
+        self._cond = threading.Condition()
+        self._buffer = bytearray()  # Arrived on the host, readable
+        self._pending: Deque[Tuple[float, bytes]] = deque()  # (arrival time, bytes)
+        self._last_arrival = 0.0
+        self._rx = bytearray()  # Written by the host, not parsed yet
+        self._adc_busy_until = 0.0
+
+        self._address: Optional[int] = None
+        self.registers: Dict[int, int] = {}
+
+        self._stream_thread: Optional[threading.Thread] = None
+        self._stream_requests = []  # n_avg to start, 0 to stop (parsed under the Condition)
+        self._stream_stop = threading.Event()
+        self._stats = {"frames_sent": 0, "overrun_frames": 0, "overflow_bytes": 0, "samples": 0}
+
+    @classmethod
+    def factory(cls, **options) -> Callable[..., "SimulatedMcuSerial"]:
+        """serial.Serial-like constructor with simulation options bound."""
+        return functools.partial(cls, **options)
+
+    # ============================================================================
+    # PYSERIAL API
+    # ============================================================================
+
+    def write(self, data: bytes) -> int:
+        if not self.is_open:
+            raise IOError("Simulated port is closed")
+        with self._cond:
+            self._rx += data
+            self._parse()
+            stream_requests, self._stream_requests = self._stream_requests, []
+        # The producer thread takes the Condition: start/stop it without holding it
+        for n_avg in stream_requests:
+            self._stop_stream()
+            if n_avg:
+                self._start_stream(n_avg)
+        return len(data)
+
+    def read(self, size: int = 1) -> bytes:
+        with self._cond:
+            self._wait(lambda: len(self._buffer) >= size)
+            return self._take(min(size, len(self._buffer)))
+
+    def readline(self) -> bytes:
+        with self._cond:
+            self._wait(lambda: b"\n" in self._buffer)
+            end = self._buffer.find(b"\n")
+            return self._take(len(self._buffer) if end < 0 else end + 1)
+
+    @property
+    def in_waiting(self) -> int:
+        with self._cond:
+            self._release(self._clock())
+            return len(self._buffer)
+
+    def reset_input_buffer(self) -> None:
+        """Discard what already arrived (bytes still in flight arrive later)."""
+        with self._cond:
+            self._release(self._clock())
+            self._buffer.clear()
+
+    def reset_output_buffer(self) -> None:
+        pass
+
+    def flush(self) -> None:
+        pass
+
+    def close(self) -> None:
+        self._stop_stream()
+        with self._cond:
+            self.is_open = False
+            self._cond.notify_all()
+
+    # ============================================================================
+    # QUERIES - Simulation side
+    # ============================================================================
+
+    def stats(self) -> Dict[str, int]:
+        """Emitted frames, link overruns, host buffer overflows and injected faults."""
+        with self._cond:
+            stats = dict(self._stats)
+        stats.update(self._faults.counts())
+        return stats
+
+    # ============================================================================
+    # HOST SIDE - Buffering
+    # ============================================================================
+
+    def _wait(self, ready: Callable[[], bool]) -> None:
+        """Wait (holding the Condition) until ready() or the read timeout."""
+        deadline = None if self.timeout is None else self._clock() + self.timeout
+        while True:
+            now = self._clock()
+            self._release(now)
+            if ready() or not self.is_open:
+                return
+            wait = None if deadline is None else deadline - now
+            if wait is not None and wait <= 0:
+                return
+            if self._pending:
+                next_arrival = self._pending[0][0] - now
+                wait = next_arrival if wait is None else min(wait, next_arrival)
+            self._cond.wait(wait)
+
+    def _release(self, now: float) -> None:
+        while self._pending and self._pending[0][0] <= now:
+            data = self._pending.popleft()[1]
+            room = self.RX_BUFFER_SIZE - len(self._buffer)
+            if len(data) > room:
+                self._stats["overflow_bytes"] += len(data) - room
+                data = data[:room]
+            self._buffer += data
+
+    def _take(self, count: int) -> bytes:
+        data = bytes(self._buffer[:count])
+        del self._buffer[:count]
+        return data
+
+    def _send(self, data: bytes, ready_at: float) -> None:
+        """Queue bytes for the host; the link keeps them in order (caller holds the Condition)."""
+        arrival = max(ready_at + self._faults.reply_delay_s(), self._last_arrival)
+        self._last_arrival = arrival
+        self._pending.append((arrival, data))
+        self._cond.notify_all()
+
+    def _send_line(self, line: str, ready_at: float, faults: bool = True) -> None:
+        if faults:
+            if self._faults.drop():
+                return
+            if line and self._faults.corrupt():
+                position = self._faults.randrange(len(line))
+                line = line[:position] + "#" + line[position + 1:]
+        self._send((line + "\r\n").encode("ascii"), ready_at)
+
+    # ============================================================================
+    # FIRMWARE SIDE - Command interpreter
+    # ============================================================================
+
+    def _parse(self) -> None:
+        """Consume complete commands and batch frames from the host bytes."""
+        rx = self._rx
+        while rx:
+            if rx[:1] == BATCH_SYNC_WORD[:1]:
+                if len(rx) < 3:
+                    return
+                if rx[:2] == BATCH_SYNC_WORD:
+                    size = 3 + rx[2] * _BATCH_ENTRY_SIZE + 2
+                    if len(rx) < size:
+                        return
+                    frame = bytes(rx[:size])
+                    del rx[:size]
+                    self._on_register_batch(frame)
+                    continue
+            end = rx.find(b"*")
+            if end < 0:
+                return
+            command = rx[:end].decode("ascii", errors="replace").strip()
+            del rx[:end + 1]
+            self._on_command(command)
+
+    def _on_command(self, command: str) -> None:
+        now = self._clock()
+        head, argument = command[:1], command[1:]
+        if head == "m" and argument.isdigit():
+            self._send_line(command, now, faults=False)  # Confirmation
+            self._on_sample_request(max(int(argument), 1), now)
+        elif head == "s" and argument.isdigit():
+            self._stream_requests.append(max(int(argument), 1))
+        elif command == "x":
+            self._stream_requests.append(0)
+        elif head == "a" and argument.isdigit():
+            self._address = int(argument)
+            self._send_line("OK", now)
+        elif head == "d" and argument.isdigit() and self._address is not None:
+            self.registers[self._address] = int(argument)
+            self._send_line("OK", now)
+        elif command:
+            self._send_line("ERR", now)
+
+    def _on_register_batch(self, frame: bytes) -> None:
+        try:
+            writes = decode_register_batch(frame)
+        except ValueError:
+            self._send_line(encode_ack(()), self._clock())
+            return
+        for address, value in writes:
+            self.registers[address] = value
+        self._send_line(encode_ack([True] * len(writes)), self._clock())
+
+    def _on_sample_request(self, n_avg: int, now: float) -> None:
+        start = max(now, self._adc_busy_until)
+        done = start + n_avg / self._profile.sample_rate_hz
+        self._adc_busy_until = done
+        self._stats["samples"] += 1
+        codes = self._codes(done - self._t0, n_avg)
+        line = "\t".join(str(c) for c in codes) + "\t0" * (self.ASCII_CHANNELS - CHANNEL_COUNT)
+        self._send_line(line, done)
+
+    def _codes(self, t: float, n_avg: int) -> Tuple[int, ...]:
+        """6 averaged codes at device time t."""
+        sigma = self._noise_codes / math.sqrt(n_avg)
+        noise, index = self._noise, self._noise_index
+        codes = []
+        for mean in self._signal(t)[:CHANNEL_COUNT]:
+            index = (index + 1) % self.NOISE_TABLE_SIZE
+            code = int(round(mean + sigma * noise[index]))
+            codes.append(min(max(code, INT24_MIN), INT24_MAX))
+        self._noise_index = index
+        return tuple(codes)
+
+    # ============================================================================
+    # FIRMWARE SIDE - Binary stream
+    # ============================================================================
+
+    def _start_stream(self, n_avg: int) -> None:
+        self._stream_stop.clear()
+        self._stream_thread = threading.Thread(
+            target=self._stream_loop, args=(n_avg,), daemon=True, name="Simulated_MCU_Stream"
+        )
+        self._stream_thread.start()
+
+    def _stop_stream(self) -> None:
+        thread = self._stream_thread
+        if thread is None:
+            return
+        self._stream_stop.set()
+        thread.join(timeout=1.0)
+        self._stream_thread = None
+
+    def _stream_loop(self, n_avg: int) -> None:
+        frame_rate = self._profile.sample_rate_hz / n_avg
+        link_rate = self.baudrate / 10.0 / FRAME_SIZE
+        period = 1.0 / frame_rate
+        start = self._clock()
+        produced = sent = 0
+        while not self._stream_stop.wait(self.STREAM_TICK_S):
+            now = self._clock()
+            due = int((now - start) * frame_rate) - produced
+            if due <= 0:
+                continue
+            link_capacity = int((now - start) * link_rate)
+            chunk = bytearray()
+            overruns = 0
+            for _ in range(due):
+                sequence = produced
+                produced += 1
+                if sent >= link_capacity:
+                    overruns += 1
+                    continue
+                sent += 1
+                if self._faults.drop():
+                    continue
+                frame = encode_frame(sequence, self._codes(start - self._t0 + sequence * period, n_avg))
+                if self._faults.corrupt():
+                    frame = bytearray(frame)
+                    frame[2 + self._faults.randrange(FRAME_SIZE - 4)] ^= 0xFF
+                chunk += frame
+            with self._cond:
+                self._stats["frames_sent"] += len(chunk) // FRAME_SIZE
+                self._stats["overrun_frames"] += overruns
+                if chunk:
+                    self._send(bytes(chunk), now)
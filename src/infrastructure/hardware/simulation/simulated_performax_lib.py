@@ -0,0 +1,344 @@
+"""
+Simulated PerformaxCom.dll - Infrastructure Layer
+
+Responsibility:
+- Stand in for PerformaxCom.dll behind PerformaxComTransport(lib=...): same
+  entry points, BOOL returns and 64-byte ASCII buffers as DLL64/PerformaxCom.h.
+- Emulate the Performax 4EX command subset driven by
+  ArcusPerformax4EXController, with trapezoidal axis kinematics.
+
+Rationale:
+- The whole motion stack (controller RLock, status poller, ArcusAdapter
+  worker, domain events) runs unchanged; only the USB device is emulated.
+
+Design:
+- Commands: ABS/INC, IERR, CLR{A}, EO{n}[=v], MST, P{A}[=v], E{A},
+  LS/HS/ACC/DEC{A}[=v], {A}{pos}, H{A}{+|-}{mode}, STOP/ABORT[{A}], ID.
+  Set commands reply "OK", queries their value, unknown commands "?...".
+- A move starts at LS, ramps to HS in ACC ms and stops in DEC ms (same
+  model as AxisMotionProfile); positions and MST are computed from the
+  clock at query time, no thread.
+- The home / minus-limit switch sits at mechanical position 0: homing moves
+  there, moves below it stop on it. P{A}=v only shifts the reported position.
+- STOP and ABORT both stop the axis where it is; a new move while moving
+  restarts from the current position at LS.
+- Faults (SimulationProfile): error_rate -> '?' reply, drop_rate -> SendRecv
+  fails after the read timeout (USB timeout); latency/jitter per round trip.
+"""
+
+import ctypes
+import math
+import re
+import threading
+import time
+from typing import Callable, Dict, Optional
+
+from infrastructure.hardware.simulation.simulation_profile import FaultInjector, SimulationProfile
+
+STATUS_ACCEL = 0x001
+STATUS_DECEL = 0x002
+STATUS_MOVING = 0x004
+STATUS_MINUS_LIMIT = 0x020
+STATUS_HOME = 0x040
+STATUS_ERR_MINUS_LIMIT = 0x100
+
+_MOVE = re.compile(r"^([XYZU])(-?\d+)$")
+_HOME = re.compile(r"^H([XYZU])([+-])(\d)$")
+_PARAM = re.compile(r"^(LS|HS|ACC|DEC)([XYZU])(?:=(\d+))?$")
+_POSITION = re.compile(r"^([PE])([XYZU])(?:=(-?\d+))?$")
+_ENABLE = re.compile(r"^EO([1-4])(?:=([01]))?$")
+_STOP = re.compile(r"^(STOP|ABORT)([XYZU]?)$")
+
+
+class _Move:
+    """Trapezoidal (or triangular) move from `start` to `target` started at `t0`."""
+
+    def __init__(self, start: float, target: float, t0: float, ls: int, hs: int, acc_ms: int, dec_ms: int):
+        self.start = start
+        self.target = target
+        self.t0 = t0
+        distance = abs(target - start)
+        self._sign = 1.0 if target >= start else -1.0
+
+        v0 = min(ls, hs)
+        dv = hs - v0
+        accel_s, decel_s = acc_ms / 1000.0, dec_ms / 1000.0
+        if distance == 0:
+            v0 = peak = float(hs)
+            ta = tc = td = 0.0
+        elif dv <= 0 or accel_s + decel_s == 0:
+            v0 = peak = float(hs)
+            ta = td = 0.0
+            tc = distance / hs
+        else:
+            ramp_distance = (v0 + hs) / 2.0 * (accel_s + decel_s)
+            if distance >= ramp_distance:
+                peak, ta, td = float(hs), accel_s, decel_s
+                tc = (distance - ramp_distance) / hs
+            else:
+                k = (accel_s + decel_s) / dv
+                peak = math.sqrt(v0 * v0 + 2.0 * distance / k)
+                ta, td, tc = (peak - v0) / dv * accel_s, (peak - v0) / dv * decel_s, 0.0
+
+        self._v0, self._peak = float(v0), peak
+        self._ta, self._tc, self._td = ta, tc, td
+        self._accel_distance = (v0 + peak) / 2.0 * ta
+        self.duration = ta + tc + td
+
+    def position(self, t: float) -> float:
+        tau = t - self.t0
+        if tau >= self.duration:
+            return self.target
+        if tau <= 0:
+            return self.start
+        v0, peak = self._v0, self._peak
+        if tau < self._ta:
+            s = v0 * tau + 0.5 * (peak - v0) / self._ta * tau * tau
+        elif tau < self._ta + self._tc:
+            s = self._accel_distance + peak * (tau - self._ta)
+        else:
+            u = tau - self._ta - self._tc
+            s = self._accel_distance + peak * self._tc + peak * u - 0.5 * (peak - v0) / self._td * u * u
+        return self.start + self._sign * s
+
+    def status(self, t: float) -> int:
+        tau = t - self.t0
+        if tau >= self.duration:
+            return 0
+        if tau < self._ta:
+            return STATUS_MOVING | STATUS_ACCEL
+        if tau >= self._ta + self._tc:
+            return STATUS_MOVING | STATUS_DECEL
+        return STATUS_MOVING
+
+
+class _Axis:
+    """State of one emulated axis (mechanical position in pulses)."""
+
+    def __init__(self, position: float):
+        self.params: Dict[str, int] = dict(SimulatedPerformaxLib.DEFAULT_PARAMS)
+        self.position = position  # Mechanical position when idle
+        self.offset = 0  # Reported = mechanical + offset
+        self.move: Optional[_Move] = None
+        self.errors = 0
+        self.enabled = 0
+
+    def mechanical(self, t: float) -> float:
+        if self.move is None:
+            return self.position
+        if t >= self.move.t0 + self.move.duration:
+            self.position, self.move = self.move.target, None
+            return self.position
+        return self.move.position(t)
+
+    def status(self, t: float) -> int:
+        status = self.move.status(t) if self.move is not None else 0
+        if round(self.mechanical(t)) <= 0:
+            status |= STATUS_MINUS_LIMIT | STATUS_HOME
+        return status | self.errors
+
+    def start_move(self, target: float, t: float) -> None:
+        start = self.mechanical(t)
+        if target < 0:
+            target = 0.0
+            self.errors |= STATUS_ERR_MINUS_LIMIT
+        p = self.params
+        self.move = _Move(start, target, t, p["LS"], p["HS"], p["ACC"], p["DEC"])
+        self.position = start
+
+    def stop(self, t: float) -> None:
+        self.position = float(round(self.mechanical(t)))
+        self.move = None
+
+
+class SimulatedPerformaxLib:
+    """
+    PerformaxCom.dll entry points on top of an emulated Performax 4EX.
+    """
+
+    AXES = ("X", "Y", "Z", "U")
+    DEFAULT_PARAMS = {"LS": 10, "HS": 1000, "ACC": 300, "DEC": 300}
+    PRODUCT_STRING = "Performax-4EX (simulated)"
+
+    def __init__(
+        self,
+        profile: Optional[SimulationProfile] = None,
+        device_count: int = 1,
+        start_positions: Optional[Dict[str, int]] = None,
+        clock: Callable[[], float] = time.monotonic,
+        sleep: Callable[[float], None] = time.sleep,
+    ):
+        """
+        Args:
+            profile: Latency, jitter and faults (default: ideal device).
+            device_count: Controllers reported by fnPerformaxComGetNumDevices.
+            start_positions: Mechanical start position per axis (default 0,
+                i.e. on the home switch).
+            clock: Time source of the kinematics (seconds).
+            sleep: Used for latency and timeouts (injectable for tests).
+        """
+        self._faults = FaultInjector(profile or SimulationProfile())
+        self._device_count = device_count
+        self._clock = clock
+        self._sleep = sleep
+        self._lock = threading.Lock()
+        start_positions = start_positions or {}
+        self._axes = {a: _Axis(float(start_positions.get(a, 0))) for a in self.AXES}
+        self._absolute = True
+        self._open_handles = set()
+        self._read_timeout_ms = 1000
+        self.round_trips = 0
+
+    # ============================================================================
+    # DLL ENTRY POINTS (PerformaxCom.h)
+    # ============================================================================
+
+    def fnPerformaxComGetNumDevices(self, num_devices) -> int:
+        _store(num_devices, self._device_count)
+        return 1
+
+    def fnPerformaxComGetProductString(self, device_index, device_string, options) -> int:
+        if device_index >= self._device_count:
+            return 0
+        data = self.PRODUCT_STRING.encode("ascii") + b"\x00"
+        ctypes.memmove(device_string, data, len(data))
+        return 1
+
+    def fnPerformaxComSetTimeouts(self, read_timeout_ms, write_timeout_ms) -> int:
+        self._read_timeout_ms = int(read_timeout_ms)
+        return 1
+
+    def fnPerformaxComOpen(self, device_index, handle) -> int:
+        device_index = int(device_index)
+        with self._lock:
+            if device_index >= self._device_count or device_index in self._open_handles:
+                return 0
+            self._open_handles.add(device_index)
+        _store(handle, device_index + 1)
+        return 1
+
+    def fnPerformaxComClose(self, handle) -> int:
+        with self._lock:
+            if not self._is_open(handle):
+                return 0
+            self._open_handles.discard(_load(handle) - 1)
+        return 1
+
+    def fnPerformaxComFlush(self, handle) -> int:
+        return 1 if self._is_open(handle) else 0
+
+    def fnPerformaxComSendRecv(self, handle, w_buffer, n_write, n_read, r_buffer) -> int:
+        if not self._is_open(handle):
+            return 0
+        command = ctypes.string_at(w_buffer, int(n_write)).split(b"\x00", 1)[0]
+        delay = self._faults.reply_delay_s()
+        if self._faults.drop():
+            self._sleep(self._read_timeout_ms / 1000.0)
+            return 0
+        if delay:
+            self._sleep(delay)
+
+        if self._faults.error():
+            reply = "?Simulated fault"
+        else:
+            with self._lock:
+                self.round_trips += 1
+                reply = self.execute(command.decode("ascii", errors="replace"))
+        data = reply.encode("ascii")[: max(int(n_read) - 1, 0)] + b"\x00"
+        ctypes.memmove(r_buffer, data, len(data))
+        return 1
+
+    # ============================================================================
+    # DEVICE - Command interpreter
+    # ============================================================================
+
+    def execute(self, command: str) -> str:
+        """Reply of the emulated controller to one ASCII command."""
+        command = command.strip().upper()
+        now = self._clock()
+
+        if command in ("ABS", "INC"):
+            self._absolute = command == "ABS"
+            return "OK"
+        if command.startswith("IERR="):
+            return "OK"
+        if command == "ID":
+            return self.PRODUCT_STRING
+        if command == "MST":
+            return ":".join(str(self._axes[a].status(now)) for a in self.AXES)
+        if command.startswith("CLR") and command[3:] in self.AXES:
+            self._axes[command[3:]].errors = 0
+            return "OK"
+
+        match = _POSITION.match(command)
+        if match:
+            axis = self._axes[match.group(2)]
+            if match.group(3) is None:
+                return str(round(axis.mechanical(now)) + axis.offset)
+            axis.offset = int(match.group(3)) - round(axis.mechanical(now))
+            return "OK"
+
+        match = _MOVE.match(command)
+        if match:
+            axis = self._axes[match.group(1)]
+            value = int(match.group(2))
+            target = value - axis.offset if self._absolute else axis.mechanical(now) + value
+            axis.start_move(float(target), now)
+            return "OK"
+
+        match = _PARAM.match(command)
+        if match:
+            name, axis = match.group(1), self._axes[match.group(2)]
+            if match.group(3) is None:
+                return str(axis.params[name])
+            axis.params[name] = int(match.group(3))
+            return "OK"
+
+        match = _HOME.match(command)
+        if match:
+            self._axes[match.group(1)].start_move(0.0, now)
+            return "OK"
+
+        match = _STOP.match(command)
+        if match:
+            for name in ([match.group(2)] if match.group(2) else self.AXES):
+                self._axes[name].stop(now)
+            return "OK"
+
+        match = _ENABLE.match(command)
+        if match:
+            axis = self._axes[self.AXES[int(match.group(1)) - 1]]
+            if match.group(2) is None:
+                return str(axis.enabled)
+            axis.enabled = int(match.group(2))
+            return "OK"
+
+        return "?Invalid command"
+
+    # ============================================================================
+    # QUERIES - Simulation side (tests, coupled signal sources)
+    # ============================================================================
+
+    def position(self, axis: str) -> int:
+        """Reported pulse position of an axis, as PX would return it."""
+        with self._lock:
+            state = self._axes[axis.upper()]
+            return round(state.mechanical(self._clock())) + state.offset
+
+    def fault_counts(self) -> Dict[str, int]:
+        return self._faults.counts()
+
+    def _is_open(self, handle) -> bool:
+        return _load(handle) - 1 in self._open_handles
+
+
+def _store(pointer, value: int) -> None:
+    """Write through a ctypes.byref() argument (ignored for plain Python values)."""
+    target = getattr(pointer, "_obj", None)
+    if target is not None:
+        target.value = value
+
+
+def _load(pointer) -> int:
+    target = getattr(pointer, "_obj", pointer)
+    return int(getattr(target, "value", None) or 0)
@@ -0,0 +1,98 @@
+"""
+Simulation Profile - Infrastructure Layer
+
+Responsibility:
+- Timing and fault parameters shared by the simulated devices (MCU serial
+  link, Performax DLL).
+- Draw the per-command delays and the injected faults, and count them.
+
+Rationale:
+- Load tests must reproduce the timing of the bench (ADC output rate,
+  USB/serial round trips, scheduling jitter) and its failures (lost or
+  corrupted frames, device errors, timeouts) on demand and reproducibly.
+
+Design:
+- SimulationProfile: frozen dataclass, validated in __post_init__.
+- FaultInjector: one seeded random.Random per device, thread safe; its
+  counters let a test compare what was injected with what the stack detected.
+"""
+
+from dataclasses import dataclass
+import random
+import threading
+from typing import Dict, Optional
+
+
+@dataclass(frozen=True)
+class SimulationProfile:
+    """Sample rate, latency, jitter and fault rates of a simulated device."""
+
+    sample_rate_hz: float = 1000.0  # ADC output data rate (before MCU averaging)
+    latency_s: float = 0.0  # Added to every command reply
+    jitter_s: float = 0.0  # Uniform [0, jitter_s] added on top of the latency
+    drop_rate: float = 0.0  # Lost stream frame / reply never sent (read timeout)
+    corrupt_rate: float = 0.0  # Stream frame or reply line with a damaged byte
+    error_rate: float = 0.0  # Device error reply (Performax '?')
+    seed: Optional[int] = None  # Reproducible fault sequence
+
+    def __post_init__(self):
+        """Validate parameters."""
+        if not self.sample_rate_hz > 0:
+            raise ValueError(f"sample_rate_hz must be > 0, got {self.sample_rate_hz}")
+        if self.latency_s < 0 or self.jitter_s < 0:
+            raise ValueError(f"latency_s and jitter_s must be >= 0, got {self.latency_s}, {self.jitter_s}")
+        for name in ("drop_rate", "corrupt_rate", "error_rate"):
+            rate = getattr(self, name)
+            if not 0 <= rate <= 1:
+                raise ValueError(f"{name} must be in [0, 1], got {rate}")
+
+
+class FaultInjector:
+    """
+    Delays and faults drawn from a SimulationProfile.
+    """
+
+    def __init__(self, profile: SimulationProfile):
+        self._profile = profile
+        self._rng = random.Random(profile.seed)
+        self._lock = threading.Lock()
+        self._counts: Dict[str, int] = {"dropped": 0, "corrupted": 0, "errors": 0}
+
+    @property
+    def profile(self) -> SimulationProfile:
+        return self._profile
+
+    def reply_delay_s(self) -> float:
+        """Latency + jitter of one reply."""
+        jitter = self._profile.jitter_s
+        if not jitter:
+            return self._profile.latency_s
+        with self._lock:
+            return self._profile.latency_s + self._rng.uniform(0.0, jitter)
+
+    def drop(self) -> bool:
+        return self._draw(self._profile.drop_rate, "dropped")
+
+    def corrupt(self) -> bool:
+        return self._draw(self._profile.corrupt_rate, "corrupted")
+
+    def error(self) -> bool:
+        return self._draw(self._profile.error_rate, "errors")
+
+    def randrange(self, stop: int) -> int:
+        with self._lock:
+            return self._rng.randrange(stop)
+
+    def counts(self) -> Dict[str, int]:
+        """Faults injected so far (dropped, corrupted, errors)."""
+        with self._lock:
+            return dict(self._counts)
+
+    def _draw(self, rate: float, counter: str) -> bool:
+        if not rate:
+            return False
+        with self._lock:
+            hit = self._rng.random() < rate
+            if hit:
+                self._counts[counter] += 1
+            return hit
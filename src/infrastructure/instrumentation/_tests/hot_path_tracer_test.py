@@ -0,0 +1,107 @@
+import json
+import sys
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from infrastructure.instrumentation.hot_path_tracer import HotPathTracer
+
+
+class TestHotPathTracer(unittest.TestCase):
+    def test_disabled_tracer_records_nothing(self):
+        tracer = HotPathTracer()
+        t0 = tracer.start()
+        tracer.end("scan", "settle", t0)
+        with tracer.span("scan", "acquire"):
+            pass
+        self.assertEqual(t0, 0)
+        self.assertEqual(tracer.spans(), [])
+
+    def test_spans_are_recorded_per_thread(self):
+        tracer = HotPathTracer()
+        tracer.enable()
+
+        def work():
+            for _ in range(3):
+                with tracer.span("mcu", "exchange"):
+                    pass
+
+        threads = [threading.Thread(target=work, name=f"worker-{i}") for i in range(2)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        t0 = tracer.start()
+        tracer.end("scan", "move", t0)
+
+        spans = tracer.spans()
+        self.assertEqual(len(spans), 7)
+        self.assertEqual({span.thread_name for span in spans if span.name == "exchange"}, {"worker-0", "worker-1"})
+        self.assertEqual([span.start_ns for span in spans], sorted(span.start_ns for span in spans))
+        summary = tracer.summary()
+        self.assertEqual(summary[("mcu", "exchange")]["count"], 6)
+        self.assertEqual(summary[("scan", "move")]["count"], 1)
+
+    def test_full_ring_overwrites_oldest_spans(self):
+        tracer = HotPathTracer()
+        tracer.enable(capacity=4)
+        for i in range(10):
+            tracer.end("event", f"e{i}", tracer.start())
+        self.assertEqual([span.name for span in tracer.spans()], ["e6", "e7", "e8", "e9"])
+        self.assertEqual(tracer.overwritten(), 6)
+
+    def test_rings_of_exited_threads_are_bounded(self):
+        tracer = HotPathTracer()
+        tracer.MAX_EXITED_RINGS = 2
+        tracer.enable(capacity=4)
+
+        for i in range(6):
+            thread = threading.Thread(target=lambda: tracer.end("scan", "record", tracer.start()),
+                                      name=f"stage-{i}")
+            thread.start()
+            thread.join()
+
+        # At each registration 2 exited rings are kept, the oldest one is reused
+        self.assertEqual(len(tracer._buffers), 3)
+        self.assertEqual([span.thread_name for span in tracer.spans()], ["stage-3", "stage-4", "stage-5"])
+        self.assertEqual(tracer.overwritten(), 0)
+
+    def test_clear_drops_recorded_spans(self):
+        tracer = HotPathTracer()
+        tracer.enable()
+        tracer.end("scan", "move", tracer.start())
+        tracer.clear()
+        self.assertEqual(tracer.spans(), [])
+        tracer.end("scan", "settle", tracer.start())
+        self.assertEqual([span.name for span in tracer.spans()], ["settle"])
+
+    def test_chrome_trace_export(self):
+        tracer = HotPathTracer()
+        tracer.enable()
+        t0 = tracer.start()
+        tracer.end("performax", "send_recv", t0)
+        with tempfile.TemporaryDirectory() as tmp:
+            path = tracer.export_chrome_trace(Path(tmp) / "traces" / "trace.json",
+                                              counters=[(t0, {"scan points": 12.0})])
+            trace = json.loads(path.read_text(encoding="utf-8"))
+
+        by_phase = {}
+        for event in trace["traceEvents"]:
+            by_phase.setdefault(event["ph"], []).append(event)
+        span = by_phase["X"][0]
+        self.assertEqual((span["cat"], span["name"]), ("performax", "send_recv"))
+        self.assertAlmostEqual(span["ts"], t0 / 1e3)
+        self.assertGreaterEqual(span["dur"], 0)
+        self.assertEqual(by_phase["M"][0]["args"]["name"], threading.current_thread().name)
+        self.assertEqual(by_phase["C"][0]["args"], {"value": 12.0})
+        self.assertEqual(trace["otherData"]["overwritten_spans"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
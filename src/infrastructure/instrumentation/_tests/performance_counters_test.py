@@ -0,0 +1,82 @@
+import sys
+import unittest
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from infrastructure.instrumentation.performance_counters import Counter, PerformanceCounters
+
+
+class FakeClock:
+    def __init__(self):
+        self.now_ns = 1_000_000_000
+
+    def __call__(self) -> int:
+        return self.now_ns
+
+    def advance(self, seconds: float):
+        self.now_ns += int(seconds * 1e9)
+
+
+class TestPerformanceCounters(unittest.TestCase):
+    def setUp(self):
+        self.clock = FakeClock()
+        self.counters = PerformanceCounters(history=3, clock_ns=self.clock)
+
+    def test_gauge_reads_current_value(self):
+        depth = [4]
+        self.counters.register_gauge("queue depth", lambda: depth[0])
+        self.assertEqual(self.counters.sample(), {"queue depth": 4.0})
+        depth[0] = 7
+        self.assertEqual(self.counters.sample(), {"queue depth": 7.0})
+
+    def test_rate_from_cumulative_total(self):
+        points = Counter()
+        self.counters.register_rate("scan points", points, unit="pts/s")
+        self.assertIsNone(self.counters.sample()["scan points"])
+        points.increment(50)
+        self.clock.advance(2.0)
+        self.assertAlmostEqual(self.counters.sample()["scan points"], 25.0)
+        self.assertEqual(self.counters.units(), {"scan points": "pts/s"})
+
+    def test_rate_is_unavailable_after_total_reset(self):
+        total = [100]
+        self.counters.register_rate("samples", lambda: total[0])
+        self.counters.sample()
+        total[0] = 10  # New acquisition
+        self.clock.advance(1.0)
+        self.assertIsNone(self.counters.sample()["samples"])
+        total[0] = 30
+        self.clock.advance(1.0)
+        self.assertAlmostEqual(self.counters.sample()["samples"], 20.0)
+
+    def test_failing_read_is_unavailable(self):
+        def read():
+            raise AttributeError("no acquisition yet")
+
+        self.counters.register_gauge("overruns", read)
+        self.counters.register_gauge("depth", lambda: 1)
+        self.assertEqual(self.counters.sample(), {"overruns": None, "depth": 1.0})
+
+    def test_history_is_bounded(self):
+        self.counters.register_gauge("depth", lambda: 1)
+        self.counters.register_gauge("overruns", lambda: None)  # float(None) raises
+        for _ in range(5):
+            self.counters.sample()
+            self.clock.advance(1.0)
+        history = self.counters.history()
+        self.assertEqual(len(history), 3)
+        self.assertEqual([t for t, _ in history], sorted(t for t, _ in history))
+        self.assertEqual(self.counters.trace_counters()[-1][1], {"depth": 1.0})
+
+    def test_unregister(self):
+        self.counters.register_gauge("depth", lambda: 1)
+        self.counters.unregister("depth")
+        self.assertEqual(self.counters.sample(), {})
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,282 @@
+"""
+Hot-Path Tracer - Infrastructure Layer
+
+Responsibility:
+- Record nanosecond spans (category, name, start, duration) around the hot
+  paths: serial exchanges, PerformaxCom round trips, settle, statistics,
+  event dispatch, export writes.
+- Export them as Chrome trace JSON (chrome://tracing, ui.perfetto.dev) for
+  post-mortem analysis of slow scans.
+
+Rationale:
+- Timing used to come from print() calls and MotionCompleted.duration_ms:
+  no per-call distribution, no view of which thread waited on which.
+- Disabled by default; a disabled span costs one attribute test.
+
+Design:
+- Call sites: `t0 = TRACER.start()` ... `TRACER.end(category, name, t0)`
+  (no object per span), or `with TRACER.span(category, name):` off the
+  hottest paths.
+- One preallocated ring per thread (created on the first span of the
+  thread): the recording thread is the only writer, no lock on the record
+  path. When a ring is full the oldest spans are overwritten and counted.
+- Rings of exited threads are kept for export, at most MAX_EXITED_RINGS of
+  them when a thread registers: beyond that, the new thread takes over the
+  storage of the oldest exited ring (a scan creates a PipelineStage thread, pools add more; a
+  long traced session would otherwise grow by one ring per thread).
+- Snapshots read the rings while threads keep recording: a span recorded
+  during the snapshot may be missing. Until a ring wraps a span is never
+  torn (the write index is advanced after the fields); once it has wrapped,
+  the oldest slot read may be overwritten mid-read and mix two spans.
+- Counter tracks ("C" events) can be merged into the export, e.g. the
+  history of PerformanceCounters.
+"""
+
+from __future__ import annotations
+
+import json
+import os
+import threading
+import time
+import weakref
+from array import array
+from contextlib import nullcontext
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, Iterable, List, Optional, Tuple
+
+DEFAULT_CAPACITY = 1 << 16  # Spans per thread
+
+
+@dataclass(frozen=True)
+class TraceSpan:
+    category: str
+    name: str
+    start_ns: int  # time.perf_counter_ns()
+    duration_ns: int
+    thread_id: int
+    thread_name: str
+
+
+class _ThreadTraceBuffer:
+    """Ring of spans written by a single thread."""
+
+    def __init__(self, capacity: int):
+        self.capacity = capacity
+        self.categories: List[Optional[str]] = [None] * capacity
+        self.names: List[Optional[str]] = [None] * capacity
+        self.starts = array("q", bytes(8 * capacity))
+        self.durations = array("q", bytes(8 * capacity))
+        self.bind()
+
+    def bind(self) -> None:
+        """Attach the ring (emptied) to the calling thread."""
+        thread = threading.current_thread()
+        self.written = 0  # Total spans recorded (write index = written % capacity)
+        self.thread_id = thread.ident or 0
+        self.thread_name = thread.name
+        self._thread = weakref.ref(thread)
+
+    def is_alive(self) -> bool:
+        thread = self._thread()
+        return thread is not None and thread.is_alive()
+
+    def record(self, category: str, name: str, start_ns: int, duration_ns: int) -> None:
+        i = self.written % self.capacity
+        self.categories[i] = category
+        self.names[i] = name
+        self.starts[i] = start_ns
+        self.durations[i] = duration_ns
+        self.written += 1
+
+    @property
+    def overwritten(self) -> int:
+        return max(0, self.written - self.capacity)
+
+    def spans(self) -> List[TraceSpan]:
+        written = self.written
+        first = max(0, written - self.capacity)
+        spans = []
+        for n in range(first, written):
+            i = n % self.capacity
+            spans.append(TraceSpan(self.categories[i], self.names[i], self.starts[i], self.durations[i],
+                                   self.thread_id, self.thread_name))
+        return spans
+
+
+class _Span:
+    """Context manager form of start() / end()."""
+
+    __slots__ = ("_tracer", "_category", "_name", "_t0")
+
+    def __init__(self, tracer: "HotPathTracer", category: str, name: str):
+        self._tracer = tracer
+        self._category = category
+        self._name = name
+        self._t0 = 0
+
+    def __enter__(self):
+        self._t0 = time.perf_counter_ns()
+        return self
+
+    def __exit__(self, *exc):
+        self._tracer.end(self._category, self._name, self._t0)
+        return False
+
+
+_NULL_SPAN = nullcontext()
+
+
+class HotPathTracer:
+    """
+    Per-thread span recorder (process-wide instance: TRACER).
+    """
+
+    MAX_EXITED_RINGS = 8  # Rings of exited threads kept for export
+
+    def __init__(self, capacity: int = DEFAULT_CAPACITY):
+        self.enabled = False
+        self._capacity = capacity
+        self._local = threading.local()
+        self._lock = threading.Lock()  # Buffer registration only
+        self._buffers: List[_ThreadTraceBuffer] = []
+        self._generation = 0  # Bumped by clear(): threads drop their old ring
+
+    # ============================================================================
+    # CONTROL
+    # ============================================================================
+
+    def enable(self, capacity: Optional[int] = None) -> None:
+        if capacity is not None and capacity != self._capacity:
+            self._capacity = capacity
+            self.clear()
+        self.enabled = True
+        print(f"[HotPathTracer] Tracing enabled ({self._capacity} spans per thread)")
+
+    def disable(self) -> None:
+        self.enabled = False
+        print("[HotPathTracer] Tracing disabled")
+
+    def clear(self) -> None:
+        """Drop every recorded span (rings are reallocated on next use)."""
+        with self._lock:
+            self._buffers = []
+            self._generation += 1
+
+    # ============================================================================
+    # RECORDING (hot path)
+    # ============================================================================
+
+    def start(self) -> int:
+        """Start timestamp of a span, 0 when tracing is disabled."""
+        return time.perf_counter_ns() if self.enabled else 0
+
+    def end(self, category: str, name: str, t0: int) -> None:
+        """Record the span started at t0 (no-op if t0 is 0)."""
+        if not t0:
+            return
+        duration = time.perf_counter_ns() - t0
+        local = self._local
+        buffer = getattr(local, "buffer", None)
+        if buffer is None or local.generation != self._generation:
+            buffer = self._register()
+        buffer.record(category, name, t0, duration)
+
+    def span(self, category: str, name: str):
+        """`with TRACER.span("scan", "settle"):` (shared no-op context when disabled)."""
+        if not self.enabled:
+            return _NULL_SPAN
+        return _Span(self, category, name)
+
+    def _register(self) -> _ThreadTraceBuffer:
+        with self._lock:
+            # Oldest exited rings beyond the bound: one is reused, the others dropped
+            exited = [buffer for buffer in self._buffers if not buffer.is_alive()]
+            recycled = exited[:max(0, len(exited) - self.MAX_EXITED_RINGS)]
+            if recycled:
+                self._buffers = [buffer for buffer in self._buffers if buffer not in recycled]
+                buffer = recycled[0]
+                buffer.bind()
+            else:
+                buffer = _ThreadTraceBuffer(self._capacity)
+            self._buffers.append(buffer)
+            self._local.generation = self._generation
+        self._local.buffer = buffer
+        return buffer
+
+    # ============================================================================
+    # READING
+    # ============================================================================
+
+    def spans(self) -> List[TraceSpan]:
+        """Every span still in the rings, sorted by start time."""
+        with self._lock:
+            buffers = list(self._buffers)
+        spans = [span for buffer in buffers for span in buffer.spans()]
+        spans.sort(key=lambda span: span.start_ns)
+        return spans
+
+    def overwritten(self) -> int:
+        """Spans lost because a thread ring was full."""
+        with self._lock:
+            return sum(buffer.overwritten for buffer in self._buffers)
+
+    def summary(self) -> Dict[Tuple[str, str], Dict[str, float]]:
+        """{(category, name): count, total_ms, mean_us, p99_us, max_us}."""
+        durations: Dict[Tuple[str, str], List[int]] = {}
+        for span in self.spans():
+            durations.setdefault((span.category, span.name), []).append(span.duration_ns)
+        result = {}
+        for key, values in durations.items():
+            values.sort()
+            result[key] = {
+                "count": len(values),
+                "total_ms": sum(values) / 1e6,
+                "mean_us": sum(values) / len(values) / 1e3,
+                "p99_us": values[min(len(values) - 1, int(0.99 * len(values)))] / 1e3,
+                "max_us": values[-1] / 1e3,
+            }
+        return result
+
+    def export_chrome_trace(
+        self,
+        path: os.PathLike,
+        counters: Optional[Iterable[Tuple[int, Dict[str, float]]]] = None,
+    ) -> Path:
+        """
+        Write the spans as Chrome trace JSON ("X" complete events, us timestamps).
+
+        Args:
+            counters: Optional (perf_counter_ns, {name: value}) samples, written
+                as "C" counter events (one track per name).
+        """
+        pid = os.getpid()
+        spans = self.spans()
+        events: List[dict] = []
+        threads = {}
+        for span in spans:
+            threads.setdefault(span.thread_id, span.thread_name)
+            events.append({
+                "name": span.name, "cat": span.category, "ph": "X", "pid": pid, "tid": span.thread_id,
+                "ts": span.start_ns / 1e3, "dur": span.duration_ns / 1e3,
+            })
+        for tid, name in threads.items():
+            events.append({"name": "thread_name", "ph": "M", "pid": pid, "tid": tid, "args": {"name": name}})
+        for t_ns, values in counters or ():
+            for name, value in values.items():
+                events.append({"name": name, "ph": "C", "pid": pid, "tid": 0, "ts": t_ns / 1e3,
+                               "args": {"value": value}})
+
+        path = Path(path)
+        path.parent.mkdir(parents=True, exist_ok=True)
+        with path.open("w", encoding="utf-8") as f:
+            json.dump({
+                "traceEvents": events,
+                "displayTimeUnit": "ns",
+                "otherData": {"overwritten_spans": self.overwritten()},
+            }, f)
+        print(f"[HotPathTracer] Chrome trace written: {path} ({len(spans)} spans)")
+        return path
+
+
+TRACER = HotPathTracer()
@@ -0,0 +1,127 @@
+"""
+Performance Counters - Infrastructure Layer
+
+Responsibility:
+- Sample named live counters on demand: gauges (queue depth, ring
+  overruns) and rates computed from cumulative totals (samples/s, scan
+  points/s, serial errors/s).
+- Keep a bounded history of the samples (dashboard plot, Chrome trace
+  counter tracks).
+
+Rationale:
+- The values already exist in the components (buffer overruns, bus queue
+  depths, deframer errors); what was missing is one place that reads them
+  periodically, off the hot path.
+
+Design:
+- Counters are registered by the composition root with a read callable;
+  the owning component is not modified and nothing is computed between
+  two samples.
+- `Counter` totals for events that have no counter of their own (e.g. scan
+  points from a bus subscription): plain integer increment by the owner.
+- A read that raises marks the counter unavailable (None) for that sample.
+"""
+
+from __future__ import annotations
+
+import threading
+import time
+from collections import deque
+from dataclasses import dataclass
+from typing import Callable, Deque, Dict, List, Optional, Tuple
+
+
+class Counter:
+    """Cumulative count incremented by its owner (read by a rate counter)."""
+
+    __slots__ = ("value",)
+
+    def __init__(self):
+        self.value = 0
+
+    def increment(self, n: int = 1) -> None:
+        self.value += n
+
+    def __call__(self) -> int:
+        return self.value
+
+
+@dataclass(frozen=True)
+class CounterSpec:
+    name: str
+    read: Callable[[], float]
+    unit: str
+    rate: bool  # True: read() is a cumulative total, the sample is its rate per second
+
+
+class PerformanceCounters:
+    """
+    Registry of sampled counters.
+    """
+
+    def __init__(self, history: int = 600, clock_ns: Callable[[], int] = time.perf_counter_ns):
+        """
+        Args:
+            history: Samples kept (600 = 10 min at the dashboard's 1 Hz).
+            clock_ns: Monotonic clock (perf_counter_ns: same timeline as the tracer).
+        """
+        self._clock_ns = clock_ns
+        self._lock = threading.Lock()
+        self._specs: Dict[str, CounterSpec] = {}
+        self._previous: Dict[str, Tuple[int, float]] = {}  # Rate counters: (t_ns, total)
+        self._history: Deque[Tuple[int, Dict[str, Optional[float]]]] = deque(maxlen=history)
+
+    def register_gauge(self, name: str, read: Callable[[], float], unit: str = "") -> None:
+        self._register(CounterSpec(name, read, unit, rate=False))
+
+    def register_rate(self, name: str, read_total: Callable[[], float], unit: str = "/s") -> None:
+        self._register(CounterSpec(name, read_total, unit, rate=True))
+
+    def _register(self, spec: CounterSpec) -> None:
+        with self._lock:
+            self._specs[spec.name] = spec
+            self._previous.pop(spec.name, None)
+
+    def unregister(self, name: str) -> None:
+        with self._lock:
+            self._specs.pop(name, None)
+            self._previous.pop(name, None)
+
+    def units(self) -> Dict[str, str]:
+        with self._lock:
+            return {name: spec.unit for name, spec in self._specs.items()}
+
+    def sample(self) -> Dict[str, Optional[float]]:
+        """
+        Read every counter now. Rates are averaged since the previous sample
+        (None on the first sample of a rate counter and after a reset of its total).
+        """
+        with self._lock:
+            now = self._clock_ns()
+            values: Dict[str, Optional[float]] = {}
+            for name, spec in self._specs.items():
+                try:
+                    value = float(spec.read())
+                except Exception:
+                    values[name] = None
+                    continue
+                if not spec.rate:
+                    values[name] = value
+                    continue
+                previous = self._previous.get(name)
+                self._previous[name] = (now, value)
+                if previous is None or now <= previous[0] or value < previous[1]:
+                    values[name] = None  # First sample, or total reset (new acquisition)
+                else:
+                    values[name] = (value - previous[1]) * 1e9 / (now - previous[0])
+            self._history.append((now, values))
+            return values
+
+    def history(self) -> List[Tuple[int, Dict[str, Optional[float]]]]:
+        """(perf_counter_ns, values) of the kept samples, oldest first."""
+        with self._lock:
+            return list(self._history)
+
+    def trace_counters(self) -> List[Tuple[int, Dict[str, float]]]:
+        """History without unavailable values, for HotPathTracer.export_chrome_trace(counters=...)."""
+        return [(t, {k: v for k, v in values.items() if v is not None}) for t, values in self.history()]
@@ -9,10 +9,9 @@ from application.services.continuous_acquisition_service.i_continuous_acquisitio
 )
 from application.services.scan_application_service.i_acquisition_port import IAcquisitionPort
 from domain.events.i_domain_event_bus import IDomainEventBus
-from domain.events.continuous_acquisition_events import (
-    ContinuousAcquisitionSampleAcquired,
-    ContinuousAcquisitionStopped
-)
+from domain.events.continuous_acquisition_events import ContinuousAcquisitionStopped
+from domain.events.event_topics import topic_of
+from infrastructure.buffers.continuous_sample_buffer import ContinuousSampleBuffer
 
 class MockContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
     """
@@ -27,6 +26,7 @@ class MockContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
         self._thread: Optional[threading.Thread] = None
         self._stop_event = threading.Event()
         self._current_acquisition_id = None
+        self._samples = ContinuousSampleBuffer()
         
     def start(self, config: ContinuousAcquisitionConfig, acquisition_port: IAcquisitionPort) -> None:
         """
@@ -44,6 +44,7 @@ class MockContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
              acquisition_port.configure_for_uncertainty(config.target_uncertainty)
              
         self._stop_event.clear()
+        self._samples.clear()
         self._is_running = True
         
         # Determine sleep time (0.0 means run as fast as possible/yield)
@@ -59,13 +60,7 @@ class MockContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
             while not self._stop_event.is_set():
                 if acquisition_port.is_ready():
                     sample = acquisition_port.acquire_sample()
-                    
-                    event = ContinuousAcquisitionSampleAcquired(
-                        acquisition_id=self._current_acquisition_id,
-                        sample_index=sample_index,
-                        sample=sample
-                    )
-                    self._event_bus.publish(type(event).__name__.lower(), event)
+                    self._samples.push(sample_index, sample)
                     sample_index += 1
                 
                 time.sleep(self._current_interval)
@@ -73,7 +68,7 @@ class MockContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
             self._is_running = False
             print("[MockContinuousAcquisitionExecutor] Stopped.")
             event = ContinuousAcquisitionStopped(acquisition_id=self._current_acquisition_id)
-            self._event_bus.publish(type(event).__name__.lower(), event)
+            self._event_bus.publish(topic_of(event), event)
 
         self._thread = threading.Thread(target=_worker, daemon=True)
         self._thread.start()
@@ -96,3 +91,12 @@ class MockContinuousAcquisitionExecutor(IContinuousAcquisitionExecutor):
             self._current_interval = 1.0 / config.sample_rate_hz
         else:
             self._current_interval = 0.0
+
+    def drain_samples(self, max_samples: Optional[int] = None):
+        return self._samples.read(max_samples)
+
+    def get_sample_overruns(self) -> int:
+        return self._samples.overruns
+
+    def get_current_acquisition_id(self):
+        return self._current_acquisition_id
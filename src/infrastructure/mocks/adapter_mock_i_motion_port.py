@@ -1,11 +1,20 @@
-from typing import List, Optional
+from typing import Callable, List, Optional, Sequence
 import threading
 import time
 from uuid import uuid4
 from domain.value_objects.geometric.position_2d import Position2D
 from application.services.motion_control_service.i_motion_port import IMotionPort
+from application.services.motion_control_service.i_planned_trajectory_run import IPlannedTrajectoryRun
+from infrastructure.execution.planned_trajectory_run import ThreadedPlannedTrajectoryRun
 from domain.events.i_domain_event_bus import IDomainEventBus
 from domain.events.motion_events import MotionStarted, MotionCompleted, PositionUpdated, MotionStopped, EmergencyStopTriggered
+from domain.events.event_topics import (
+    EMERGENCY_STOP_TRIGGERED,
+    MOTION_COMPLETED,
+    MOTION_STARTED,
+    MOTION_STOPPED,
+    POSITION_UPDATED,
+)
 
 class MockMotionPort(IMotionPort):
     """
@@ -14,11 +23,15 @@ class MockMotionPort(IMotionPort):
     All actions print to terminal for explicit visibility.
     
     Supports event-based architecture when event_bus is provided.
+    Supports planned trajectories when planned_trajectory=True.
     """
-    def __init__(self, event_bus: Optional[IDomainEventBus] = None, motion_delay_ms: float = 100.0):
+    def __init__(self, event_bus: Optional[IDomainEventBus] = None, motion_delay_ms: float = 100.0,
+                 planned_trajectory: bool = False):
         print("[MockMotionPort] __init__: Mock motion port created at (0,0)")
         self._event_bus = event_bus
         self._motion_delay_ms = motion_delay_ms
+        self._planned_trajectory = planned_trajectory
+        self._trajectory_run: Optional[ThreadedPlannedTrajectoryRun] = None
         self.move_history: List[Position2D] = []
         self._current_pos = Position2D(0, 0)
         self.last_speed: float | None = None
@@ -34,12 +47,12 @@ class MockMotionPort(IMotionPort):
         
         # Publish MotionStarted if event_bus available
         if self._event_bus:
-            self._event_bus.publish("motionstarted", MotionStarted(
+            self._event_bus.publish(MOTION_STARTED, MotionStarted(
                 motion_id=motion_id,
                 target_position=position
             ))
             # Publish position update (is_moving=True)
-            self._event_bus.publish("positionupdated", PositionUpdated(
+            self._event_bus.publish(POSITION_UPDATED, PositionUpdated(
                 position=self._current_pos,
                 is_moving=True
             ))
@@ -78,12 +91,12 @@ class MockMotionPort(IMotionPort):
         
         # Publish MotionCompleted and PositionUpdated
         if self._event_bus:
-            self._event_bus.publish("motioncompleted", MotionCompleted(
+            self._event_bus.publish(MOTION_COMPLETED, MotionCompleted(
                 motion_id=motion_id,
                 final_position=target,
                 duration_ms=duration
             ))
-            self._event_bus.publish("positionupdated", PositionUpdated(
+            self._event_bus.publish(POSITION_UPDATED, PositionUpdated(
                 position=target,
                 is_moving=False
             ))
@@ -103,25 +116,55 @@ class MockMotionPort(IMotionPort):
         self.last_speed = speed
         print(f"[MockMotionPort] set_speed: Speed set to {speed} cm/s")
 
+    def supports_planned_trajectory(self) -> bool:
+        return self._planned_trajectory
+
+    def start_planned_trajectory(
+        self,
+        points: Sequence[Position2D],
+        on_arrived: Optional[Callable[[int, Position2D], None]] = None,
+    ) -> IPlannedTrajectoryRun:
+        """Simulate a planned trajectory: motion_delay_ms per point, no motion events."""
+        if not self._planned_trajectory:
+            return super().start_planned_trajectory(points, on_arrived)
+        print(f"[MockMotionPort] start_planned_trajectory: {len(points)} points")
+        self._trajectory_run = ThreadedPlannedTrajectoryRun(
+            points, move_and_wait=self._simulate_planned_move, on_arrived=on_arrived,
+            name="MockPlannedTrajectory",
+        ).start()
+        return self._trajectory_run
+
+    def _simulate_planned_move(self, index: int, target: Position2D) -> Position2D:
+        self._is_moving = True
+        time.sleep(self._motion_delay_ms / 1000.0)
+        self.move_history.append(target)
+        self._current_pos = target
+        self._is_moving = False
+        return target
+
     def stop(self) -> None:
         """Regular stop with deceleration."""
+        if self._trajectory_run is not None:
+            self._trajectory_run.abort()
         self._is_moving = False
         print(f"[MockMotionPort] stop: Normal Stop triggered (decelerating...)")
         
         # Publish MotionStopped event
         if self._event_bus:
-            self._event_bus.publish("motionstopped", MotionStopped(
+            self._event_bus.publish(MOTION_STOPPED, MotionStopped(
                 reason="user_requested"
             ))
 
     def emergency_stop(self) -> None:
         """Emergency stop - immediate halt."""
+        if self._trajectory_run is not None:
+            self._trajectory_run.abort()
         self._is_moving = False
         print("[MockMotionPort] emergency_stop: EMERGENCY STOP triggered! (Immediate Halt)")
         
         # Publish EmergencyStopTriggered event
         if self._event_bus:
-            self._event_bus.publish("emergencystoptriggered", EmergencyStopTriggered())
+            self._event_bus.publish(EMERGENCY_STOP_TRIGGERED, EmergencyStopTriggered())
 
     def home(self, axis: str | None = None) -> None:
         axis_print = axis if axis else 'BOTH'
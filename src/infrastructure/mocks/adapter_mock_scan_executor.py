@@ -9,6 +9,7 @@ from domain.value_objects.scan.scan_status import ScanStatus
 from domain.value_objects.scan.scan_point_result import ScanPointResult
 from domain.value_objects.acquisition.acquisition_sample import AcquisitionSample
 from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.events.event_topics import topic_of
 
 class MockScanExecutor(IScanExecutor):
     """
@@ -173,5 +174,5 @@ class MockScanExecutor(IScanExecutor):
     def _publish_events(self, events):
         """Publish domain events to the event bus."""
         for event in events:
-            event_type = type(event).__name__.lower()
+            event_type = topic_of(event)
             self.event_bus.publish(event_type, event)
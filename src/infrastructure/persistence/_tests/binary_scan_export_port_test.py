@@ -0,0 +1,131 @@
+import importlib.util
+import math
+import struct
+import tempfile
+import unittest
+from pathlib import Path
+
+from application.services.scan_application_service.i_scan_export_port import ScanPointRow
+from infrastructure.persistence.binary_scan_export_port import (
+    BinaryScanExportPort,
+    HEADER_ALIGN,
+    MAGIC,
+    ROW_COLUMNS,
+    ROW_SIZE,
+    convert_to_csv,
+    iter_rows,
+    open_memmap,
+    read_header,
+)
+
+
+def row(i):
+    return ScanPointRow(
+        scan_id="s",
+        point_index=i,
+        x=float(i),
+        y=-float(i),
+        voltages=tuple(i + c / 10 for c in range(6)),
+        std_devs=(None,) + tuple(0.01 * i for _ in range(5)),
+        sample_count=None if i == 0 else 10 + i,
+        level=i % 2,
+    )
+
+
+class TestBinaryScanExportPort(unittest.TestCase):
+    METADATA = {"scan_id": "abc", "x_nb_points": 2, "y_nb_points": 2}
+
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def _start(self):
+        port = BinaryScanExportPort()
+        port.configure(self.tmp.name, "scan", self.METADATA)
+        path = port.file_path
+        port.start()
+        return port, path
+
+    def test_header_and_rows_round_trip(self):
+        port, path = self._start()
+        for i in range(4):
+            port.write_row(row(i))
+        port.stop()
+
+        metadata, header_size = read_header(path)
+        self.assertEqual(metadata, self.METADATA)
+        self.assertEqual(header_size % HEADER_ALIGN, 0)
+        self.assertEqual(path.stat().st_size, header_size + 4 * ROW_SIZE)
+
+        rows = list(iter_rows(path))
+        self.assertEqual([r.point_index for r in rows], [0, 1, 2, 3])
+        self.assertEqual(rows[2].scan_id, "abc")
+        self.assertEqual(rows[2].voltages, row(2).voltages)
+        self.assertIsNone(rows[2].std_devs[0])
+        self.assertAlmostEqual(rows[2].std_devs[1], 0.02)
+        self.assertEqual([r.sample_count for r in rows], [None, 11, 12, 13])
+        self.assertEqual([r.level for r in rows], [0, 1, 0, 1])
+
+    def test_version_1_file_is_readable(self):
+        path = Path(self.tmp.name) / "v1.aefscan"
+        columns = ROW_COLUMNS - 2
+        fixed = struct.pack("<8sHHII12x", MAGIC, 1, columns, HEADER_ALIGN, 0)
+        values = (3.0, 1.0, 2.0) + (0.5,) * 6 + (math.nan,) * 6
+        path.write_bytes(fixed.ljust(HEADER_ALIGN, b"\0") + struct.pack(f"<{columns}d", *values))
+
+        rows = list(iter_rows(path))
+        self.assertEqual(len(rows), 1)
+        self.assertEqual(rows[0].point_index, 3)
+        self.assertIsNone(rows[0].sample_count)
+        self.assertEqual(rows[0].level, 0)
+
+    def test_unfinished_file_is_readable(self):
+        port, path = self._start()
+        port.write_row(row(0))
+        port.write_point(row(1).as_dict())
+        # Still open (crashed run): rows are already on disk
+        self.assertEqual(len(list(iter_rows(path))), 2)
+        # A partial trailing row is ignored
+        port._file.write(b"\x00" * (ROW_SIZE // 2))
+        port._file.flush()
+        self.assertEqual(len(list(iter_rows(path))), 2)
+        port.stop()
+
+    def test_csv_conversion(self):
+        port, path = self._start()
+        port.write_row(row(1))
+        port.stop()
+
+        csv_path = convert_to_csv(path)
+        lines = csv_path.read_text(encoding="utf-8").splitlines()
+        self.assertEqual(len(lines), 2)
+        header = lines[0].split(",")
+        values = dict(zip(header, lines[1].split(",")))
+        self.assertEqual(values["scan_id"], "abc")
+        self.assertEqual(float(values["voltage_x_quadrature"]), 1.1)
+        self.assertEqual(values["std_dev_x_in_phase"], "")
+
+    def test_rejects_foreign_file(self):
+        path = Path(self.tmp.name) / "other.aefscan"
+        path.write_bytes(b"not a scan file at all, really....")
+        with self.assertRaises(ValueError):
+            read_header(path)
+
+    @unittest.skipUnless(importlib.util.find_spec("numpy"), "numpy not installed")
+    def test_memmap_view(self):
+        port, path = self._start()
+        for i in range(3):
+            port.write_row(row(i))
+        port.stop()
+
+        metadata, rows = open_memmap(path)
+        self.assertEqual(rows.shape, (3, ROW_COLUMNS))
+        self.assertEqual(rows[:, 0].tolist(), [0.0, 1.0, 2.0])
+        self.assertTrue(math.isnan(rows[1, 9]))
+        self.assertEqual(metadata["scan_id"], "abc")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -66,3 +66,30 @@ class TestHDF5AcquisitionRepository(DiagramFriendlyTest):
         r_sample = retrieved[0]
         self.log_interaction("Test", "ASSERT", "HDF5Repository", "Verify X in-phase", expect=1.0, got=r_sample.voltage_x_in_phase)
         self.assertEqual(r_sample.voltage_x_in_phase, 1.0)
+
+    def test_read_columns_time_range(self):
+        """Columnar read restricted to a time range."""
+        scan_id = "scan_test_columns"
+        samples = [
+            AcquisitionSample(
+                timestamp=datetime.fromtimestamp(1000.0 + i),
+                voltage_x_in_phase=float(i), voltage_x_quadrature=0.0,
+                voltage_y_in_phase=0.0, voltage_y_quadrature=0.0,
+                voltage_z_in_phase=0.0, voltage_z_quadrature=-float(i)
+            )
+            for i in range(10)
+        ]
+        self.repo.save(scan_id, samples[:4])
+        self.repo.save(scan_id, samples[4:])
+
+        records = self.repo.read_columns(scan_id, start=1003.0, end=datetime.fromtimestamp(1007.0))
+        self.log_interaction("Test", "ASSERT", "HDF5Repository", "Verify sliced count", expect=4, got=len(records))
+        np.testing.assert_array_equal(records['x_in_phase'], [3.0, 4.0, 5.0, 6.0])
+
+        columns = self.repo.read_columns(scan_id, fields=['timestamp', 'z_quadrature'])
+        self.assertEqual(columns.dtype.names, ('timestamp', 'z_quadrature'))
+        self.assertEqual(len(columns), 10)
+
+        self.assertEqual(len(self.repo.read_columns(scan_id, start=2000.0)), 0)
+        self.assertEqual(len(self.repo.read_columns("unknown_scan")), 0)
+        self.assertEqual(self.repo.find_by_scan(scan_id)[9].voltage_z_quadrature, -9.0)
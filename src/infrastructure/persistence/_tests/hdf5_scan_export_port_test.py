@@ -0,0 +1,120 @@
+import tempfile
+import unittest
+from datetime import datetime, timedelta
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+from application.services.scan_application_service.i_scan_export_port import ScanPointRow
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+from infrastructure.persistence.hdf5_scan_export_port import Hdf5ScanExportPort
+
+
+def row(i):
+    return ScanPointRow(
+        scan_id="s",
+        point_index=i,
+        x=float(i),
+        y=-float(i),
+        voltages=tuple(i + c / 10 for c in range(6)),
+        std_devs=(None,) + tuple(0.01 * i for _ in range(5)),
+        sample_count=10 + i,
+        level=i % 3,
+    )
+
+
+class TestHdf5ScanExportPort(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def _export(self, port, metadata, n_points):
+        port.configure(self.tmp.name, "scan", metadata)
+        path = port._file_path
+        port.start()
+        for i in range(n_points):
+            port.write_row(row(i))
+        port.stop()
+        return Path(path)
+
+    def _check(self, path, n_points):
+        with h5py.File(path, "r") as f:
+            positions = f["scan_data/positions"][:]
+            measurements = f["scan_data/measurements"][:]
+            std_dev = f["scan_data/std_dev"][:]
+            sample_counts = f["scan_data/sample_counts"][:]
+            levels = f["scan_data/levels"][:]
+        self.assertEqual(positions.shape, (n_points, 2))
+        np.testing.assert_allclose(positions[:, 0], np.arange(n_points))
+        np.testing.assert_allclose(measurements[:, 5], np.arange(n_points) + 0.5)
+        self.assertTrue(np.isnan(std_dev[:, 0]).all())
+        np.testing.assert_array_equal(sample_counts, 10 + np.arange(n_points))
+        np.testing.assert_array_equal(levels, np.arange(n_points) % 3)
+
+    def test_preallocated_grid_written_in_chunks(self):
+        port = Hdf5ScanExportPort(chunk_rows=4)
+        path = self._export(port, {"x_nb_points": 3, "y_nb_points": 3}, 9)
+        self._check(path, 9)
+        with h5py.File(path, "r") as f:
+            self.assertEqual(f["scan_data/positions"].chunks, (4, 2))
+
+    def test_partial_scan_is_trimmed(self):
+        port = Hdf5ScanExportPort(chunk_rows=4)
+        self._check(self._export(port, {"x_nb_points": 4, "y_nb_points": 4}, 6), 6)
+
+    def test_unknown_grid_grows_and_background_writer(self):
+        port = Hdf5ScanExportPort(chunk_rows=3, background_writer=True)
+        self._check(self._export(port, {}, 10), 10)
+
+    def test_dict_points_still_accepted(self):
+        port = Hdf5ScanExportPort()
+        port.configure(self.tmp.name, "scan", {"x_nb_points": 1, "y_nb_points": 2})
+        path = port._file_path
+        port.start()
+        port.write_point(row(0).as_dict())
+        port.write_point(row(1).as_dict())
+        port.stop()
+        self._check(path, 2)
+
+    def test_raw_samples_indexed_per_point(self):
+        t0 = datetime(2026, 1, 1)
+        port = Hdf5ScanExportPort(chunk_rows=2)
+        port.configure(self.tmp.name, "scan", {"x_nb_points": 3, "y_nb_points": 1})
+        path = port._file_path
+        port.start()
+        for i in range(3):
+            samples = [
+                VoltageMeasurement(
+                    voltage_x_in_phase=i, voltage_x_quadrature=k,
+                    voltage_y_in_phase=0.0, voltage_y_quadrature=0.0,
+                    voltage_z_in_phase=0.0, voltage_z_quadrature=0.0,
+                    timestamp=t0 + timedelta(seconds=i, milliseconds=k),
+                )
+                for k in range(i + 2)
+            ]
+            port.write_raw_samples(i, samples)
+            port.write_row(row(i))
+        port.stop()
+
+        with h5py.File(path, "r") as f:
+            offsets = f["raw_data/point_offsets"][:]
+            samples = f["raw_data/samples"][:]
+            times = f["raw_data/timestamps"][:]
+        self.assertEqual(offsets.tolist(), [[0, 0, 2], [1, 2, 3], [2, 5, 4]])
+        self.assertEqual(samples.shape, (9, 6))
+        _, start, count = offsets[2]
+        np.testing.assert_allclose(samples[start:start + count, 0], 2.0)
+        np.testing.assert_allclose(samples[start:start + count, 1], np.arange(4))
+        self.assertAlmostEqual(times[start] - times[0], 2.0)
+
+    def test_no_raw_group_without_raw_samples(self):
+        path = self._export(Hdf5ScanExportPort(), {"x_nb_points": 1, "y_nb_points": 1}, 1)
+        with h5py.File(path, "r") as f:
+            self.assertNotIn("raw_data", f)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,292 @@
+"""
+Binary implementation of the scan export port.
+
+Responsibility:
+- Implement `IScanExportPort` with a fixed-layout binary file: one header
+  (magic, layout, JSON metadata) followed by packed float64 rows.
+- Read such files back: memory-mapped numpy view, typed rows, CSV conversion.
+
+Rationale:
+- CSV repeats the scan_id on every row and prints floats as text; the binary
+  file is ~136 bytes per point and is opened by `np.memmap` without parsing.
+- CSV becomes an on-demand conversion (`convert_to_csv`, `tool.scan_binary_to_csv`).
+
+Design:
+- Header (little-endian, padded to a multiple of HEADER_ALIGN bytes):
+    [0:8]   magic b"AEFISCAN"
+    [8:10]  format version, uint16
+    [10:12] columns per row, uint16
+    [12:16] header size in bytes, uint32 (= offset of the first row)
+    [16:20] metadata length in bytes, uint32
+    [20:32] reserved (zeros)
+    [32:]   metadata, UTF-8 JSON
+- Row: ROW_COLUMNS float64 = point_index, x, y, 6 means, 6 std devs,
+  sample count, resolution level (NaN when a std dev / count is unknown).
+  Version 1 files (no sample count / level columns) are still readable.
+- Append-safe: the row count is never stored, it is derived from the file
+  size. Each row is flushed as it is written, so a crashed run leaves a
+  readable file (a trailing partial row is ignored).
+"""
+
+from __future__ import annotations
+
+import csv
+import json
+import logging
+import math
+import os
+import struct
+from dataclasses import dataclass, field
+from datetime import datetime
+from pathlib import Path
+from typing import Any, BinaryIO, Dict, Iterator, Optional, Tuple
+
+from application.services.scan_application_service.i_scan_export_port import (
+    IScanExportPort,
+    ScanPointRow,
+    MEASUREMENT_COMPONENTS,
+)
+from infrastructure.instrumentation.hot_path_tracer import TRACER
+
+
+logger = logging.getLogger(__name__)
+
+MAGIC = b"AEFISCAN"
+FORMAT_VERSION = 2
+FILE_EXTENSION = ".aefscan"
+HEADER_ALIGN = 4096
+ROW_COLUMNS = 3 + 2 * len(MEASUREMENT_COMPONENTS) + 2
+ROW_SIZE = ROW_COLUMNS * 8
+
+# Columns per row of each readable format version
+_COLUMNS_BY_VERSION = {1: ROW_COLUMNS - 2, 2: ROW_COLUMNS}
+
+_FIXED_HEADER = struct.Struct("<8sHHII12x")
+_ROW = struct.Struct(f"<{ROW_COLUMNS}d")
+
+# Column names of a row, in file order
+COLUMN_NAMES = (
+    ("point_index", "x", "y")
+    + tuple(f"voltage_{name}" for name in MEASUREMENT_COMPONENTS)
+    + tuple(f"std_dev_{name}" for name in MEASUREMENT_COMPONENTS)
+    + ("sample_count", "level")
+)
+
+
+def encode_header(metadata: Dict[str, Any]) -> bytes:
+    """Build the padded file header for the given metadata."""
+    meta = json.dumps(metadata, default=str).encode("utf-8")
+    size = _FIXED_HEADER.size + len(meta)
+    header_size = -(-size // HEADER_ALIGN) * HEADER_ALIGN
+    fixed = _FIXED_HEADER.pack(MAGIC, FORMAT_VERSION, ROW_COLUMNS, header_size, len(meta))
+    return (fixed + meta).ljust(header_size, b"\0")
+
+
+def read_header(path: Path) -> Tuple[Dict[str, Any], int]:
+    """
+    Read the header of a binary scan file.
+
+    Returns:
+        (metadata, header_size)
+
+    Raises:
+        ValueError: If the file is not a binary scan file of a known layout.
+    """
+    metadata, header_size, _columns = read_layout(path)
+    return metadata, header_size
+
+
+def read_layout(path: Path) -> Tuple[Dict[str, Any], int, int]:
+    """
+    Like read_header(), plus the number of columns per row of this file.
+
+    Raises:
+        ValueError: If the file is not a binary scan file of a known layout.
+    """
+    with Path(path).open("rb") as f:
+        fixed = f.read(_FIXED_HEADER.size)
+        if len(fixed) < _FIXED_HEADER.size:
+            raise ValueError(f"Truncated binary scan header: {path}")
+        magic, version, columns, header_size, meta_len = _FIXED_HEADER.unpack(fixed)
+        if magic != MAGIC:
+            raise ValueError(f"Not a binary scan file: {path}")
+        if _COLUMNS_BY_VERSION.get(version) != columns:
+            raise ValueError(f"Unsupported binary scan layout (version={version}, columns={columns}): {path}")
+        metadata = json.loads(f.read(meta_len).decode("utf-8")) if meta_len else {}
+    return metadata, header_size, columns
+
+
+def row_count(path: Path, header_size: int, columns: int = ROW_COLUMNS) -> int:
+    """Number of complete rows in the file (a partial trailing row is ignored)."""
+    return max(0, (os.path.getsize(path) - header_size) // (columns * 8))
+
+
+def open_memmap(path: Path):
+    """
+    Memory-map the rows of a binary scan file.
+
+    Returns:
+        (metadata, rows): rows is a read-only np.memmap of shape (N, columns),
+        columns = ROW_COLUMNS for files of the current version.
+    """
+    import numpy as np
+
+    metadata, header_size, columns = read_layout(path)
+    n = row_count(path, header_size, columns)
+    if n == 0:
+        return metadata, np.empty((0, columns), dtype="<f8")
+    rows = np.memmap(path, dtype="<f8", mode="r", offset=header_size, shape=(n, columns))
+    return metadata, rows
+
+
+def iter_rows(path: Path) -> Iterator[ScanPointRow]:
+    """Typed rows of a binary scan file (stdlib only)."""
+    metadata, header_size, columns = read_layout(path)
+    scan_id = str(metadata.get("scan_id", ""))
+    n = row_count(path, header_size, columns)
+    n_meas = len(MEASUREMENT_COMPONENTS)
+    std_end = 3 + 2 * n_meas
+    row_struct = _ROW if columns == ROW_COLUMNS else struct.Struct(f"<{columns}d")
+    with Path(path).open("rb") as f:
+        f.seek(header_size)
+        for _ in range(n):
+            values = row_struct.unpack(f.read(row_struct.size))
+            extra = values[std_end:]
+            yield ScanPointRow(
+                scan_id=scan_id,
+                point_index=int(values[0]),
+                x=values[1],
+                y=values[2],
+                voltages=values[3:3 + n_meas],
+                std_devs=tuple(None if math.isnan(v) else v for v in values[3 + n_meas:std_end]),
+                sample_count=int(extra[0]) if extra and not math.isnan(extra[0]) else None,
+                level=int(extra[1]) if extra else 0,
+            )
+
+
+def convert_to_csv(path: Path, csv_path: Optional[Path] = None) -> Path:
+    """
+    Convert a binary scan file to the CSV layout of `CsvScanExportPort`.
+
+    Args:
+        path: Binary scan file.
+        csv_path: Destination (default: same name with a .csv extension).
+
+    Returns:
+        The CSV path.
+    """
+    path = Path(path)
+    csv_path = Path(csv_path) if csv_path is not None else path.with_suffix(".csv")
+    with csv_path.open("w", newline="", encoding="utf-8") as out:
+        writer = None
+        for row in iter_rows(path):
+            data = row.as_dict()
+            if writer is None:
+                writer = csv.DictWriter(out, fieldnames=list(data.keys()))
+                writer.writeheader()
+            writer.writerow({k: ("" if v is None else v) for k, v in data.items()})
+    return csv_path
+
+
+@dataclass
+class BinaryScanExportPort(IScanExportPort):
+    """
+    Fixed-layout binary implementation of `IScanExportPort`.
+
+    Notes:
+    - Files are written under `.aefi_acquisition/scans/raw_data` by default,
+      named `YYYY-MM-DD_HHMMSS_<filename>.aefscan`.
+    - Read back with `open_memmap` (numpy) or `iter_rows` / `convert_to_csv`.
+    """
+
+    base_output_dir: Path = field(
+        default_factory=lambda: Path(".aefi_acquisition") / "scans" / "raw_data"
+    )
+
+    _file_path: Optional[Path] = field(init=False, default=None)
+    _file: Optional[BinaryIO] = field(init=False, default=None)
+    _metadata: Dict[str, Any] = field(init=False, default_factory=dict)
+    _rows: int = field(init=False, default=0)
+
+    def configure(
+        self, directory: str, filename: str, metadata: Dict[str, Any]
+    ) -> None:
+        """
+        Configure the export destination.
+
+        - `directory`: if absolute, used as-is; if relative or empty,
+          resolved under `base_output_dir`.
+        - `filename`: logical base name; a timestamp is prepended and
+          FILE_EXTENSION appended.
+        - `metadata`: stored as JSON in the file header.
+        """
+        if directory:
+            dir_path = Path(directory)
+            if not dir_path.is_absolute():
+                dir_path = self.base_output_dir / dir_path
+        else:
+            dir_path = self.base_output_dir
+
+        dir_path.mkdir(parents=True, exist_ok=True)
+
+        timestamp = datetime.now().strftime("%Y-%m-%d_%H%M%S")
+        safe_base = "".join(c for c in filename if c.isalnum() or c in ("-", "_"))
+        self._file_path = dir_path / f"{timestamp}_{safe_base}{FILE_EXTENSION}"
+        self._metadata = metadata or {}
+        logger.debug("Binary scan export configured at %s", self._file_path)
+
+    @property
+    def file_path(self) -> Optional[Path]:
+        return self._file_path
+
+    def start(self) -> None:
+        """Create the file and write the header."""
+        if self._file_path is None:
+            raise RuntimeError("BinaryScanExportPort.configure() must be called before start().")
+
+        if self._file is not None:
+            # Already started.
+            return
+
+        print(f"[BinaryScanExportPort] Opening file for writing: {self._file_path}")
+        self._file = self._file_path.open("wb")
+        self._file.write(encode_header(self._metadata))
+        self._file.flush()
+        self._rows = 0
+
+    def write_point(self, data: Dict[str, Any]) -> None:
+        """Append a point given as a flat dict (see `ScanPointRow.as_dict`)."""
+        self.write_row(ScanPointRow.from_dict(data))
+
+    def write_row(self, row: ScanPointRow) -> None:
+        """Append one packed row and hand it to the OS (crash-safe)."""
+        if self._file is None:
+            raise RuntimeError("BinaryScanExportPort.start() must be called before write_point().")
+
+        t0 = TRACER.start()
+        self._file.write(_ROW.pack(
+            float(row.point_index),
+            row.x,
+            row.y,
+            *row.voltages,
+            *(math.nan if v is None else v for v in row.std_devs),
+            math.nan if row.sample_count is None else float(row.sample_count),
+            float(row.level),
+        ))
+        self._file.flush()
+        self._rows += 1
+        TRACER.end("export", "binary_row", t0)
+
+    def stop(self) -> None:
+        """Sync and close the file."""
+        if self._file is not None:
+            try:
+                self._file.flush()
+                os.fsync(self._file.fileno())
+            finally:
+                self._file.close()
+            print(f"[BinaryScanExportPort] Closed {self._file_path} ({self._rows} points)")
+
+        self._file = None
+        self._file_path = None
+        self._rows = 0
@@ -22,6 +22,7 @@ from typing import Dict, Any, Optional, List, TextIO
 from application.services.scan_application_service.i_scan_export_port import (
     IScanExportPort,
 )
+from infrastructure.instrumentation.hot_path_tracer import TRACER
 
 
 logger = logging.getLogger(__name__)
@@ -123,10 +124,12 @@ class CsvScanExportPort(IScanExportPort):
             self._writer.fieldnames = self._fieldnames  # type: ignore[attr-defined]
             self._writer.writeheader()
 
+        t0 = TRACER.start()
         # Only keep known keys to avoid mismatches.
         row = {k: data.get(k, "") for k in self._fieldnames}
         self._writer.writerow(row)
         self._file.flush()
+        TRACER.end("export", "csv_row", t0)
         # print(f"[CsvScanExportPort] Wrote point: {row.get('point_index', '?')}")
 
     def stop(self) -> None:
@@ -1,6 +1,7 @@
 import h5py
 import numpy as np
-from typing import List
+from contextlib import contextmanager
+from typing import Iterator, List, Optional, Sequence, Union
 from pathlib import Path
 from datetime import datetime
 import logging
@@ -10,10 +11,28 @@ from domain.value_objects.acquisition.acquisition_sample import AcquisitionSampl
 
 logger = logging.getLogger(__name__)
 
+DATASET_NAME = 'acquisition_data'
+
+# Record layout of `acquisition_data`
+SAMPLE_DTYPE = np.dtype([
+    ('timestamp', 'f8'),
+    ('x_in_phase', 'f8'), ('x_quadrature', 'f8'),
+    ('y_in_phase', 'f8'), ('y_quadrature', 'f8'),
+    ('z_in_phase', 'f8'), ('z_quadrature', 'f8')
+])
+
+TimeBound = Union[datetime, float, None]
+
+
 class HDF5AcquisitionRepository(IAcquisitionDataRepository):
     """
     HDF5 implementation of the Acquisition Data Repository.
     Persists acquisition samples to an HDF5 file.
+
+    Two read paths:
+    - find_by_scan: list of AcquisitionSample (small reads, domain objects).
+    - read_columns / open_dataset: structured numpy records, optionally
+      restricted to a time range, without one Python object per sample.
     """
     
     def __init__(self, base_path: str = "data"):
@@ -35,7 +54,7 @@ class HDF5AcquisitionRepository(IAcquisitionDataRepository):
         try:
             with h5py.File(file_path, mode) as f:
                 # Create or get the group for samples
-                if 'acquisition_data' not in f:
+                if DATASET_NAME not in f:
                     # Initialize datasets with resizable dimensions
                     # We'll store each component as a separate dataset or a compound dataset
                     # For simplicity/performance, let's use a compound dataset or simple arrays
@@ -44,22 +63,15 @@ class HDF5AcquisitionRepository(IAcquisitionDataRepository):
                     # We have 6 float components + timestamp
                     # Timestamps in HDF5 are tricky, usually stored as POSIX timestamp (float)
                     
-                    dt = np.dtype([
-                        ('timestamp', 'f8'),
-                        ('x_in_phase', 'f8'), ('x_quadrature', 'f8'),
-                        ('y_in_phase', 'f8'), ('y_quadrature', 'f8'),
-                        ('z_in_phase', 'f8'), ('z_quadrature', 'f8')
-                    ])
-                    
                     dset = f.create_dataset(
-                        'acquisition_data', 
+                        DATASET_NAME,
                         shape=(0,), 
                         maxshape=(None,), 
-                        dtype=dt,
+                        dtype=SAMPLE_DTYPE,
                         chunks=True
                     )
                 else:
-                    dset = f['acquisition_data']
+                    dset = f[DATASET_NAME]
                 
                 # Prepare data for appending
                 new_data = np.zeros(len(data), dtype=dset.dtype)
@@ -82,28 +94,91 @@ class HDF5AcquisitionRepository(IAcquisitionDataRepository):
             raise
 
     def find_by_scan(self, scan_id: str) -> List[AcquisitionSample]:
-        file_path = self._get_file_path(scan_id)
-        if not file_path.exists():
-            return []
-            
-        samples = []
+        """Thin wrapper over read_columns; prefer read_columns for long captures."""
+        records = self.read_columns(scan_id)
+        return [
+            AcquisitionSample(
+                timestamp=datetime.fromtimestamp(ts),
+                voltage_x_in_phase=xi,
+                voltage_x_quadrature=xq,
+                voltage_y_in_phase=yi,
+                voltage_y_quadrature=yq,
+                voltage_z_in_phase=zi,
+                voltage_z_quadrature=zq
+            )
+            # tolist(): one C-level conversion instead of per-field numpy scalars
+            for ts, xi, xq, yi, yq, zi, zq in records.tolist()
+        ]
+
+    def read_columns(
+        self,
+        scan_id: str,
+        start: TimeBound = None,
+        end: TimeBound = None,
+        fields: Optional[Sequence[str]] = None,
+    ) -> np.ndarray:
+        """
+        Read samples as a structured numpy array (SAMPLE_DTYPE).
+
+        Args:
+            scan_id: Scan identifier.
+            start, end: Optional time range [start, end), datetime or POSIX
+                seconds. Samples are appended in time order, so the range is
+                located by binary search and only that slice is read.
+            fields: Optional subset of SAMPLE_DTYPE field names.
+
+        Returns:
+            1-D structured array (empty if the scan has no data).
+        """
+        dtype = SAMPLE_DTYPE if fields is None else SAMPLE_DTYPE[list(fields)]
         try:
-            with h5py.File(file_path, 'r') as f:
-                if 'acquisition_data' in f:
-                    dset = f['acquisition_data']
-                    for row in dset:
-                        ts = datetime.fromtimestamp(row['timestamp'])
-                        samples.append(AcquisitionSample(
-                            timestamp=ts,
-                            voltage_x_in_phase=row['x_in_phase'],
-                            voltage_x_quadrature=row['x_quadrature'],
-                            voltage_y_in_phase=row['y_in_phase'],
-                            voltage_y_quadrature=row['y_quadrature'],
-                            voltage_z_in_phase=row['z_in_phase'],
-                            voltage_z_quadrature=row['z_quadrature']
-                        ))
+            with self.open_dataset(scan_id) as dset:
+                if dset is None:
+                    return np.empty(0, dtype=dtype)
+                lo, hi = self._time_slice(dset, start, end)
+                if fields is None:
+                    return dset[lo:hi]
+                return dset.fields(list(fields))[lo:hi]
         except Exception as e:
             logger.error(f"Failed to read data from HDF5: {e}")
             raise
-            
-        return samples
+
+    @contextmanager
+    def open_dataset(self, scan_id: str) -> Iterator[Optional[h5py.Dataset]]:
+        """
+        Open the scan's `acquisition_data` dataset read-only (lazy access).
+
+        Yields None if the scan has no data. Slicing the dataset reads only
+        the requested rows; it is closed when the context exits.
+        """
+        file_path = self._get_file_path(scan_id)
+        if not file_path.exists():
+            yield None
+            return
+        with h5py.File(file_path, 'r') as f:
+            yield f[DATASET_NAME] if DATASET_NAME in f else None
+
+    @staticmethod
+    def _time_slice(dset: h5py.Dataset, start: TimeBound, end: TimeBound) -> tuple:
+        """Row bounds of [start, end) by bisection on the timestamp column."""
+        n = dset.shape[0]
+        lo = 0 if start is None else HDF5AcquisitionRepository._bisect(dset, _to_posix(start))
+        hi = n if end is None else HDF5AcquisitionRepository._bisect(dset, _to_posix(end))
+        return lo, max(lo, hi)
+
+    @staticmethod
+    def _bisect(dset: h5py.Dataset, t: float) -> int:
+        """First row with timestamp >= t (O(log n) single-element reads)."""
+        timestamps = dset.fields('timestamp')
+        lo, hi = 0, dset.shape[0]
+        while lo < hi:
+            mid = (lo + hi) // 2
+            if timestamps[mid] < t:
+                lo = mid + 1
+            else:
+                hi = mid
+        return lo
+
+
+def _to_posix(value: Union[datetime, float]) -> float:
+    return value.timestamp() if isinstance(value, datetime) else float(value)
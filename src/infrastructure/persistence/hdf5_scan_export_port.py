@@ -7,6 +7,17 @@ Responsibility:
 
 Rationale:
 - Provide a structured, scalable format for scientific post-processing of scans.
+
+Design:
+- Datasets preallocated to x_nb_points * y_nb_points (ScanStarted metadata),
+  chunked by `chunk_rows`.
+- Points accumulate in one contiguous in-memory block (chunk_rows x 16) and
+  are flushed one block at a time (one write per dataset per block instead of
+  a resize + three writes per point), optionally on a background thread.
+- Datasets are trimmed to the points actually written on stop().
+- Raw capture (optional): every sample of every point under `/raw_data`,
+  appended per point into compressed extendible datasets plus an offsets
+  table, so one point is read back as one contiguous slice.
 """
 
 from __future__ import annotations
@@ -15,18 +26,47 @@ import logging
 from dataclasses import dataclass, field
 from datetime import datetime
 from pathlib import Path
-from typing import Dict, Any, Optional
+from typing import Dict, Any, Optional, Sequence
 
 import h5py
 import numpy as np
 
 from application.services.scan_application_service.i_scan_export_port import (
     IScanExportPort,
+    ScanPointRow,
 )
+from infrastructure.execution.pipeline_stage import PipelineStage
+from infrastructure.instrumentation.hot_path_tracer import TRACER
+from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
 
 
 logger = logging.getLogger(__name__)
 
+# Column layout of the in-memory block: x, y | 6 means | 6 std devs | sample count | level
+_POS = slice(0, 2)
+_MEAS = slice(2, 8)
+_STD = slice(8, 14)
+_COUNT = 14
+_LEVEL = 15
+_BLOCK_COLUMNS = 16
+
+# Raw samples: rows per chunk (6 x f8 -> 192 KiB per chunk)
+RAW_CHUNK_ROWS = 4096
+
+
+def _raw_compression() -> Dict[str, Any]:
+    """
+    Dataset filter options for raw samples.
+
+    Blosc/LZ4 with byte shuffle when hdf5plugin is installed (fast enough to
+    keep up with acquisition), otherwise the built-in LZF filter.
+    """
+    try:
+        import hdf5plugin
+        return dict(hdf5plugin.Blosc(cname="lz4", clevel=5, shuffle=hdf5plugin.Blosc.SHUFFLE))
+    except ImportError:
+        return {"compression": "lzf", "shuffle": True}
+
 
 @dataclass
 class Hdf5ScanExportPort(IScanExportPort):
@@ -40,18 +80,43 @@ class Hdf5ScanExportPort(IScanExportPort):
         * positions: shape (N, 2)   -> columns: [x, y]
         * measurements: shape (N, 6)-> mean voltages
         * std_dev: shape (N, 6)     -> standard deviations
+        * sample_counts: shape (N,) int64 -> samples averaged per point
+          (varies with adaptive averaging; 0 if not reported)
+        * levels: shape (N,) int64 -> resolution level of each point
+          (0 = coarse grid, n = n-th refinement pass)
+    - Datasets under `/raw_data` (only if raw samples were written):
+        * samples: shape (S, 6)     -> every sample, in acquisition order
+        * timestamps: shape (S,)    -> POSIX seconds of each sample
+        * point_offsets: shape (P, 3) int64 -> [point_index, start, count]
+
+    Options:
+    - chunk_rows: points per HDF5 chunk and per flush.
+    - background_writer: flush blocks from a dedicated thread.
     """
 
     base_output_dir: Path = field(
         default_factory=lambda: Path(".aefi_acquisition") / "scans" / "raw_data"
     )
+    chunk_rows: int = 256
+    background_writer: bool = False
 
     _file_path: Optional[Path] = field(init=False, default=None)
     _file: Optional[h5py.File] = field(init=False, default=None)
     _pos_dset = None
     _meas_dset = None
     _std_dset = None
+    _count_dset = None
+    _level_dset = None
     _index: int = field(init=False, default=0)
+    _block: Optional[np.ndarray] = field(init=False, default=None)
+    _block_fill: int = field(init=False, default=0)
+    _written: int = field(init=False, default=0)
+    _writer: Optional[PipelineStage] = field(init=False, default=None)
+    _raw_samples_dset = None
+    _raw_time_dset = None
+    _raw_offsets_dset = None
+    _raw_written: int = field(init=False, default=0)
+    _raw_points: int = field(init=False, default=0)
 
     def configure(
         self, directory: str, filename: str, metadata: Dict[str, Any]
@@ -104,100 +169,244 @@ class Hdf5ScanExportPort(IScanExportPort):
 
         scan_group = root.create_group("scan_data")
 
+        expected = int(self._metadata.get("x_nb_points", 0) or 0) * int(self._metadata.get("y_nb_points", 0) or 0)
+        chunk_rows = max(1, min(self.chunk_rows, expected) if expected > 0 else self.chunk_rows)
+
         # Positions: (x, y)
         self._pos_dset = scan_group.create_dataset(
             "positions",
-            shape=(0, 2),
+            shape=(expected, 2),
             maxshape=(None, 2),
             dtype="f8",
-            chunks=True,
+            chunks=(chunk_rows, 2),
+            fillvalue=np.nan,
         )
 
         # Measurements: 6 components
         self._meas_dset = scan_group.create_dataset(
             "measurements",
-            shape=(0, 6),
+            shape=(expected, 6),
             maxshape=(None, 6),
             dtype="f8",
-            chunks=True,
+            chunks=(chunk_rows, 6),
+            fillvalue=np.nan,
         )
 
         # Standard deviations: 6 components
         self._std_dset = scan_group.create_dataset(
             "std_dev",
-            shape=(0, 6),
+            shape=(expected, 6),
             maxshape=(None, 6),
             dtype="f8",
-            chunks=True,
+            chunks=(chunk_rows, 6),
+            fillvalue=np.nan,
+        )
+
+        # Samples averaged per point (adaptive averaging)
+        self._count_dset = scan_group.create_dataset(
+            "sample_counts",
+            shape=(expected,),
+            maxshape=(None,),
+            dtype="i8",
+            chunks=(chunk_rows,),
+            fillvalue=0,
+        )
+
+        # Resolution level per point (multi-resolution scans)
+        self._level_dset = scan_group.create_dataset(
+            "levels",
+            shape=(expected,),
+            maxshape=(None,),
+            dtype="i8",
+            chunks=(chunk_rows,),
+            fillvalue=0,
         )
 
         self._index = 0
+        self._written = 0
+        self._raw_written = 0
+        self._raw_points = 0
+        self._block = np.empty((chunk_rows, _BLOCK_COLUMNS), dtype="f8")
+        self._block_fill = 0
+        if self.background_writer:
+            self._writer = PipelineStage(name="Hdf5ScanExportWriter", max_pending=8)
 
     def write_point(self, data: Dict[str, Any]) -> None:
         """
-        Append a single point to the datasets.
+        Append a single point given as a flat dict.
 
-        Expected keys in `data` (as produced by `ScanExportService._flatten_point`):
+        Expected keys in `data` (see `ScanPointRow.as_dict`):
         - x, y
         - voltage_* (6 fields)
         - std_dev_* (6 fields)
         """
-        if self._file is None or self._pos_dset is None:
-            raise RuntimeError("Hdf5ScanExportPort.start() must be called before write_point().")
+        self.write_row(ScanPointRow.from_dict(data))
 
-        x = float(data["x"])
-        y = float(data["y"])
+    def write_row(self, row: ScanPointRow) -> None:
+        """Append a typed point to the in-memory block; flush when the block is full."""
+        if self._file is None or self._block is None:
+            raise RuntimeError("Hdf5ScanExportPort.start() must be called before write_point().")
 
-        meas = np.array(
+        t0 = TRACER.start()
+        line = self._block[self._block_fill]
+        line[0] = row.x
+        line[1] = row.y
+        line[_MEAS] = row.voltages
+        # Std devs may be None if not computed; replace None by NaN for clarity.
+        line[_STD] = [np.nan if v is None else v for v in row.std_devs]
+        line[_COUNT] = 0 if row.sample_count is None else row.sample_count
+        line[_LEVEL] = row.level
+        self._block_fill += 1
+        self._index += 1
+
+        if self._block_fill == len(self._block):
+            self._flush_block()
+        TRACER.end("export", "hdf5_row", t0)
+
+    def _flush_block(self) -> None:
+        """Hand the filled part of the block to the writer (copy if asynchronous)."""
+        if self._block_fill == 0:
+            return
+        start = self._index - self._block_fill
+        if self._writer is not None:
+            self._writer.submit(self._write_block, start, self._block[:self._block_fill].copy())
+        else:
+            self._write_block(start, self._block[:self._block_fill])
+        self._block_fill = 0
+
+    def _write_block(self, start: int, block: np.ndarray) -> None:
+        """One contiguous write per dataset (grows the datasets if the grid was unknown)."""
+        t0 = TRACER.start()
+        end = start + len(block)
+        if end > self._pos_dset.shape[0]:
+            new_size = max(end, self._pos_dset.shape[0] + len(self._block))
+            self._pos_dset.resize((new_size, 2))
+            self._meas_dset.resize((new_size, 6))
+            self._std_dset.resize((new_size, 6))
+            self._count_dset.resize((new_size,))
+            self._level_dset.resize((new_size,))
+        self._pos_dset[start:end] = block[:, _POS]
+        self._meas_dset[start:end] = block[:, _MEAS]
+        self._std_dset[start:end] = block[:, _STD]
+        self._count_dset[start:end] = block[:, _COUNT].astype("i8")
+        self._level_dset[start:end] = block[:, _LEVEL].astype("i8")
+        self._written = end
+        TRACER.end("export", "hdf5_block", t0)
+
+    def supports_raw_samples(self) -> bool:
+        return True
+
+    def write_raw_samples(self, point_index: int, samples: Sequence[VoltageMeasurement]) -> None:
+        """Append the raw samples of one point under `/raw_data`."""
+        if self._file is None:
+            raise RuntimeError("Hdf5ScanExportPort.start() must be called before write_raw_samples().")
+        if not samples:
+            return
+        values = np.array(
             [
-                float(data["voltage_x_in_phase"]),
-                float(data["voltage_x_quadrature"]),
-                float(data["voltage_y_in_phase"]),
-                float(data["voltage_y_quadrature"]),
-                float(data["voltage_z_in_phase"]),
-                float(data["voltage_z_quadrature"]),
+                (
+                    m.voltage_x_in_phase, m.voltage_x_quadrature,
+                    m.voltage_y_in_phase, m.voltage_y_quadrature,
+                    m.voltage_z_in_phase, m.voltage_z_quadrature,
+                )
+                for m in samples
             ],
             dtype="f8",
         )
+        times = np.array([m.timestamp.timestamp() for m in samples], dtype="f8")
+        if self._writer is not None:
+            self._writer.submit(self._write_raw, point_index, values, times)
+        else:
+            self._write_raw(point_index, values, times)
 
-        # Std devs may be None if not computed; replace None by NaN for clarity.
-        std_vals = [
-            data.get("std_dev_x_in_phase"),
-            data.get("std_dev_x_quadrature"),
-            data.get("std_dev_y_in_phase"),
-            data.get("std_dev_y_quadrature"),
-            data.get("std_dev_z_in_phase"),
-            data.get("std_dev_z_quadrature"),
-        ]
-        std = np.array(
-            [np.nan if v is None else float(v) for v in std_vals],
+    def _create_raw_datasets(self) -> None:
+        raw_group = self._file.create_group("raw_data")
+        filters = _raw_compression()
+        self._raw_samples_dset = raw_group.create_dataset(
+            "samples",
+            shape=(0, 6),
+            maxshape=(None, 6),
             dtype="f8",
+            chunks=(RAW_CHUNK_ROWS, 6),
+            **filters,
+        )
+        self._raw_time_dset = raw_group.create_dataset(
+            "timestamps",
+            shape=(0,),
+            maxshape=(None,),
+            dtype="f8",
+            chunks=(RAW_CHUNK_ROWS,),
+            **filters,
+        )
+        self._raw_offsets_dset = raw_group.create_dataset(
+            "point_offsets",
+            shape=(0, 3),
+            maxshape=(None, 3),
+            dtype="i8",
+            chunks=(max(1, self.chunk_rows), 3),
         )
 
-        new_size = self._index + 1
-        self._pos_dset.resize((new_size, 2))
-        self._meas_dset.resize((new_size, 6))
-        self._std_dset.resize((new_size, 6))
-
-        self._pos_dset[self._index, :] = [x, y]
-        self._meas_dset[self._index, :] = meas
-        self._std_dset[self._index, :] = std
-
-        self._index = new_size
+    def _write_raw(self, point_index: int, values: np.ndarray, times: np.ndarray) -> None:
+        """Append one point; datasets grow geometrically and are trimmed on stop()."""
+        if self._raw_samples_dset is None:
+            self._create_raw_datasets()
+        start = self._raw_written
+        end = start + len(values)
+        capacity = self._raw_samples_dset.shape[0]
+        if end > capacity:
+            new_size = max(end, 2 * capacity, RAW_CHUNK_ROWS)
+            self._raw_samples_dset.resize((new_size, 6))
+            self._raw_time_dset.resize((new_size,))
+        self._raw_samples_dset[start:end] = values
+        self._raw_time_dset[start:end] = times
+
+        row = self._raw_points
+        if row >= self._raw_offsets_dset.shape[0]:
+            self._raw_offsets_dset.resize((max(row + 1, 2 * row, self.chunk_rows), 3))
+        self._raw_offsets_dset[row] = (point_index, start, len(values))
+        self._raw_points = row + 1
+        self._raw_written = end
 
     def stop(self) -> None:
-        """Close the HDF5 file."""
+        """Flush pending points, trim the datasets and close the HDF5 file."""
         if self._file is not None:
             try:
+                self._flush_block()
+                if self._writer is not None:
+                    self._writer.drain()
+                # Cancelled / partial scans: drop the unfilled preallocated rows
+                if self._pos_dset.shape[0] != self._written:
+                    self._pos_dset.resize((self._written, 2))
+                    self._meas_dset.resize((self._written, 6))
+                    self._std_dset.resize((self._written, 6))
+                    self._count_dset.resize((self._written,))
+                    self._level_dset.resize((self._written,))
+                if self._raw_samples_dset is not None:
+                    self._raw_samples_dset.resize((self._raw_written, 6))
+                    self._raw_time_dset.resize((self._raw_written,))
+                    self._raw_offsets_dset.resize((self._raw_points, 3))
                 self._file.flush()
             finally:
+                if self._writer is not None:
+                    self._writer.close()
+                    self._writer = None
                 self._file.close()
 
         self._file = None
         self._pos_dset = None
         self._meas_dset = None
         self._std_dset = None
+        self._count_dset = None
+        self._level_dset = None
+        self._raw_samples_dset = None
+        self._raw_time_dset = None
+        self._raw_offsets_dset = None
+        self._raw_written = 0
+        self._raw_points = 0
         self._file_path = None
         self._index = 0
+        self._block = None
+        self._block_fill = 0
+        self._written = 0
 
 
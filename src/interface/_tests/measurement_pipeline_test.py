@@ -0,0 +1,70 @@
+import unittest
+
+import numpy as np
+
+from application.services.transformation_service.transformation_service import TransformationService
+from interface.presenters.measurement_pipeline import CHANNEL_KEYS, MeasurementPipeline
+from interface.presenters.signal_processor import SignalPostProcessor
+
+
+class TestMeasurementPipeline(unittest.TestCase):
+    def setUp(self):
+        self.processor = SignalPostProcessor()
+        self.transformation = TransformationService()
+        self.pipeline = MeasurementPipeline(self.processor, self.transformation)
+        rng = np.random.default_rng(0)
+        self.block = rng.normal(size=(200, 6))
+        self.block[0, 0] = 0.0  # I == 0: sign taken from Q
+
+    def _reference(self, row):
+        """Original per-sample chain: process_sample then two vector rotations."""
+        p = self.processor.process_sample(dict(zip(CHANNEL_KEYS, row)))
+        i_out = self.transformation.transform_sensor_to_source(
+            (p["Ux In-Phase"], p["Uy In-Phase"], p["Uz In-Phase"]))
+        q_out = self.transformation.transform_sensor_to_source(
+            (p["Ux Quadrature"], p["Uy Quadrature"], p["Uz Quadrature"]))
+        return [i_out[0], q_out[0], i_out[1], q_out[1], i_out[2], q_out[2]]
+
+    def _assert_matches_reference(self):
+        out = self.pipeline.process_block(self.block)
+        expected = np.array([self._reference(row) for row in self.block.tolist()])
+        np.testing.assert_allclose(out, expected, rtol=0, atol=1e-12)
+
+    def test_identity_without_calibration(self):
+        np.testing.assert_array_equal(self.pipeline.process_block(self.block), self.block)
+
+    def test_full_chain_with_sign_fix_up(self):
+        keys = dict.fromkeys(CHANNEL_KEYS)
+        self.processor.calibrate_noise(dict(zip(keys, [0.1, -0.2, 0.0, 0.05, 0.3, 0.0])))
+        self.processor.calibrate_phase(dict(zip(keys, [1.0, 2.0, -1.0, 0.5, 0.2, -3.0])))
+        self.processor.calibrate_primary(dict(zip(keys, [0.01, 0.0, -0.02, 0.0, 0.0, 0.04])))
+        self.transformation.set_rotation_angles(-45.0, 35.26, 10.0)
+        self.transformation.set_enabled(True)
+        self._assert_matches_reference()
+
+    def test_recompiles_only_on_change(self):
+        self.pipeline.process_block(self.block)
+        self.pipeline.process_block(self.block)
+        self.assertEqual(self.pipeline.compile_count, 1)
+
+        self.processor.state.noise_correction_enabled = True
+        self.processor.state.noise_offset["Uy"] = (0.5, 0.5)
+        self._assert_matches_reference()
+        self.assertEqual(self.pipeline.compile_count, 2)
+
+        self.processor.calibrate_phase(dict(zip(CHANNEL_KEYS, [0.0, 1.0, 1.0, 0.0, -1.0, -1.0])))
+        self.transformation.set_enabled(True)
+        self.transformation.set_rotation_angles(0.0, 0.0, 90.0)
+        self._assert_matches_reference()
+        self.assertEqual(self.pipeline.compile_count, 3)
+
+    def test_single_sample_path(self):
+        self.processor.calibrate_phase(dict(zip(CHANNEL_KEYS, [1.0, 1.0, 0.0, 1.0, -1.0, 0.0])))
+        row = self.block[3].tolist()
+        result = self.pipeline.process_sample(dict(zip(CHANNEL_KEYS, row)))
+        for key, value in zip(CHANNEL_KEYS, self._reference(row)):
+            self.assertAlmostEqual(result[key], value, places=12)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,68 @@
+import math
+import unittest
+
+from interface.presentation.scan_grid_model import ScanGridModel
+
+
+class TestScanGridModel(unittest.TestCase):
+    def setUp(self):
+        self.model = ScanGridModel(channels=("a", "b"))
+        self.model.initialize(0.0, 2.0, 3, 10.0, 11.0, 2)
+        self.model.take_dirty()
+
+    def test_index_from_position_uses_grid_steps(self):
+        self.assertEqual(self.model.index_of(1.0, 10.0), (1, 0))
+        self.assertEqual(self.model.index_of(2.2, 10.9), (2, 1))
+        self.assertIsNone(self.model.index_of(3.5, 10.0))
+        self.assertFalse(self.model.update_from_position(-1.0, 10.0, {"a": 1.0}))
+
+    def test_dirty_channels_are_coalesced(self):
+        self.model.update(0, 0, {"a": 1.0})
+        self.model.update(1, 0, {"a": 2.0, "unknown": 3.0})
+        self.assertEqual(self.model.take_dirty(), {"a"})
+        self.assertEqual(self.model.take_dirty(), set())
+
+    def test_running_limits(self):
+        self.assertIsNone(self.model.limits("a"))
+        for i, v in enumerate((3.0, -1.0, 5.0)):
+            self.model.update(i, 0, {"a": v})
+        self.assertEqual(self.model.limits("a"), (-1.0, 5.0))
+        self.model.update(0, 1, {"a": float("nan")})
+        self.assertEqual(self.model.limits("a"), (-1.0, 5.0))
+
+    def test_overwritten_extremum_is_rescanned(self):
+        self.model.update(0, 0, {"a": 1.0})
+        self.model.update(1, 0, {"a": 9.0})
+        self.model.update(1, 0, {"a": 2.0})
+        self.assertEqual(self.model.limits("a"), (1.0, 2.0))
+        self.assertTrue(math.isnan(self.model.grids["b"][0, 0]))
+
+    def test_refined_scan_uses_finest_lattice_and_keeps_coarse_values(self):
+        # Coarse 3 x 2 grid, 2 levels of subdivision 2: 9 x 5 cells of 0.25
+        self.model.initialize(0.0, 2.0, 3, 10.0, 11.0, 2, refinement_levels=2, subdivision=2)
+        self.assertEqual(self.model.shape, (5, 9))
+        self.assertEqual(self.model.index_of(0.75, 10.25), (3, 1))
+
+        self.model.update_from_position(1.0, 10.0, {"a": 1.0}, level=0)
+        self.model.update_from_position(0.0, 10.0, {"a": 9.0}, level=0)
+        grid = self.model.grids["a"]
+        self.assertTrue((grid[0:2, 2:6] == 1.0).all())  # Coarse point fills its 4 x 4 block
+        self.assertTrue(math.isnan(grid[2, 4]))
+
+        # Level-1 point between the two coarse points; level-2 point inside
+        self.model.update_from_position(0.5, 10.0, {"a": 3.0}, level=1)
+        self.model.update_from_position(0.75, 10.0, {"a": -2.0}, level=2)
+        self.assertEqual(grid[0, 4], 1.0)  # Coarse node cell kept
+        self.assertEqual(grid[0, 0], 9.0)
+        self.assertEqual(grid[0, 2], 3.0)
+        self.assertEqual(grid[0, 3], -2.0)
+        self.assertEqual(self.model.limits("a"), (-2.0, 9.0))
+
+        # Refined points covering the whole block of the coarse maximum remove it from the limits
+        for x, y in ((0.0, 10.0), (0.25, 10.0), (0.0, 10.25), (0.25, 10.25)):
+            self.model.update_from_position(x, y, {"a": 4.0}, level=2)
+        self.assertEqual(self.model.limits("a"), (-2.0, 4.0))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,13 +1,8 @@
+import importlib.util
 import unittest
 import math
-import sys
-from pathlib import Path
 
-# Add the skills directory to sys.path to import DiagramFriendlyTest
-skills_dir = Path(__file__).parents[3] / ".cursor" / "skills" / "diagram_friendly_test"
-sys.path.append(str(skills_dir))
-
-from diagram_friendly_test import DiagramFriendlyTest
+from tool.diagram_friendly_test import DiagramFriendlyTest
 from interface.presenters.signal_processor import SignalPostProcessor
 
 class TestSignalPostProcessor(DiagramFriendlyTest):
@@ -270,5 +265,32 @@ class TestSignalPostProcessor(DiagramFriendlyTest):
             self.assertAlmostEqual(result_mag, original_mag, places=5, 
                                  msg=f"Magnitude should be preserved: {original_mag}")
 
+    @unittest.skipUnless(importlib.util.find_spec("numpy"), "numpy not installed")
+    def test_block_matches_per_sample_path(self):
+        """process_block gives the same result as process_sample, row by row."""
+        self.log_divider("Block Processing Test")
+        keys = ["Ux In-Phase", "Ux Quadrature", "Uy In-Phase", "Uy Quadrature", "Uz In-Phase", "Uz Quadrature"]
+        rows = [
+            [1.0, 0.5, -2.0, 1.0, 0.0, -3.0],
+            [-1.0, -0.5, 2.0, 0.0, 0.0, 3.0],
+            [0.0, 0.0, 0.3, -0.7, 4.0, 4.0],
+        ]
+        self.processor.calibrate_noise(dict(zip(keys, [0.1, 0.0, 0.0, 0.2, 0.0, 0.0])))
+        self.processor.calibrate_phase(dict(zip(keys, [1.0, 1.0, -1.0, 0.5, 0.0, 2.0])))
+        self.processor.calibrate_primary(dict(zip(keys, [0.05, 0.0, 0.0, 0.0, 0.1, 0.0])))
+
+        block = self.processor.process_block(rows)
+        self.log_interaction("Test", "PROCESS", "SignalPostProcessor", "Process Block", data={"rows": len(rows)})
+        self.assertEqual(block.shape, (3, 6))
+        for row, out in zip(rows, block.tolist()):
+            expected = self.processor.process_sample(dict(zip(keys, row)))
+            for k, v in zip(keys, out):
+                self.assertAlmostEqual(v, expected[k], places=12)
+
+        # Input untouched, disabled stages are identity
+        self.processor.reset_calibration()
+        self.assertEqual(self.processor.process_block(rows).tolist(), rows)
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,57 @@
+import unittest
+
+import numpy as np
+
+from interface.presentation.time_series_plot_model import TimeSeriesPlotModel
+
+
+class TestTimeSeriesPlotModel(unittest.TestCase):
+    def _filled(self, n, capacity):
+        model = TimeSeriesPlotModel(channels=2, capacity=capacity)
+        for i in range(n):
+            model.append(float(i), [i, -i])
+        return model
+
+    def test_capacity_bounds_history(self):
+        model = self._filled(25, capacity=10)
+        self.assertEqual(len(model), 10)
+        times, values = model.window()
+        np.testing.assert_array_equal(times, np.arange(15, 25))
+        np.testing.assert_array_equal(values[:, 1], -np.arange(15, 25))
+        self.assertEqual(model.last_time, 24.0)
+
+    def test_sliding_window_across_ring_boundary(self):
+        model = self._filled(25, capacity=10)
+        for t_min, first in ((14.0, 15), (17.5, 18), (21.0, 21), (30.0, None)):
+            times, _ = model.window(t_min)
+            if first is None:
+                self.assertEqual(len(times), 0)
+            else:
+                np.testing.assert_array_equal(times, np.arange(first, 25))
+
+    def test_min_max_decimation_keeps_peaks(self):
+        model = TimeSeriesPlotModel(channels=1, capacity=1000)
+        for i in range(1000):
+            model.append(i * 0.01, [100.0 if i == 537 else float(i % 7)])
+
+        times, values = model.decimated(None, max_points=100)
+        self.assertLessEqual(len(times), 100 + 1000 // 50)
+        self.assertEqual(values.max(), 100.0)
+        self.assertEqual(values.min(), 0.0)
+        self.assertTrue(np.all(np.diff(times) >= 0))
+        self.assertAlmostEqual(times[-1], 9.99)
+
+    def test_small_window_not_decimated(self):
+        model = self._filled(5, capacity=10)
+        times, values = model.decimated(2.0, max_points=100)
+        np.testing.assert_array_equal(times, [2.0, 3.0, 4.0])
+
+    def test_dirty_flag(self):
+        model = TimeSeriesPlotModel(channels=1, capacity=4)
+        self.assertFalse(model.dirty)
+        model.append(0.0, [1.0])
+        self.assertTrue(model.dirty)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,166 @@
+"""
+Scan Grid Model - Interface V2
+
+Pure Python (numpy) presentation model behind ScanVisualizationPanel.
+
+Rationale:
+    The panel used to re-render every image and rescan every grid for its
+    color limits on each incoming point. The model records which channels
+    changed and keeps their color limits up to date per point, so the panel
+    only redraws changed images at a capped rate.
+
+Design:
+    - One (y_nb, x_nb) float grid per channel, NaN = not measured yet.
+    - Grid steps are computed once in `initialize`, not per point.
+    - Multi-resolution scans: the grids have the resolution of the finest
+      refinement level (coarse step / subdivision**levels). A point of level L
+      paints the block of subdivision**(levels - L) cells centred on it, so
+      the coarse pass fills the whole map and finer points only replace the
+      area they resolve (never the cell of another point).
+    - Running (min, max) per channel, updated in O(1) per value. Overwriting
+      a cell that held an extremum marks the limits stale; they are rescanned
+      lazily on the next `limits()` call (rare: re-measured points only).
+    - `take_dirty()` returns and clears the set of changed channels.
+"""
+
+import math
+from typing import Dict, Iterable, Optional, Set, Tuple
+
+import numpy as np
+
+CHANNELS = (
+    'x_in_phase', 'x_quadrature',
+    'y_in_phase', 'y_quadrature',
+    'z_in_phase', 'z_quadrature',
+)
+
+
+class ScanGridModel:
+    """2D scan grids with dirty tracking and incremental color limits."""
+
+    def __init__(self, channels: Iterable[str] = CHANNELS) -> None:
+        self.channels = tuple(channels)
+        self.grids: Dict[str, np.ndarray] = {}
+        self.extent = [0.0, 1.0, 0.0, 1.0]  # [x_min, x_max, y_min, y_max]
+        self._x_step = 0.0
+        self._y_step = 0.0
+        self._subdivision = 1
+        self._levels = 0
+        self._limits: Dict[str, Optional[Tuple[float, float]]] = {}
+        self._stale: Set[str] = set()
+        self._dirty: Set[str] = set()
+
+    # ------------------------------------------------------------------ #
+    # Commands
+    # ------------------------------------------------------------------ #
+
+    def initialize(self, x_min, x_max, x_nb, y_min, y_max, y_nb, refinement_levels=0, subdivision=2) -> None:
+        """
+        Allocate empty grids for a new scan.
+
+        x_nb / y_nb are the coarse grid points; with refinement_levels > 0 the
+        grids are sized to the finest lattice of the refinement.
+        """
+        self._levels = max(0, int(refinement_levels))
+        self._subdivision = int(subdivision) if self._levels else 1
+        scale = self._subdivision ** self._levels
+        x_nb, y_nb = int(x_nb), int(y_nb)
+        if scale > 1:
+            x_nb, y_nb = (x_nb - 1) * scale + 1, (y_nb - 1) * scale + 1
+        self.extent = [float(x_min), float(x_max), float(y_min), float(y_max)]
+        self._x_step = (self.extent[1] - self.extent[0]) / (x_nb - 1) if x_nb > 1 else 0.0
+        self._y_step = (self.extent[3] - self.extent[2]) / (y_nb - 1) if y_nb > 1 else 0.0
+        self.grids = {channel: np.full((y_nb, x_nb), np.nan) for channel in self.channels}
+        self._limits = {channel: None for channel in self.channels}
+        self._stale.clear()
+        self._dirty = set(self.channels)
+
+    def update(self, x_idx: int, y_idx: int, measurements: Dict[str, float], level: int = 0) -> None:
+        """Set the cell (or, for a coarse level of a refined scan, the block) of each measured channel."""
+        edge = self._subdivision ** max(0, self._levels - int(level))
+        if edge == 1:
+            cells = (y_idx, x_idx)
+        else:
+            y_nb, x_nb = self.shape
+            half = edge // 2
+            cells = (slice(max(0, y_idx - half), min(y_nb, y_idx - half + edge)),
+                     slice(max(0, x_idx - half), min(x_nb, x_idx - half + edge)))
+
+        for channel, value in measurements.items():
+            grid = self.grids.get(channel)
+            if grid is None:
+                continue
+            value = float(value)
+            limits = self._limits[channel]
+            old = grid[cells]
+            if limits is None or channel in self._stale:
+                overwrites_extremum = False
+            elif edge == 1:
+                overwrites_extremum = not math.isnan(old) and old in limits
+            else:
+                overwrites_extremum = bool(((old == limits[0]) | (old == limits[1])).any())
+            grid[cells] = value
+            self._dirty.add(channel)
+            if channel in self._stale:
+                continue
+
+            if overwrites_extremum:
+                self._stale.add(channel)
+            elif math.isnan(value):
+                continue
+            elif limits is None:
+                self._limits[channel] = (value, value)
+            elif value < limits[0]:
+                self._limits[channel] = (value, limits[1])
+            elif value > limits[1]:
+                self._limits[channel] = (limits[0], value)
+
+    def update_from_position(self, x: float, y: float, measurements: Dict[str, float], level: int = 0) -> bool:
+        """Set the cell nearest to (x, y) for a point of the given resolution level. False if outside the grid."""
+        index = self.index_of(x, y)
+        if index is None:
+            return False
+        self.update(index[0], index[1], measurements, level)
+        return True
+
+    def take_dirty(self) -> Set[str]:
+        """Channels changed since the last call (cleared)."""
+        dirty, self._dirty = self._dirty, set()
+        return dirty
+
+    def mark_all_dirty(self) -> None:
+        self._dirty = set(self.grids)
+
+    # ------------------------------------------------------------------ #
+    # Queries
+    # ------------------------------------------------------------------ #
+
+    @property
+    def shape(self) -> Optional[Tuple[int, int]]:
+        """(y_nb, x_nb), or None before initialize()."""
+        if not self.grids:
+            return None
+        return next(iter(self.grids.values())).shape
+
+    def index_of(self, x: float, y: float) -> Optional[Tuple[int, int]]:
+        """(x_idx, y_idx) of the nearest cell, or None if outside the grid."""
+        shape = self.shape
+        if shape is None:
+            return None
+        y_nb, x_nb = shape
+        x_idx = int(round((x - self.extent[0]) / self._x_step)) if self._x_step else 0
+        y_idx = int(round((y - self.extent[2]) / self._y_step)) if self._y_step else 0
+        if 0 <= x_idx < x_nb and 0 <= y_idx < y_nb:
+            return x_idx, y_idx
+        return None
+
+    def limits(self, channel: str) -> Optional[Tuple[float, float]]:
+        """(vmin, vmax) of the measured cells, or None if none is measured."""
+        if channel in self._stale:
+            grid = self.grids[channel]
+            if np.isnan(grid).all():
+                self._limits[channel] = None
+            else:
+                self._limits[channel] = (float(np.nanmin(grid)), float(np.nanmax(grid)))
+            self._stale.discard(channel)
+        return self._limits.get(channel)
@@ -0,0 +1,151 @@
+"""
+Time Series Plot Model - Interface V2
+
+Pure Python (numpy) presentation model behind the continuous acquisition plot.
+
+Rationale:
+    Unbounded Python lists and a full redraw per sample make the GUI cost grow
+    with the run length. The model keeps a fixed number of samples and reduces
+    the displayed window to about two points per pixel column.
+
+Design:
+    - Fixed-capacity ring buffer: times (n,) and values (n, channels);
+      the oldest samples are overwritten once full.
+    - Times are appended in increasing order, so the sliding-window start is
+      found by binary search (np.searchsorted) on the two ring segments.
+    - Min/max decimation: the window is split into `max_points // 2` bins;
+      each bin contributes its minimum and maximum, so peaks stay visible.
+    - No Qt dependency: the panel redraws from a timer when `dirty` is set.
+"""
+
+from typing import Optional, Sequence, Tuple
+
+import numpy as np
+
+DEFAULT_CAPACITY = 1 << 19
+
+
+class TimeSeriesPlotModel:
+    """
+    Bounded multi-channel time series with windowed, decimated views.
+
+    Args:
+        channels: Number of value columns.
+        capacity: Maximum number of samples kept.
+    """
+
+    def __init__(self, channels: int, capacity: int = DEFAULT_CAPACITY) -> None:
+        if capacity <= 0:
+            raise ValueError(f"capacity must be > 0, got {capacity}")
+        self._capacity = int(capacity)
+        self._times = np.zeros(self._capacity, dtype=np.float64)
+        self._values = np.zeros((self._capacity, channels), dtype=np.float64)
+        self._pos = 0      # next physical write slot
+        self._count = 0    # valid samples
+        self.dirty = False
+
+    # ------------------------------------------------------------------ #
+    # Commands
+    # ------------------------------------------------------------------ #
+
+    def append(self, t: float, values: Sequence[float]) -> None:
+        """Append one sample (t must not decrease)."""
+        self._times[self._pos] = t
+        self._values[self._pos] = values
+        self._pos = (self._pos + 1) % self._capacity
+        if self._count < self._capacity:
+            self._count += 1
+        self.dirty = True
+
+    def clear(self) -> None:
+        self._pos = 0
+        self._count = 0
+        self.dirty = True
+
+    # ------------------------------------------------------------------ #
+    # Queries
+    # ------------------------------------------------------------------ #
+
+    def __len__(self) -> int:
+        return self._count
+
+    @property
+    def capacity(self) -> int:
+        return self._capacity
+
+    @property
+    def last_time(self) -> Optional[float]:
+        if self._count == 0:
+            return None
+        return float(self._times[(self._pos - 1) % self._capacity])
+
+    def window(self, t_min: Optional[float] = None) -> Tuple[np.ndarray, np.ndarray]:
+        """
+        Samples with time >= t_min (all samples if None), oldest first.
+
+        Returns:
+            (times (n,), values (n, channels)): views when the window does not
+            cross the ring boundary, copies otherwise.
+        """
+        lo = 0 if t_min is None else self._search(t_min)
+        return self._logical_slice(lo, self._count)
+
+    def decimated(self, t_min: Optional[float], max_points: int) -> Tuple[np.ndarray, np.ndarray]:
+        """
+        Window reduced to at most ~max_points points per channel (min/max per bin).
+
+        Returns:
+            (times (m,), values (m, channels))
+        """
+        times, values = self.window(t_min)
+        n = len(times)
+        bins = max(1, max_points // 2)
+        if n <= 2 * bins:
+            return times, values
+
+        size = n // bins
+        n_full = bins * size
+        blocks = values[:n_full].reshape(bins, size, -1)
+        out_values = np.empty((2 * bins, values.shape[1]), dtype=values.dtype)
+        out_values[0::2] = blocks.min(axis=1)
+        out_values[1::2] = blocks.max(axis=1)
+        bin_times = times[:n_full].reshape(bins, size)
+        out_times = np.empty(2 * bins, dtype=times.dtype)
+        out_times[0::2] = bin_times[:, 0]
+        out_times[1::2] = bin_times[:, -1]
+        # Remainder (< size samples) kept as-is so the newest sample is shown
+        if n_full < n:
+            out_times = np.concatenate((out_times, times[n_full:]))
+            out_values = np.concatenate((out_values, values[n_full:]))
+        return out_times, out_values
+
+    # ------------------------------------------------------------------ #
+    # Internal
+    # ------------------------------------------------------------------ #
+
+    def _start(self) -> int:
+        return (self._pos - self._count) % self._capacity
+
+    def _search(self, t: float) -> int:
+        """Logical index of the first sample with time >= t."""
+        start = self._start()
+        first_len = min(self._count, self._capacity - start)
+        first = self._times[start:start + first_len]
+        if first_len and t <= first[-1]:
+            return int(np.searchsorted(first, t, side="left"))
+        second = self._times[:self._count - first_len]
+        return first_len + int(np.searchsorted(second, t, side="left"))
+
+    def _logical_slice(self, lo: int, hi: int) -> Tuple[np.ndarray, np.ndarray]:
+        start = self._start()
+        a = (start + lo) % self._capacity
+        n = hi - lo
+        if n <= 0:
+            return self._times[:0], self._values[:0]
+        if a + n <= self._capacity:
+            return self._times[a:a + n], self._values[a:a + n]
+        first = self._capacity - a
+        return (
+            np.concatenate((self._times[a:], self._times[:n - first])),
+            np.concatenate((self._values[a:], self._values[:n - first])),
+        )
@@ -3,10 +3,15 @@ Continuous Acquisition Presenter - Interface V2
 
 Bridges between ContinuousAcquisitionService and ContinuousAcquisitionPanel.
 Adapted from interface v1 for PySide6.
+
+Samples are drained from the service buffer by a UI-thread timer (blocks of
+records), so post-processing and Qt emission never run on the acquisition thread.
 """
 
-from PySide6.QtCore import QObject, Signal, Slot
-from typing import Dict, Any
+from datetime import datetime
+
+from PySide6.QtCore import QObject, QTimer, Signal, Slot
+from typing import Dict, Any, List
 
 from application.services.continuous_acquisition_service.continuous_acquisition_service import ContinuousAcquisitionService
 from application.services.continuous_acquisition_service.i_continuous_acquisition_executor import ContinuousAcquisitionConfig
@@ -17,8 +22,15 @@ from domain.events.continuous_acquisition_events import (
 )
 from domain.events.transformation_events import SensorTransformationAnglesUpdated
 from domain.events.i_domain_event_bus import IDomainEventBus
+from domain.events.event_topics import (
+    CONTINUOUS_ACQUISITION_FAILED,
+    CONTINUOUS_ACQUISITION_SAMPLE_ACQUIRED,
+    CONTINUOUS_ACQUISITION_STOPPED,
+    SENSOR_TRANSFORMATION_ANGLES_UPDATED,
+)
 from application.services.transformation_service.transformation_service import TransformationService
 from interface.presenters.signal_processor import SignalPostProcessor
+from interface.presenters.measurement_pipeline import MeasurementPipeline
 
 class ContinuousAcquisitionPresenter(QObject):
     """
@@ -27,8 +39,19 @@ class ContinuousAcquisitionPresenter(QObject):
     - Subscribes to domain events and emits Qt signals
     - Handles post-processing (Noise, Phase, Primary) via SignalPostProcessor
     - Handles Coordinate Transformation via TransformationService
+      (both compiled into one MeasurementPipeline stage for display)
+    - Drains buffered samples every DRAIN_INTERVAL_MS
     """
 
+    DRAIN_INTERVAL_MS = 50
+
+    # Order of the 'values' field of the sample records
+    CHANNEL_KEYS = (
+        "Ux In-Phase", "Ux Quadrature",
+        "Uy In-Phase", "Uy Quadrature",
+        "Uz In-Phase", "Uz Quadrature",
+    )
+
     # Signals emitted to the UI
     acquisition_started = Signal(str)   # acquisition_id
     acquisition_stopped = Signal(str)   # acquisition_id
@@ -36,6 +59,7 @@ class ContinuousAcquisitionPresenter(QObject):
     sample_acquired = Signal(dict)      # {acquisition_id, index, measurement:{...}, timestamp}
     angles_updated = Signal(tuple)      # For updating the read-only display
     correction_states_updated = Signal(bool, bool, bool, str, str, str)  # (noise, phase, primary, noise_str, phase_str, primary_str)
+    samples_dropped = Signal(int)       # total samples lost because the buffer was full
 
     def __init__(self, service: ContinuousAcquisitionService, event_bus: IDomainEventBus, transformation_service: TransformationService):
         super().__init__()
@@ -46,27 +70,27 @@ class ContinuousAcquisitionPresenter(QObject):
         
         # Signal Processor
         self._processor = SignalPostProcessor()
+        self._pipeline = MeasurementPipeline(self._processor, self._transformation_service)
         self._last_raw_sample: Dict[str, float] = {}
 
-        # Subscribe to domain events - USE LOWERCASE EVENT NAMES (matching publish calls)
-        self._event_bus.subscribe("continuousacquisitionsampleacquired", self._on_sample_event)
-        self._event_bus.subscribe("continuousacquisitionfailed", self._on_failed_event)
-        self._event_bus.subscribe("continuousacquisitionstopped", self._on_stopped_event)
-        self._event_bus.subscribe("sensortransformationanglesupdated", self._on_angles_updated_event)
+        # Subscribe to domain events (topic constants, see domain.events.event_topics)
+        self._event_bus.subscribe(CONTINUOUS_ACQUISITION_SAMPLE_ACQUIRED, self._on_sample_event)
+        self._event_bus.subscribe(CONTINUOUS_ACQUISITION_FAILED, self._on_failed_event)
+        self._event_bus.subscribe(CONTINUOUS_ACQUISITION_STOPPED, self._on_stopped_event)
+        self._event_bus.subscribe(SENSOR_TRANSFORMATION_ANGLES_UPDATED, self._on_angles_updated_event)
+
+        # Sample buffer drain (UI thread)
+        self._reported_overruns = 0
+        self._stopped_acquisition_id: str | None = None
+        self._drain_timer = QTimer(self)
+        self._drain_timer.setInterval(self.DRAIN_INTERVAL_MS)
+        self._drain_timer.timeout.connect(self._drain_samples)
+        self._drain_timer.start()
 
     def _on_angles_updated_event(self, event: SensorTransformationAnglesUpdated):
         """Handle rotation angles update event."""
         self.angles_updated.emit((event.theta_x, event.theta_y, event.theta_z))
 
-
-    def shutdown(self):
-        """Cleanup resources."""
-        # Unsubscribe from events
-        if self._event_bus:
-            self._event_bus.unsubscribe("ContinuousAcquisitionSampleAcquired", self._on_sample_event)
-            self._event_bus.unsubscribe("ContinuousAcquisitionFailed", self._on_failed_event)
-            self._event_bus.unsubscribe("ContinuousAcquisitionStopped", self._on_stopped_event)
-            self._event_bus.unsubscribe("SensorTransformationAnglesUpdated", self._on_angles_updated_event)
     # Calibration Commands (Logic)
     # ------------------------------------------------------------------ #
     
@@ -200,13 +224,50 @@ class ContinuousAcquisitionPresenter(QObject):
 
     def _on_stopped_event(self, event: ContinuousAcquisitionStopped):
         """Handle acquisition stop."""
+        self._stopped_acquisition_id = str(event.acquisition_id)
         if self._current_acquisition_id is not None:
             self.acquisition_stopped.emit(str(event.acquisition_id))
             self._current_acquisition_id = None
 
+    @Slot()
+    def _drain_samples(self):
+        """Process every sample buffered since the last tick (UI thread)."""
+        records = self._service.drain_samples()
+        if records is not None and len(records) > 0:
+            acquisition_id = self._service.get_current_acquisition_id()
+            acquisition_id_str = str(acquisition_id)
+            # Records left over after the stopped event must not restart the UI
+            if self._current_acquisition_id is None and acquisition_id_str != self._stopped_acquisition_id:
+                self._current_acquisition_id = acquisition_id_str
+                self.acquisition_started.emit(acquisition_id_str)
+
+            # Corrections + sensor->source rotation on the whole block
+            raw_values = records["values"]
+            processed_block = self._pipeline.process_block(raw_values)
+            # Only the latest raw sample is used for calibration
+            self._last_raw_sample = dict(zip(self.CHANNEL_KEYS, raw_values[-1].tolist()))
+
+            for timestamp_ns, index, values in zip(
+                records["timestamp_ns"].tolist(),
+                records["index"].tolist(),
+                processed_block.tolist(),
+            ):
+                self._emit_measurement(
+                    acquisition_id_str,
+                    index,
+                    dict(zip(self.CHANNEL_KEYS, values)),
+                    datetime.fromtimestamp(timestamp_ns / 1e9).isoformat(),
+                )
+
+        overruns = self._service.get_sample_overruns()
+        if overruns > self._reported_overruns:
+            print(f"[ContinuousAcquisitionPresenter] {overruns - self._reported_overruns} samples dropped (buffer full)")
+            self._reported_overruns = overruns
+            self.samples_dropped.emit(overruns)
+
     def _on_sample_event(self, event: ContinuousAcquisitionSampleAcquired):
         """
-        Handle sample acquired event.
+        Handle sample acquired event (executors without a sample buffer).
         Called from executor thread - emit Qt signals for UI thread.
         """
         acquisition_id_str = str(event.acquisition_id)
@@ -217,7 +278,7 @@ class ContinuousAcquisitionPresenter(QObject):
 
         m = event.sample
         
-        # 1. Construct raw measurement dict
+        # Construct raw measurement dict
         raw_measurement = {
             "Ux In-Phase": m.voltage_x_in_phase,
             "Ux Quadrature": m.voltage_x_quadrature,
@@ -226,57 +287,35 @@ class ContinuousAcquisitionPresenter(QObject):
             "Uz In-Phase": m.voltage_z_in_phase,
             "Uz Quadrature": m.voltage_z_quadrature,
         }
-        
-        # 2. Store for calibration 
+        self._emit_sample(acquisition_id_str, event.sample_index, raw_measurement, m.timestamp.isoformat())
+
+    def _emit_sample(self, acquisition_id_str: str, index: int, raw_measurement: Dict[str, float], timestamp: str):
+        """Correct, transform and emit one sample to the UI."""
+        # 1. Store for calibration 
         self._last_raw_sample = raw_measurement
 
-        # 3. Process (Noise -> Phase -> Primary)
-        processed_measurement = self._processor.process_sample(raw_measurement)
-        
-        # 4. Apply Coordinate Transformation (Sensor -> Source)
-        # Transform In-Phase vector
-        v_in_phase = (
-            processed_measurement["Ux In-Phase"], 
-            processed_measurement["Uy In-Phase"], 
-            processed_measurement["Uz In-Phase"]
-        )
-        v_rot_in_phase = self._transformation_service.transform_sensor_to_source(v_in_phase)
-        
-        # Transform Quadrature vector
-        v_quadrature = (
-            processed_measurement["Ux Quadrature"], 
-            processed_measurement["Uy Quadrature"], 
-            processed_measurement["Uz Quadrature"]
-        )
-        v_rot_quadrature = self._transformation_service.transform_sensor_to_source(v_quadrature)
+        # 2. Noise -> Phase -> Primary -> Sensor->Source, one compiled stage
+        measurement = self._pipeline.process_sample(raw_measurement)
+        self._emit_measurement(acquisition_id_str, index, measurement, timestamp)
 
-        # 5. Prepare data for UI (using transformed values)
+    def _emit_measurement(self, acquisition_id_str: str, index: int, measurement: Dict[str, float], timestamp: str):
+        """Emit one corrected, source-frame sample to the UI."""
         data = {
             "acquisition_id": acquisition_id_str,
-            "index": event.sample_index,
-            "measurement": {
-                "Ux In-Phase": v_rot_in_phase[0],
-                "Ux Quadrature": v_rot_quadrature[0],
-                
-                "Uy In-Phase": v_rot_in_phase[1],
-                "Uy Quadrature": v_rot_quadrature[1],
-                
-                "Uz In-Phase": v_rot_in_phase[2],
-                "Uz Quadrature": v_rot_quadrature[2],
-            },
-            "timestamp": event.sample.timestamp.isoformat(),
+            "index": index,
+            "measurement": measurement,
+            "timestamp": timestamp,
         }
         
         self.sample_acquired.emit(data)
-        
-        # Periodically enable UI update of angles? 
-        # Or just do it when enabling. The loop is fast, we don't want to emit angles every sample.
 
 
     def shutdown(self):
         """Cleanup resources."""
+        self._drain_timer.stop()
         # Unsubscribe from events
         if self._event_bus:
-            self._event_bus.unsubscribe("ContinuousAcquisitionSampleAcquired", self._on_sample_event)
-            self._event_bus.unsubscribe("ContinuousAcquisitionFailed", self._on_failed_event)
-            self._event_bus.unsubscribe("ContinuousAcquisitionStopped", self._on_stopped_event)
+            self._event_bus.unsubscribe(CONTINUOUS_ACQUISITION_SAMPLE_ACQUIRED, self._on_sample_event)
+            self._event_bus.unsubscribe(CONTINUOUS_ACQUISITION_FAILED, self._on_failed_event)
+            self._event_bus.unsubscribe(CONTINUOUS_ACQUISITION_STOPPED, self._on_stopped_event)
+            self._event_bus.unsubscribe(SENSOR_TRANSFORMATION_ANGLES_UPDATED, self._on_angles_updated_event)
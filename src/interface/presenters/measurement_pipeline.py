@@ -0,0 +1,162 @@
+"""
+Measurement Pipeline - Interface V2
+
+Noise correction -> phase alignment -> primary tare -> sensor->source rotation,
+compiled into one 6x6 affine transform applied to blocks of samples.
+
+Rationale:
+    Per sample, the presenter used to run SignalPostProcessor.process_sample
+    and then two TransformationService calls (one numpy array and one scipy
+    Rotation.apply per 3-vector). Every stage is linear except the sign
+    fix-up of the phase alignment, so the chain folds into out = A @ x + b.
+
+Design:
+    - Columns: [Ux I, Ux Q, Uy I, Uy Q, Uz I, Uz Q] (sample buffer order).
+    - y = P (x - noise)        P: per-axis 2x2 phase rotations
+    - y_I = |y_I| * sign_ref   sign fix-up (SignalPostProcessor rule)
+    - out = M (y - primary)    M: sensor->source rotation on the I and Q triples
+    - A = M P and b = -M (P noise + primary) are recompiled only when the
+      calibration state or the rotation changes (cheap key comparison).
+    - The sign fix-up flips y_I on a few samples; it is applied afterwards as
+      a correction (out += M[:, I] * -2 y_I) on those samples only.
+"""
+
+from typing import Dict, Optional, Tuple
+
+import numpy as np
+
+from application.services.transformation_service.transformation_service import TransformationService
+from interface.presenters.signal_processor import AXES, SignalPostProcessor
+
+CHANNEL_KEYS = (
+    "Ux In-Phase", "Ux Quadrature",
+    "Uy In-Phase", "Uy Quadrature",
+    "Uz In-Phase", "Uz Quadrature",
+)
+_I = np.array([0, 2, 4])
+_Q = np.array([1, 3, 5])
+
+
+class MeasurementPipeline:
+    """
+    Compiled measurement chain over a SignalPostProcessor (calibration state)
+    and a TransformationService (sensor->source rotation).
+    """
+
+    def __init__(self, processor: SignalPostProcessor, transformation_service: TransformationService):
+        self._processor = processor
+        self._transformation_service = transformation_service
+        self._key: Optional[Tuple] = None
+        self._compiles = 0
+        # Compiled stage (set by _compile)
+        self._a = np.eye(6)
+        self._b = np.zeros(6)
+        self._m_i = np.zeros((6, 3))
+        self._noise = np.zeros(6)
+        self._cos = np.ones(3)
+        self._sin = np.zeros(3)
+        self._phase = False
+
+    @property
+    def compile_count(self) -> int:
+        """Number of recompilations (diagnostics)."""
+        return self._compiles
+
+    # ------------------------------------------------------------------ #
+    # Processing
+    # ------------------------------------------------------------------ #
+
+    def process_block(self, samples) -> np.ndarray:
+        """
+        Correct and rotate a block of raw samples.
+
+        Args:
+            samples: array-like (n, 6) in CHANNEL_KEYS order.
+
+        Returns:
+            New float64 array (n, 6), source frame.
+        """
+        self._ensure_compiled()
+        x = np.asarray(samples, dtype=np.float64).reshape(-1, 6)
+        out = x @ self._a.T
+        out += self._b
+
+        if self._phase:
+            # Sign fix-up: recompute the rotated I only (3 columns)
+            centered = x - self._noise
+            i_val = centered[:, _I]
+            q_val = centered[:, _Q]
+            i_rotated = i_val * self._cos + q_val * self._sin
+            reference = np.where(i_val != 0.0, i_val, q_val)
+            mismatch = (i_rotated >= 0) != (reference >= 0)
+            rows = np.flatnonzero(mismatch.any(axis=1))
+            if rows.size:
+                delta = np.where(mismatch[rows], -2.0 * i_rotated[rows], 0.0)
+                out[rows] += delta @ self._m_i.T
+        return out
+
+    def process_sample(self, raw_measurement: Dict[str, float]) -> Dict[str, float]:
+        """Single-sample convenience path (same keys in and out)."""
+        row = [raw_measurement.get(k, 0.0) for k in CHANNEL_KEYS]
+        return dict(zip(CHANNEL_KEYS, self.process_block([row])[0].tolist()))
+
+    # ------------------------------------------------------------------ #
+    # Compilation
+    # ------------------------------------------------------------------ #
+
+    def _state_key(self) -> Tuple:
+        s = self._processor.state
+        return (
+            s.noise_correction_enabled,
+            tuple(s.noise_offset.get(axis, (0.0, 0.0)) for axis in AXES),
+            s.phase_correction_enabled,
+            tuple(s.phase_angles.get(axis, 0.0) for axis in AXES),
+            s.primary_correction_enabled,
+            tuple(s.primary_offset.get(axis, (0.0, 0.0)) for axis in AXES),
+            self._transformation_service.is_enabled(),
+            tuple(self._transformation_service.get_rotation_angles()),
+        )
+
+    def _ensure_compiled(self) -> None:
+        key = self._state_key()
+        if key != self._key:
+            self._compile()
+            self._key = key
+
+    def _compile(self) -> None:
+        s = self._processor.state
+
+        noise = np.zeros(6)
+        if s.noise_correction_enabled:
+            for a, axis in enumerate(AXES):
+                noise[_I[a]], noise[_Q[a]] = s.noise_offset.get(axis, (0.0, 0.0))
+
+        primary = np.zeros(6)
+        if s.primary_correction_enabled:
+            for a, axis in enumerate(AXES):
+                primary[_I[a]], primary[_Q[a]] = s.primary_offset.get(axis, (0.0, 0.0))
+
+        # Phase: I' = I cos + Q sin, Q' = -I sin + Q cos (per axis)
+        p = np.eye(6)
+        cos_t, sin_t = np.ones(3), np.zeros(3)
+        if s.phase_correction_enabled:
+            theta = np.array([s.phase_angles.get(axis, 0.0) for axis in AXES])
+            cos_t, sin_t = np.cos(theta), np.sin(theta)
+            p[_I, _I] = cos_t
+            p[_I, _Q] = sin_t
+            p[_Q, _I] = -sin_t
+            p[_Q, _Q] = cos_t
+
+        # Sensor -> source rotation of the I and Q triples
+        rotation = self._transformation_service.get_rotation_matrix()
+        m = np.zeros((6, 6))
+        m[np.ix_(_I, _I)] = rotation
+        m[np.ix_(_Q, _Q)] = rotation
+
+        self._a = m @ p
+        self._b = -(m @ (p @ noise + primary))
+        self._m_i = m[:, _I]
+        self._noise = noise
+        self._cos, self._sin = cos_t, sin_t
+        self._phase = s.phase_correction_enabled
+        self._compiles += 1
@@ -9,6 +9,7 @@ from PySide6.QtCore import QObject, Signal, Slot
 from application.services.motion_control_service.motion_control_service import MotionControlService
 from domain.events.i_domain_event_bus import IDomainEventBus
 from domain.events.motion_events import PositionUpdated, MotionCompleted, MotionFailed
+from domain.events.event_topics import MOTION_COMPLETED, MOTION_FAILED, POSITION_UPDATED
 
 
 class MotionPresenter(QObject):
@@ -51,16 +52,16 @@ class MotionPresenter(QObject):
     def start_monitoring(self):
         """Subscribe to position updates and motion events."""
         if self._event_bus:
-            self._event_bus.subscribe("positionupdated", self._on_position_updated)
-            self._event_bus.subscribe("motioncompleted", self._on_motion_completed)
-            self._event_bus.subscribe("motionfailed", self._on_motion_failed)
+            self._event_bus.subscribe(POSITION_UPDATED, self._on_position_updated)
+            self._event_bus.subscribe(MOTION_COMPLETED, self._on_motion_completed)
+            self._event_bus.subscribe(MOTION_FAILED, self._on_motion_failed)
 
     def stop_monitoring(self):
         """Unsubscribe from position updates and motion events."""
         if self._event_bus:
-            self._event_bus.unsubscribe("positionupdated", self._on_position_updated)
-            self._event_bus.unsubscribe("motioncompleted", self._on_motion_completed)
-            self._event_bus.unsubscribe("motionfailed", self._on_motion_failed)
+            self._event_bus.unsubscribe(POSITION_UPDATED, self._on_position_updated)
+            self._event_bus.unsubscribe(MOTION_COMPLETED, self._on_motion_completed)
+            self._event_bus.unsubscribe(MOTION_FAILED, self._on_motion_failed)
 
     def _on_position_updated(self, event: PositionUpdated):
         """Handle position update event from domain."""
@@ -0,0 +1,91 @@
+"""
+Performance Presenter - Interface V2
+
+Bridges the live performance counters and the hot-path tracer with the
+PerformancePanel. Both objects are injected by the composition root
+(PerformanceCounters, HotPathTracer): the interface does not import them.
+
+Counters are sampled by a UI-thread timer, never on the acquisition path.
+"""
+
+import math
+import os
+from datetime import datetime
+from typing import Any, Dict
+
+from PySide6.QtCore import QObject, QTimer, Signal, Slot
+
+
+class PerformancePresenter(QObject):
+    """
+    Presenter for the Performance Panel.
+    - Samples the counters every SAMPLE_INTERVAL_MS and emits them for display
+    - Starts / stops span recording and exports the Chrome trace (+ counter history)
+    """
+
+    SAMPLE_INTERVAL_MS = 1000
+
+    counters_updated = Signal(dict)   # {name: "value unit"} (display strings)
+    tracing_changed = Signal(bool)
+    status_message = Signal(str)
+
+    def __init__(self, counters: Any, tracer: Any, trace_directory: str):
+        """
+        Args:
+            counters: PerformanceCounters-like (sample(), units(), trace_counters()).
+            tracer: HotPathTracer-like (enabled, enable(), disable(), clear(),
+                export_chrome_trace(path, counters=...), overwritten()).
+            trace_directory: Destination of exported traces.
+        """
+        super().__init__()
+        self._counters = counters
+        self._tracer = tracer
+        self._trace_directory = trace_directory
+
+        self._timer = QTimer(self)
+        self._timer.setInterval(self.SAMPLE_INTERVAL_MS)
+        self._timer.timeout.connect(self.refresh)
+        self._timer.start()
+
+    @Slot()
+    def refresh(self):
+        values = self._counters.sample()
+        units = self._counters.units()
+        display = {name: self._format(value, units.get(name, "")) for name, value in values.items()}
+        if self._tracer.enabled:
+            display["trace spans lost"] = str(self._tracer.overwritten())
+        self.counters_updated.emit(display)
+
+    @staticmethod
+    def _format(value, unit: str) -> str:
+        if value is None or (isinstance(value, float) and math.isnan(value)):
+            return "—"
+        text = f"{value:.0f}" if abs(value) >= 100 or float(value).is_integer() else f"{value:.2f}"
+        return f"{text} {unit}".rstrip()
+
+    @Slot(bool)
+    def set_tracing(self, enabled: bool):
+        if enabled and not self._tracer.enabled:
+            self._tracer.clear()
+            self._tracer.enable()
+        elif not enabled and self._tracer.enabled:
+            self._tracer.disable()
+        self.tracing_changed.emit(self._tracer.enabled)
+
+    @Slot()
+    def export_trace(self):
+        filename = f"{datetime.now().strftime('%Y-%m-%d_%H%M%S')}_trace.json"
+        try:
+            path = self._tracer.export_chrome_trace(
+                os.path.join(self._trace_directory, filename),
+                counters=self._counters.trace_counters(),
+            )
+        except Exception as e:
+            self.status_message.emit(f"Trace export failed: {e}")
+            return
+        self.status_message.emit(f"Trace written: {path} (open in ui.perfetto.dev)")
+
+    def counter_values(self) -> Dict[str, Any]:
+        """Last sample (raw values), for scripts and tests."""
+        history = self._counters.history()
+        return dict(history[-1][1]) if history else {}
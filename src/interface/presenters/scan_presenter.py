@@ -138,7 +138,16 @@ class ScanPresenter(QObject, IScanOutputPort, metaclass=QABCMeta):
                 motion_speed_mm_s=None,  # Speed controlled by advanced hardware configuration
                 stabilization_delay_ms=int(params.get("stabilization_delay_ms", 300)),
                 averaging_per_position=int(params.get("averaging_per_position", 10)),
-                uncertainty_volts=0.001     # Default
+                uncertainty_volts=0.001,     # Default
+                # Adaptive averaging only when a target standard error is given
+                adaptive_target_std_error_volts=(
+                    float(params["adaptive_target_std_error_volts"])
+                    if params.get("adaptive_target_std_error_volts") not in (None, "") else None
+                ),
+                adaptive_min_samples=int(params.get("adaptive_min_samples", 10)),
+                # Multi-resolution: 0 levels = uniform grid
+                refinement_levels=int(params.get("refinement_levels", 0)),
+                refinement_threshold_fraction=float(params.get("refinement_threshold_fraction", 0.2)),
             )
             
             # Configure Export
@@ -146,7 +155,7 @@ class ScanPresenter(QObject, IScanOutputPort, metaclass=QABCMeta):
                 enabled=params.get("export_enabled", False),
                 output_directory=params.get("export_output_directory", ""),
                 filename_base=params.get("export_filename_base", "scan"),
-                format=params.get("export_format", "CSV")
+                format=params.get("export_format", "BINARY")
             )
             self._export_service.configure_export(export_dto)
             
@@ -2,6 +2,8 @@ import math
 from dataclasses import dataclass, field
 from typing import Dict, Tuple, Optional
 
+AXES = ("Ux", "Uy", "Uz")
+
 @dataclass
 class ProcessingState:
     """Stores the calibration constants."""
@@ -21,10 +23,28 @@ class SignalPostProcessor:
     """
     Encapsulates signal processing logic for the interface.
     Handles Noise Correction -> Phase Alignment -> Primary Field Subtraction.
+
+    Two paths, same arithmetic:
+    - process_sample: one dict {"Ux In-Phase": ..., ...}.
+    - process_block: (n, 6) array in (I, Q) x (X, Y, Z) order, all stages
+      applied to whole columns in one pass.
+    The phase rotation coefficients (cos, sin) are computed once per set of
+    calibrated angles, not per sample.
     """
     
     def __init__(self):
         self.state = ProcessingState()
+        self._phase_key: Optional[Tuple[float, ...]] = None
+        self._phase_coeffs: Dict[str, Tuple[float, float]] = {}
+
+    def _rotation_coefficients(self) -> Dict[str, Tuple[float, float]]:
+        """{axis: (cos, sin)} of the current phase angles (cached)."""
+        angles = self.state.phase_angles
+        key = tuple(angles.get(axis, 0.0) for axis in AXES)
+        if key != self._phase_key:
+            self._phase_coeffs = {axis: (math.cos(t), math.sin(t)) for axis, t in zip(AXES, key)}
+            self._phase_key = key
+        return self._phase_coeffs
 
     def process_sample(self, raw_measurement: Dict[str, float]) -> Dict[str, float]:
         """
@@ -32,11 +52,11 @@ class SignalPostProcessor:
         Expected keys format: "Ux In-Phase", "Ux Quadrature", etc.
         """
         processed = raw_measurement.copy()
+        state = self.state
+        coeffs = self._rotation_coefficients() if state.phase_correction_enabled else None
         
         # We process by axis pairs (X, Y, Z)
-        axes = ["Ux", "Uy", "Uz"]
-        
-        for axis in axes:
+        for axis in AXES:
             k_i = f"{axis} In-Phase"
             k_q = f"{axis} Quadrature"
             
@@ -47,14 +67,13 @@ class SignalPostProcessor:
             q_val = processed[k_q]
 
             # 1. Noise Subtraction
-            if self.state.noise_correction_enabled:
-                offset_i, offset_q = self.state.noise_offset.get(axis, (0.0, 0.0))
+            if state.noise_correction_enabled:
+                offset_i, offset_q = state.noise_offset.get(axis, (0.0, 0.0))
                 i_val -= offset_i
                 q_val -= offset_q
 
             # 2. Phase Rotation (Maximize In-Phase)
-            if self.state.phase_correction_enabled:
-                theta = self.state.phase_angles.get(axis, 0.0)
+            if coeffs is not None:
                 # Rotate (I, Q) by -theta to align on I-axis
                 # I_new = I cos(-th) - Q sin(-th) = I cos(th) + Q sin(th)
                 # Q_new = I sin(-th) + Q cos(-th) = -I sin(th) + Q cos(th)
@@ -69,8 +88,7 @@ class SignalPostProcessor:
                     # Q < 0 means vector pointing "down" -> negative I after rotation
                     expected_sign = 1.0 if q_val >= 0 else -1.0
                 
-                cos_t = math.cos(theta)
-                sin_t = math.sin(theta)
+                cos_t, sin_t = coeffs[axis]
                 
                 # Perform rotation (preserves magnitude)
                 i_rotated = i_val * cos_t + q_val * sin_t
@@ -86,8 +104,8 @@ class SignalPostProcessor:
                 q_val = q_new
 
             # 3. Primary Field Subtraction
-            if self.state.primary_correction_enabled:
-                offset_i, offset_q = self.state.primary_offset.get(axis, (0.0, 0.0))
+            if state.primary_correction_enabled:
+                offset_i, offset_q = state.primary_offset.get(axis, (0.0, 0.0))
                 i_val -= offset_i
                 q_val -= offset_q
 
@@ -96,10 +114,54 @@ class SignalPostProcessor:
             
         return processed
 
+    def process_block(self, samples):
+        """
+        Apply enabled corrections to a block of samples.
+
+        Args:
+            samples: array-like (n, 6), columns
+                [Ux I, Ux Q, Uy I, Uy Q, Uz I, Uz Q] (sample buffer order).
+
+        Returns:
+            New float64 array (n, 6); the input is not modified.
+        """
+        import numpy as np
+
+        state = self.state
+        block = np.array(samples, dtype=np.float64, copy=True).reshape(-1, 6)
+        # Views on the I and Q columns: every stage updates them in place
+        i_val = block[:, 0::2]
+        q_val = block[:, 1::2]
+
+        # 1. Noise Subtraction
+        if state.noise_correction_enabled:
+            offsets = np.array([state.noise_offset.get(axis, (0.0, 0.0)) for axis in AXES])
+            i_val -= offsets[:, 0]
+            q_val -= offsets[:, 1]
+
+        # 2. Phase Rotation, same sign-preservation rule as process_sample:
+        #    |I_rot| carries the sign of I (of Q when I == 0)
+        if state.phase_correction_enabled:
+            coeffs = self._rotation_coefficients()
+            cos_t = np.array([coeffs[axis][0] for axis in AXES])
+            sin_t = np.array([coeffs[axis][1] for axis in AXES])
+            expected_sign = np.where(np.where(i_val != 0.0, i_val, q_val) >= 0, 1.0, -1.0)
+            i_rotated = i_val * cos_t + q_val * sin_t
+            q_new = q_val * cos_t - i_val * sin_t
+            i_val[...] = np.abs(i_rotated) * expected_sign
+            q_val[...] = q_new
+
+        # 3. Primary Field Subtraction
+        if state.primary_correction_enabled:
+            offsets = np.array([state.primary_offset.get(axis, (0.0, 0.0)) for axis in AXES])
+            i_val -= offsets[:, 0]
+            q_val -= offsets[:, 1]
+
+        return block
+
     def calibrate_noise(self, current_sample: Dict[str, float]):
         """Store current values as noise offset."""
-        axes = ["Ux", "Uy", "Uz"]
-        for axis in axes:
+        for axis in AXES:
             i = current_sample.get(f"{axis} In-Phase", 0.0)
             q = current_sample.get(f"{axis} Quadrature", 0.0)
             self.state.noise_offset[axis] = (i, q)
@@ -111,8 +173,7 @@ class SignalPostProcessor:
         Calculate angle to rotate (I, Q) onto the I axis (Q=0).
         This should be called AFTER noise subtraction but BEFORE primary subtraction.
         """
-        axes = ["Ux", "Uy", "Uz"]
-        for axis in axes:
+        for axis in AXES:
             # Get values (potentially already noise-corrected if passed correctly)
             i = current_sample_pre_phase.get(f"{axis} In-Phase", 0.0)
             q = current_sample_pre_phase.get(f"{axis} Quadrature", 0.0)
@@ -125,8 +186,7 @@ class SignalPostProcessor:
 
     def calibrate_primary(self, current_sample_fully_processed: Dict[str, float]):
         """Store current values (after noise+phase) as primary offset."""
-        axes = ["Ux", "Uy", "Uz"]
-        for axis in axes:
+        for axis in AXES:
             i = current_sample_fully_processed.get(f"{axis} In-Phase", 0.0)
             q = current_sample_fully_processed.get(f"{axis} Quadrature", 0.0)
             self.state.primary_offset[axis] = (i, q)
@@ -1,9 +1,12 @@
 """
 Continuous Acquisition Panel - Interface V2
 Combines controls and visualization in a single panel (passive view pattern).
+
+Samples go into a bounded TimeSeriesPlotModel; the plot is redrawn by a timer
+(REDRAW_INTERVAL_MS) from a min/max decimated window, not once per sample.
 """
 
-from typing import Dict, List, Any
+from typing import Dict, Any
 from PySide6.QtWidgets import (
     QWidget,
     QVBoxLayout,
@@ -17,9 +20,11 @@ from PySide6.QtWidgets import (
     QGridLayout,
     QSizePolicy,
 )
-from PySide6.QtCore import Qt, Signal
+from PySide6.QtCore import Qt, QTimer, Signal
 import pyqtgraph as pg  # type: ignore[import]
 
+from interface.presentation.time_series_plot_model import TimeSeriesPlotModel
+
 
 class ContinuousAcquisitionPanel(QWidget):
     """
@@ -30,7 +35,11 @@ class ContinuousAcquisitionPanel(QWidget):
     - Start/Stop buttons
     - Pyqtgraph time series plot for 6 channels
     - Channel visibility toggles
+    - Bounded sample history, decimated timer-driven redraw
     """
+
+    REDRAW_INTERVAL_MS = 40  # 25 fps
+    MIN_PLOT_POINTS = 200
     
     # Signals (passive view pattern)
     acquisition_start_requested = Signal(dict)  # parameters
@@ -55,9 +64,8 @@ class ContinuousAcquisitionPanel(QWidget):
         super().__init__(parent)
         self.channel_checkboxes = {}
         
-        # Data buffers
-        self.times: List[float] = []
-        self.values: Dict[str, List[float]] = {ch["name"]: [] for ch in self.CHANNELS}
+        # Data buffer (fixed capacity, oldest samples dropped)
+        self._plot_model = TimeSeriesPlotModel(channels=len(self.CHANNELS))
         self._t0: float | None = None
         
         # Main layout
@@ -282,6 +290,12 @@ class ContinuousAcquisitionPanel(QWidget):
         # Initialize time slot visibility based on default window mode
         self._update_time_slot_visibility(self.window_mode_combo.currentText())
 
+        # Redraw at a fixed rate, only when new samples arrived
+        self._redraw_timer = QTimer(self)
+        self._redraw_timer.setInterval(self.REDRAW_INTERVAL_MS)
+        self._redraw_timer.timeout.connect(self._on_redraw_tick)
+        self._redraw_timer.start()
+
 
     def _on_start_clicked(self):
         """Gather parameters and emit signal."""
@@ -379,68 +393,53 @@ class ContinuousAcquisitionPanel(QWidget):
         self.btn_stop.setEnabled(False)
 
     def on_sample_acquired(self, data: Dict[str, Any]):
-        """Called for each new sample (from presenter)."""
+        """Called for each new sample (from presenter). Buffered; drawn by the redraw timer."""
         import datetime as _dt
 
         ts = _dt.datetime.fromisoformat(data["timestamp"]).timestamp()
         if self._t0 is None:
             self._t0 = ts
         t_rel = ts - self._t0
-        self.times.append(t_rel)
 
         meas: Dict[str, float] = data.get("measurement", {})
-        for ch in self.CHANNELS:
-            name = ch["name"]
-            val = float(meas.get(name, 0.0))
-            self.values[name].append(val)
-
-        self._update_plot()
+        self._plot_model.append(t_rel, [float(meas.get(ch["name"], 0.0)) for ch in self.CHANNELS])
 
     def _reset_buffers(self):
         """Clear data buffers."""
-        self.times = []
-        self.values = {ch["name"]: [] for ch in self.CHANNELS}
+        self._plot_model.clear()
         self._t0 = None
         for curve in self.curves.values():
             curve.setData([], [])
 
+    def _on_redraw_tick(self):
+        if self._plot_model.dirty:
+            self._update_plot()
+
     def _update_plot(self):
         """Refresh the plot based on display window settings."""
-        if not self.times:
+        model = self._plot_model
+        model.dirty = False
+        if len(model) == 0:
             return
 
         window = self.window_length_spin.value()
         mode_text = self.window_mode_combo.currentText() if self.window_mode_combo is not None else "Sliding window"
 
-        t = self.times
-        for name, curve in self.curves.items():
-            ys_full = self.values.get(name, [])
-            if not ys_full:
-                curve.setData([], [])
-                continue
+        # No window or "From start" mode: show all
+        t_min = None
+        if window > 0.0 and mode_text.startswith("Sliding"):
+            t_min = model.last_time - window
 
-            t_plot = []
-            y_plot = []
+        # About two points (min, max) per horizontal pixel
+        max_points = max(self.MIN_PLOT_POINTS, 2 * int(self.plot.width()))
+        t_plot, y_plot = model.decimated(t_min, max_points)
 
-            # No window or "From start" mode: show all
-            if window <= 0.0 or mode_text == "From start":
-                t_plot = t
-                y_plot = ys_full
-            
-            # Sliding window mode
-            elif mode_text.startswith("Sliding"):
-                t_min = t[-1] - window
-                idx_start = 0
-                for i, ti in enumerate(t):
-                    if ti >= t_min:
-                        idx_start = i
-                        break
-                t_plot = t[idx_start:]
-                y_plot = ys_full[idx_start:]
-            
+        for col, ch in enumerate(self.CHANNELS):
+            curve = self.curves[ch["name"]]
+            if not curve.isVisible():
+                continue
             # Apply Scale
-            y_scaled = [val * self._scale_factor for val in y_plot]
-            curve.setData(t_plot, y_scaled)
+            curve.setData(t_plot, y_plot[:, col] * self._scale_factor)
 
     def _on_channel_toggled(self):
         """Show/hide curves based on button states."""
@@ -448,6 +447,8 @@ class ContinuousAcquisitionPanel(QWidget):
             visible = btn.isChecked()
             if name in self.curves:
                 self.curves[name].setVisible(visible)
+        # Hidden curves are not refreshed while hidden
+        self._update_plot()
     
     def _on_window_mode_changed(self, mode_text: str):
         """Handle window mode changes and update plot."""
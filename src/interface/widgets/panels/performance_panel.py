@@ -0,0 +1,75 @@
+from PySide6.QtWidgets import (
+    QGroupBox, QHBoxLayout, QHeaderView, QLabel, QPushButton,
+    QTableWidget, QTableWidgetItem, QVBoxLayout, QWidget
+)
+from PySide6.QtCore import Qt, Signal, Slot
+
+
+class PerformancePanel(QWidget):
+    """
+    Live performance counters and hot-path trace recording.
+    """
+
+    # Signals
+    tracing_toggled = Signal(bool)
+    export_trace_requested = Signal()
+
+    def __init__(self, parent=None):
+        super().__init__(parent)
+
+        main_layout = QVBoxLayout(self)
+
+        # --- 1. Counters ---
+        grp_counters = QGroupBox("Live Counters")
+        l_counters = QVBoxLayout(grp_counters)
+        self.table = QTableWidget(0, 2)
+        self.table.setHorizontalHeaderLabels(["Counter", "Value"])
+        self.table.horizontalHeader().setSectionResizeMode(0, QHeaderView.ResizeMode.Stretch)
+        self.table.horizontalHeader().setSectionResizeMode(1, QHeaderView.ResizeMode.ResizeToContents)
+        self.table.verticalHeader().setVisible(False)
+        self.table.setEditTriggers(QTableWidget.EditTrigger.NoEditTriggers)
+        l_counters.addWidget(self.table)
+        main_layout.addWidget(grp_counters, 1)
+
+        # --- 2. Trace recording ---
+        grp_trace = QGroupBox("Hot-Path Trace (Chrome / Perfetto JSON)")
+        l_trace = QHBoxLayout(grp_trace)
+        self.btn_record = QPushButton("Start Recording")
+        self.btn_record.setCheckable(True)
+        self.btn_record.toggled.connect(self.tracing_toggled.emit)
+        self.btn_export = QPushButton("Export Trace")
+        self.btn_export.clicked.connect(self.export_trace_requested.emit)
+        l_trace.addWidget(self.btn_record)
+        l_trace.addWidget(self.btn_export)
+        main_layout.addWidget(grp_trace)
+
+        self.lbl_status = QLabel("")
+        self.lbl_status.setWordWrap(True)
+        main_layout.addWidget(self.lbl_status)
+
+        self._rows = {}
+
+    @Slot(dict)
+    def update_counters(self, values: dict):
+        for name, text in values.items():
+            row = self._rows.get(name)
+            if row is None:
+                row = self.table.rowCount()
+                self.table.insertRow(row)
+                self.table.setItem(row, 0, QTableWidgetItem(name))
+                value_item = QTableWidgetItem()
+                value_item.setTextAlignment(Qt.AlignmentFlag.AlignRight | Qt.AlignmentFlag.AlignVCenter)
+                self.table.setItem(row, 1, value_item)
+                self._rows[name] = row
+            self.table.item(row, 1).setText(text)
+
+    @Slot(bool)
+    def on_tracing_changed(self, enabled: bool):
+        self.btn_record.blockSignals(True)
+        self.btn_record.setChecked(enabled)
+        self.btn_record.blockSignals(False)
+        self.btn_record.setText("Stop Recording" if enabled else "Start Recording")
+
+    @Slot(str)
+    def set_status_message(self, message: str):
+        self.lbl_status.setText(message)
@@ -132,7 +132,7 @@ class ScanControlPanel(QWidget):
         self.input_export_directory.setPlaceholderText(".aefi_acquisition/scans/raw_data/")
 
         self.combo_export_format = QComboBox()
-        self.combo_export_format.addItems(["CSV", "HDF5"])
+        self.combo_export_format.addItems(["BINARY", "HDF5", "CSV"])
 
         export_layout.addRow(self.checkbox_export_enabled)
         export_layout.addRow("Filename base:", self.input_export_filename)
@@ -286,7 +286,7 @@ class ScanControlPanel(QWidget):
                     self.input_export_directory.setText(export_config.get("output_directory", ""))
                     
                     # Set format in combo box
-                    format_str = export_config.get("format", "CSV")
+                    format_str = export_config.get("format", "BINARY")
                     format_index = self.combo_export_format.findText(format_str)
                     if format_index >= 0:
                         self.combo_export_format.setCurrentIndex(format_index)
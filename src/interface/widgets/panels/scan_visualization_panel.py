@@ -1,25 +1,48 @@
-import numpy as np
 from PySide6.QtWidgets import QWidget, QVBoxLayout, QComboBox, QLabel, QHBoxLayout
-from PySide6.QtCore import Qt, Signal
+from PySide6.QtCore import Qt, QTimer, Signal
 from matplotlib.backends.backend_qtagg import FigureCanvasQTAgg
 from matplotlib.figure import Figure
 
+from interface.presentation.scan_grid_model import ScanGridModel, CHANNELS
+
 class ScanVisualizationPanel(QWidget):
     """
     Panel for visualizing 2D scan results with matplotlib colormaps.
     Supports single channel view and 6-channel grid view.
+
+    Incoming points only update the ScanGridModel; a timer redraws the
+    changed images at most every REFRESH_INTERVAL_MS, with color limits
+    maintained incrementally by the model.
     """
+
+    REFRESH_INTERVAL_MS = 100  # 10 fps cap
+
     def __init__(self, parent=None):
         super().__init__(parent)
         
         # Data storage
-        self.data_grids = {}  # channel -> 2D numpy array
-        self.extent = [0, 1, 0, 1]  # [x_min, x_max, y_min, y_max]
+        self._model = ScanGridModel()
         self.available_channels = []
         self.current_channel = None
         
         self._build_ui()
 
+        # Coalesced redraw of changed channels
+        self._refresh_timer = QTimer(self)
+        self._refresh_timer.setInterval(self.REFRESH_INTERVAL_MS)
+        self._refresh_timer.timeout.connect(self._on_refresh_tick)
+        self._refresh_timer.start()
+
+    @property
+    def data_grids(self):
+        """channel -> 2D numpy array"""
+        return self._model.grids
+
+    @property
+    def extent(self):
+        """[x_min, x_max, y_min, y_max]"""
+        return self._model.extent
+
     def _build_ui(self):
         layout = QVBoxLayout(self)
         layout.setContentsMargins(5, 5, 5, 5)
@@ -68,20 +91,11 @@ class ScanVisualizationPanel(QWidget):
         self.ims_dict = {}   # channel -> image artist
         self._setup_single_view()
 
-    def initialize_scan(self, x_min, x_max, x_nb, y_min, y_max, y_nb):
-        """Initialize data grids for a new scan."""
-        self.extent = [float(x_min), float(x_max), float(y_min), float(y_max)]
-        
-        # Initialize 6 channels (X/Y/Z × In-Phase/Quadrature)
-        self.available_channels = [
-            'x_in_phase', 'x_quadrature',
-            'y_in_phase', 'y_quadrature',
-            'z_in_phase', 'z_quadrature'
-        ]
-        
-        # Create empty grids
-        for channel in self.available_channels:
-            self.data_grids[channel] = np.full((int(y_nb), int(x_nb)), np.nan)
+    def initialize_scan(self, x_min, x_max, x_nb, y_min, y_max, y_nb, refinement_levels=0, subdivision=2):
+        """Initialize data grids for a new scan (finest lattice when the scan is refined)."""
+        # 6 channels (X/Y/Z × In-Phase/Quadrature), empty grids
+        self._model.initialize(x_min, x_max, x_nb, y_min, y_max, y_nb, refinement_levels, subdivision)
+        self.available_channels = list(CHANNELS)
         
         # Set default channel
         self.current_channel = 'x_in_phase'
@@ -97,41 +111,18 @@ class ScanVisualizationPanel(QWidget):
             self._setup_grid_view()
 
     def update_data_point(self, x_idx, y_idx, measurements: dict):
-        """Update a single data point with measurements."""
-        for channel, value in measurements.items():
-            if channel in self.data_grids:
-                self.data_grids[channel][y_idx, x_idx] = value
-        
-        self._refresh_visualization()
+        """Update a single data point with measurements (drawn on the next refresh tick)."""
+        self._model.update(x_idx, y_idx, measurements)
 
-    def update_data_point_from_position(self, x, y, measurements: dict):
+    def update_data_point_from_position(self, x, y, measurements: dict, level: int = 0):
         """Update data point by calculating indices from physical coordinates."""
-        # Calculate indices based on extent and grid size
-        x_min, x_max, y_min, y_max = self.extent
-        
-        # Get grid dimensions from one of the grids
-        if not self.data_grids:
-            return
-            
-        first_grid = next(iter(self.data_grids.values()))
-        y_nb, x_nb = first_grid.shape
-        
-        # Avoid division by zero
-        if x_nb > 1:
-            x_step = (x_max - x_min) / (x_nb - 1)
-            x_idx = int(round((x - x_min) / x_step))
-        else:
-            x_idx = 0
-            
-        if y_nb > 1:
-            y_step = (y_max - y_min) / (y_nb - 1)
-            y_idx = int(round((y - y_min) / y_step))
-        else:
-            y_idx = 0
-            
-        # Bounds check
-        if 0 <= x_idx < x_nb and 0 <= y_idx < y_nb:
-            self.update_data_point(x_idx, y_idx, measurements)
+        # Steps are precomputed by the model; out-of-grid points are ignored
+        self._model.update_from_position(x, y, measurements, level)
+
+    def _on_refresh_tick(self):
+        dirty = self._model.take_dirty()
+        if dirty:
+            self._refresh_visualization(dirty)
 
     def _on_view_mode_changed(self, mode: str):
         if mode == "Single View":
@@ -205,18 +196,20 @@ class ScanVisualizationPanel(QWidget):
         self.canvas.draw()
         self._refresh_visualization()
 
-    def _refresh_visualization(self):
-        """Refresh the matplotlib display."""
+    def _refresh_visualization(self, channels=None):
+        """Refresh the matplotlib display (only `channels` if given)."""
         mode = self.combo_view_mode.currentText()
         
         if mode == "Single View":
-            self._update_single_view()
+            self._update_single_view(channels)
         else:
-            self._update_grid_view()
+            self._update_grid_view(channels)
 
-    def _update_single_view(self):
+    def _update_single_view(self, channels=None):
         if not self.current_channel or self.current_channel not in self.data_grids:
             return
+        if channels is not None and self.current_channel not in channels and 'single' in self.ims_dict:
+            return
         
         ax = self.axes_dict.get('single')
         if ax is None:
@@ -246,13 +239,15 @@ class ScanVisualizationPanel(QWidget):
         im.set_extent(self.extent)
         ax.set_title(title, color=color, fontweight='bold')
         
-        self._autoscale_im(im, data)
-        self.canvas.draw()
+        self._autoscale_im(im, self.current_channel)
+        self.canvas.draw_idle()
 
-    def _update_grid_view(self):
+    def _update_grid_view(self, channels=None):
         for channel, ax in self.axes_dict.items():
             if channel not in self.data_grids:
                 continue
+            if channels is not None and channel not in channels and channel in self.ims_dict:
+                continue
             
             data = self.data_grids[channel]
             title, color = self._get_channel_metadata(channel)
@@ -271,15 +266,15 @@ class ScanVisualizationPanel(QWidget):
             im = self.ims_dict[channel]
             im.set_data(data)
             im.set_extent(self.extent)
-            self._autoscale_im(im, data)
+            self._autoscale_im(im, channel)
         
-        self.canvas.draw()
+        self.canvas.draw_idle()
 
-    def _autoscale_im(self, im, data):
-        """Auto-scale colormap based on data range."""
-        vmin = np.nanmin(data)
-        vmax = np.nanmax(data)
-        if not (np.isnan(vmin) or np.isnan(vmax)):
+    def _autoscale_im(self, im, channel: str):
+        """Auto-scale colormap on the channel's running data range."""
+        limits = self._model.limits(channel)
+        if limits is not None:
+            vmin, vmax = limits
             if vmin == vmax:
                 im.set_clim(vmin=vmin - 1e-9, vmax=vmax + 1e-9)
             else:
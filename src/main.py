@@ -21,10 +21,17 @@ from application.services.motion_control_service.motion_control_service import M
 # --- Infrastructure ---
 from infrastructure.events.in_memory_event_bus import InMemoryEventBus
 from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+from infrastructure.events.async_event_bus import AsyncEventBus, BackpressurePolicy, SubscriptionOptions
+from domain.events.event_topics import EVENT_TOPICS, SCAN_POINT_ACQUIRED
+from domain.services.trajectory_optimizer import TrajectoryOptimizer
 from infrastructure.execution.step_scan_executor import StepScanExecutor
+from infrastructure.execution.fly_scan_executor import FlyScanExecutor
 from infrastructure.persistence.csv_scan_export_port import CsvScanExportPort
 from infrastructure.persistence.hdf5_scan_export_port import Hdf5ScanExportPort
+from infrastructure.persistence.binary_scan_export_port import BinaryScanExportPort
 from application.services.scan_application_service.scan_export_service import ScanExportService
+from infrastructure.instrumentation.hot_path_tracer import TRACER
+from infrastructure.instrumentation.performance_counters import Counter, PerformanceCounters
 
 # --- Adapters (Mocks) ---
 from infrastructure.mocks.adapter_mock_i_acquisition_port import RandomNoiseAcquisitionPort
@@ -34,6 +41,11 @@ from infrastructure.mocks.adapter_mock_i_motion_port import MockMotionPort
 from infrastructure.mocks.adapter_mock_i_continuous_acquisition_executor import MockContinuousAcquisitionExecutor
 from infrastructure.mocks.adapter_mock_i_hardware_initialization_port import MockHardwareInitializationPort
 
+# --- Simulated Devices (load tests) ---
+from infrastructure.hardware.simulation.simulation_profile import SimulationProfile
+from infrastructure.hardware.simulation.simulated_performax_lib import SimulatedPerformaxLib
+from infrastructure.hardware.simulation.simulated_mcu_serial import SimulatedMcuSerial
+
 # --- System Lifecycle ---
 from application.services.system_lifecycle_service.system_lifecycle_service import (
     SystemStartupApplicationService,
@@ -49,6 +61,7 @@ from interface.presenters.excitation_presenter import ExcitationPresenter
 from interface.presenters.continuous_acquisition_presenter import ContinuousAcquisitionPresenter
 from interface.presenters.sensor_transformation_presenter import SensorTransformationPresenter
 from interface.presenters.scan_presenter import ScanPresenter
+from interface.presenters.performance_presenter import PerformancePresenter
 
 # --- Transformation Service ---
 from application.services.transformation_service.transformation_service import TransformationService
@@ -79,11 +92,41 @@ def main():
         "excitation": "real",    # "mock" | "real"
         "continuous": "real",    # "mock" | "real"
     }
+    # Scan strategy: "step" (stop at every point) | "fly" (constant-velocity rows)
+    SCAN_STRATEGY = "step"
+    # Step scan: average/record/export point N while moving to point N+1
+    STEP_SCAN_PIPELINED = True
+    # Step scan: reorder grid points to minimise stage move time (per-axis HS/ACC/DEC)
+    TRAJECTORY_OPTIMIZATION = False
+    # Step scan: also export every individual sample of each point (HDF5 /raw_data)
+    RAW_SAMPLE_CAPTURE = False
+    # "real" motion/acquisition on emulated devices (PerformaxCom.dll and MCU
+    # serial port), to load-test the full stack without the bench
+    SIMULATED_HARDWARE = False
+    SIMULATION_PROFILE = SimulationProfile(sample_rate_hz=4000.0, latency_s=0.0005, jitter_s=0.0005)
+    # Event delivery: "sync" (handlers run in the publisher thread) or "async"
+    # (one queue + dispatcher thread per subscriber, see AsyncEventBus)
+    EVENT_BUS_MODE = "sync"
+    # Record hot-path spans from startup (otherwise: Performance panel > Start Recording)
+    TRACE_HOT_PATH = False
     print("--- Starting Interface V2 ---")
     print(f"Hardware Config: {HARDWARE_CONFIG}")
     
     # 3. Infrastructure Setup (Event Bus)
-    event_bus = InMemoryEventBus()
+    if EVENT_BUS_MODE == "async":
+        # Lossless (BLOCK) by default: export / scan services must see every event.
+        # Display-only presenters drop their oldest pending events instead of
+        # slowing the acquisition thread.
+        ui_event_options = SubscriptionOptions(policy=BackpressurePolicy.DROP_OLDEST)
+        event_bus = AsyncEventBus(
+            topic_registry=EVENT_TOPICS,
+            owner_options={MotionPresenter: ui_event_options, ContinuousAcquisitionPresenter: ui_event_options},
+        )
+    else:
+        event_bus = InMemoryEventBus(topic_registry=EVENT_TOPICS)
+    print(f"Event Bus: {type(event_bus).__name__}")
+    if TRACE_HOT_PATH:
+        TRACER.enable()
     
     # 4. Instantiate Adapters
     print("\n--- Initializing Hardware Adapters ---")
@@ -92,14 +135,21 @@ def main():
     excitation_port = None
     continuous_executor = None
     lifecycle_adapters = []
+    lifecycle_names = []
     
     # --- Motion (Arcus) ---
     if HARDWARE_CONFIG["motion"] == "real":
         from infrastructure.hardware.arcus_performax_4EX.composition_root_arcus import ArcusCompositionRoot
-        print("  [motion] -> real (ArcusCompositionRoot)")
-        arcus_root = ArcusCompositionRoot(event_bus=event_bus)
+        if SIMULATED_HARDWARE:
+            print("  [motion] -> real (ArcusCompositionRoot on SimulatedPerformaxLib)")
+            arcus_root = ArcusCompositionRoot(event_bus=event_bus, backend="native",
+                                              performax_lib=SimulatedPerformaxLib(profile=SIMULATION_PROFILE))
+        else:
+            print("  [motion] -> real (ArcusCompositionRoot)")
+            arcus_root = ArcusCompositionRoot(event_bus=event_bus)
         motion_port = arcus_root.motion
         lifecycle_adapters.append(arcus_root.lifecycle)
+        lifecycle_names.append("arcus")
     else:
         print("  [motion] -> mock")
         motion_port = MockMotionPort(event_bus=event_bus, motion_delay_ms=50.0)
@@ -108,11 +158,17 @@ def main():
     mcu_root = None
     if HARDWARE_CONFIG["acquisition"] == "real":
         from infrastructure.hardware.micro_controller.mcu_composition_root import MCUCompositionRoot
-        print("  [acquisition] -> real (MCUCompositionRoot)")
         # Note: MCUCompositionRoot needs event_bus for continuous acquisition
-        mcu_root = MCUCompositionRoot(event_bus=event_bus)
+        if SIMULATED_HARDWARE:
+            print("  [acquisition] -> real (MCUCompositionRoot on SimulatedMcuSerial)")
+            mcu_root = MCUCompositionRoot(event_bus=event_bus,
+                                          serial_factory=SimulatedMcuSerial.factory(profile=SIMULATION_PROFILE))
+        else:
+            print("  [acquisition] -> real (MCUCompositionRoot)")
+            mcu_root = MCUCompositionRoot(event_bus=event_bus)
         base_acquisition_port = mcu_root.acquisition
         lifecycle_adapters.append(mcu_root.lifecycle)
+        lifecycle_names.append("mcu")
         continuous_executor = mcu_root.continuous
         
         # --- Excitation (AD9106 - part of MCU) ---
@@ -181,7 +237,8 @@ def main():
     # 5. Create Hardware Initialization Port
     if lifecycle_adapters:
         from infrastructure.hardware.composite_hardware_initialization_port import CompositeHardwareInitializationPort
-        init_port = CompositeHardwareInitializationPort(lifecycle_adapters)
+        # Arcus and MCU share no link: initialized concurrently (no dependencies)
+        init_port = CompositeHardwareInitializationPort(lifecycle_adapters, names=lifecycle_names)
     else:
         init_port = MockHardwareInitializationPort()
     
@@ -189,15 +246,32 @@ def main():
     print("\n--- Creating Application Services ---")
     
     # Scan Executor (Infrastructure service)
-    scan_executor = StepScanExecutor(motion_port, acquisition_port, event_bus)
+    if SCAN_STRATEGY == "fly":
+        axis_params_provider = arcus_root.axis_params if HARDWARE_CONFIG["motion"] == "real" else None
+        scan_executor = FlyScanExecutor(motion_port, acquisition_port, event_bus,
+                                        axis_params_provider=axis_params_provider)
+        print("  [scan] -> fly scan (continuous motion)")
+    else:
+        scan_executor = StepScanExecutor(motion_port, acquisition_port, event_bus,
+                                         pipelined=STEP_SCAN_PIPELINED,
+                                         raw_capture=RAW_SAMPLE_CAPTURE)
+    
+    # Trajectory optimizer (step scan only: the fly scan needs whole rows)
+    trajectory_optimizer = None
+    if TRAJECTORY_OPTIMIZATION and SCAN_STRATEGY != "fly" and HARDWARE_CONFIG["motion"] == "real":
+        trajectory_optimizer = TrajectoryOptimizer(arcus_root.motion_profile("X"), arcus_root.motion_profile("Y"))
+        print("  [scan] -> move-time trajectory optimization")
     
     # Scan Application Service
-    scan_service = ScanApplicationService(motion_port, acquisition_port, event_bus, scan_executor)
+    scan_service = ScanApplicationService(motion_port, acquisition_port, event_bus, scan_executor,
+                                          trajectory_optimizer=trajectory_optimizer)
     
     # Scan Export Service
     csv_export_port = CsvScanExportPort()
     hdf5_export_port = Hdf5ScanExportPort()
-    scan_export_service = ScanExportService(event_bus, csv_export_port, hdf5_export_port)
+    binary_export_port = BinaryScanExportPort()
+    scan_export_service = ScanExportService(event_bus, csv_export_port, hdf5_export_port, binary_export_port,
+                                            raw_capture=RAW_SAMPLE_CAPTURE and SCAN_STRATEGY != "fly")
     
     # Excitation Service
     excitation_service = ExcitationConfigurationService(excitation_port)
@@ -279,6 +353,32 @@ def main():
     # Hardware Advanced Config Presenter
     hardware_config_presenter = HardwareAdvancedConfigPresenter(hardware_config_service)
     
+    # Performance Presenter: live counters read from the existing component stats
+    performance_counters = PerformanceCounters()
+    scan_points = Counter()
+    event_bus.subscribe(SCAN_POINT_ACQUIRED, lambda event: scan_points.increment())
+    performance_counters.register_rate("scan points", scan_points, unit="pts/s")
+    performance_counters.register_rate("continuous samples",
+                                       lambda: continuous_service.get_timing_stats().ticks, unit="S/s")
+    performance_counters.register_gauge("continuous overruns", continuous_service.get_sample_overruns)
+    if isinstance(event_bus, AsyncEventBus):
+        performance_counters.register_gauge(
+            "event queue depth", lambda: sum(s.queue_depth for s in event_bus.get_stats().values()))
+        performance_counters.register_gauge(
+            "events dropped", lambda: sum(s.dropped for s in event_bus.get_stats().values()))
+    if mcu_root:
+        performance_counters.register_rate("MCU exchanges", lambda: mcu_root.link_stats()["exchanges"])
+        performance_counters.register_gauge("MCU timeouts", lambda: mcu_root.link_stats()["timeouts"])
+        performance_counters.register_gauge("MCU errors", lambda: mcu_root.link_stats()["errors"])
+        performance_counters.register_gauge("stream CRC errors", lambda: mcu_root.link_stats()["crc_errors"])
+        performance_counters.register_gauge("stream lost frames", lambda: mcu_root.link_stats()["lost_frames"])
+    if HARDWARE_CONFIG["motion"] == "real":
+        performance_counters.register_rate("Performax round trips", lambda: arcus_root.link_stats()["round_trips"])
+        performance_counters.register_gauge("Performax errors", lambda: arcus_root.link_stats()["errors"])
+    performance_presenter = PerformancePresenter(
+        performance_counters, TRACER,
+        trace_directory=os.path.join(".aefi_acquisition", "logs", "traces"))
+    
     # 10. Wire Presenters to Panels
     print("--- Wiring Presenters to Panels ---")
     
@@ -352,13 +452,14 @@ def main():
     def on_scan_started_viz(scan_id, config):
         scan_visualization_panel.initialize_scan(
             config["x_min"], config["x_max"], config["x_nb_points"],
-            config["y_min"], config["y_max"], config["y_nb_points"]
+            config["y_min"], config["y_max"], config["y_nb_points"],
+            config.get("refinement_levels", 0), config.get("refinement_subdivision", 1)
         )
         
     def on_scan_progress_viz(current, total, data):
-        # data has 'x', 'y', 'value'
+        # data has 'x', 'y', 'value', 'level' (resolution level of multi-resolution scans)
         scan_visualization_panel.update_data_point_from_position(
-            data["x"], data["y"], data["value"]
+            data["x"], data["y"], data["value"], data.get("level", 0)
         )
 
     scan_presenter.scan_started.connect(on_scan_started_viz)
@@ -383,6 +484,16 @@ def main():
     hardware_config_presenter.refresh_hardware_list()
     
     print("  [hardware_config] wired")
+    
+    # Performance Panel
+    performance_panel = dashboard.panels["performance"]
+    performance_panel.tracing_toggled.connect(performance_presenter.set_tracing)
+    performance_panel.export_trace_requested.connect(performance_presenter.export_trace)
+    performance_presenter.counters_updated.connect(performance_panel.update_counters)
+    performance_presenter.tracing_changed.connect(performance_panel.on_tracing_changed)
+    performance_presenter.status_message.connect(performance_panel.set_status_message)
+    performance_panel.on_tracing_changed(TRACER.enabled)
+    print("  [performance] wired")
 
     print("  [transformation] wired (via constructor)")
     
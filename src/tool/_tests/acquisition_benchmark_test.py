@@ -0,0 +1,131 @@
+import io
+import json
+import sys
+import tempfile
+import unittest
+from contextlib import redirect_stdout
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+from tool import acquisition_benchmark
+from tool.acquisition_benchmark import compare, load_baseline, run_isolated, run_scenario, save_baseline
+from tool.benchmark_scenarios import PointTimeline, ScenarioResult, percentile
+
+
+class FakeClock:
+    def __init__(self):
+        self.now = 0.0
+
+    def __call__(self):
+        return self.now
+
+
+class TestPercentileAndTimeline(unittest.TestCase):
+    def test_percentile_interpolates_between_ranks(self):
+        values = [4.0, 1.0, 3.0, 2.0]
+        self.assertEqual(percentile(values, 0), 1.0)
+        self.assertEqual(percentile(values, 50), 2.5)
+        self.assertEqual(percentile(values, 100), 4.0)
+        self.assertAlmostEqual(percentile(range(101), 99), 99.0)
+
+    def test_timeline_splits_points_into_stages(self):
+        clock = FakeClock()
+        timeline = PointTimeline(clock=clock)
+        for move_s in (0.010, 0.020):
+            timeline.move_started()
+            clock.now += move_s
+            timeline.arrived()
+            clock.now += 0.002  # settle
+            timeline.sample(clock.now, clock.now + 0.001)
+            timeline.sample(clock.now + 0.001, clock.now + 0.004)
+            clock.now += 0.004
+        timeline.finish()
+
+        for expected, actual in zip([0.010, 0.020], timeline.move):
+            self.assertAlmostEqual(actual, expected)
+        for actual in timeline.settle:
+            self.assertAlmostEqual(actual, 0.002)
+        for actual in timeline.acquire:
+            self.assertAlmostEqual(actual, 0.004)
+        self.assertAlmostEqual(timeline.point[1], 0.026)
+        self.assertEqual(timeline.samples, 4)
+
+
+class TestBaselineComparison(unittest.TestCase):
+    def _result(self, **values):
+        result = ScenarioResult("scenario")
+        result.add("points_per_s", values.get("points_per_s", 100.0), "points/s", "higher")
+        result.add("point_p99_ms", values.get("point_p99_ms", 10.0), "ms", "lower", 0.5)
+        result.add("points", 400, "points")
+        return result
+
+    def _baseline(self, result):
+        with tempfile.TemporaryDirectory() as tmp:
+            path = Path(tmp) / "baseline.json"
+            save_baseline(path, [result])
+            return load_baseline(path)["scenario"]
+
+    def test_within_tolerance_is_not_a_regression(self):
+        baseline = self._baseline(self._result())
+        self.assertEqual(compare(self._result(points_per_s=85.0, point_p99_ms=11.5), baseline, 0.2), [])
+
+    def test_direction_decides_what_regresses(self):
+        baseline = self._baseline(self._result())
+        regressions = compare(self._result(points_per_s=70.0, point_p99_ms=13.0), baseline, 0.2)
+        self.assertEqual({r.metric for r in regressions}, {"points_per_s", "point_p99_ms"})
+        self.assertEqual(compare(self._result(points_per_s=500.0, point_p99_ms=1.0), baseline, 0.2), [])
+
+    def test_floor_absorbs_noise_on_small_values(self):
+        baseline = self._baseline(self._result(point_p99_ms=0.1))
+        self.assertEqual(compare(self._result(point_p99_ms=0.5), baseline, 0.2), [])
+        self.assertEqual(len(compare(self._result(point_p99_ms=0.7), baseline, 0.2)), 1)
+
+    def test_update_keeps_other_scenarios(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            path = Path(tmp) / "baseline.json"
+            other = ScenarioResult("other")
+            other.add("rows_per_s", 1.0, "rows/s", "higher")
+            save_baseline(path, [other])
+            save_baseline(path, [self._result()], load_baseline(path))
+            self.assertEqual(set(load_baseline(path)), {"other", "scenario"})
+
+
+class TestScenarios(unittest.TestCase):
+    def test_step_scan_reports_every_stage_of_every_point(self):
+        result = run_scenario("step_scan", {"points": 25, "averaging": 3, "export_format": "CSV"})
+        metrics = result.metrics
+        self.assertEqual(metrics["points"].value, 25)
+        self.assertEqual(metrics["samples"].value, 75)
+        self.assertGreater(metrics["export_kb"].value, 0)
+        self.assertGreater(metrics["points_per_s"].value, 0)
+        for stage in ("move", "settle", "acquire", "export", "point"):
+            self.assertIn(f"{stage}_p50_ms", metrics)
+            self.assertLessEqual(metrics[f"{stage}_p50_ms"].value, metrics[f"{stage}_p99_ms"].value)
+        self.assertGreater(metrics["peak_rss_mb"].value, 0)
+
+    def test_isolated_run_returns_the_scenario_result(self):
+        result = run_isolated("event_fanout", {"events": 200, "subscriber_counts": [2]})
+        self.assertEqual(result.name, "event_fanout")
+        self.assertIn("async_2subs_deliveries_per_s", result.metrics)
+        self.assertIn("peak_rss_mb", result.metrics)
+
+    def test_cli_fails_on_regression(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            path = Path(tmp) / "baseline.json"
+            args = ["signal_processing", "--in-process", "--param", "samples=500", "--baseline", str(path)]
+            with redirect_stdout(io.StringIO()):
+                self.assertEqual(acquisition_benchmark.main(args + ["--update-baseline"]), 0)
+                self.assertEqual(acquisition_benchmark.main(args + ["--tolerance", "100"]), 0)
+
+                data = json.loads(path.read_text())
+                data["scenarios"]["signal_processing"]["post_processor_samples_per_s"]["value"] = 1e12
+                path.write_text(json.dumps(data))
+                self.assertEqual(acquisition_benchmark.main(args), 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,289 @@
+import importlib.util
+import io
+import json
+import math
+import struct
+import sys
+import tempfile
+import unittest
+from contextlib import redirect_stdout
+from pathlib import Path
+
+# Ensure src is in path
+src_path = Path(__file__).resolve().parent.parent.parent
+if str(src_path) not in sys.path:
+    sys.path.append(str(src_path))
+
+HAS_NUMPY = importlib.util.find_spec("numpy") is not None
+HAS_H5PY = HAS_NUMPY and importlib.util.find_spec("h5py") is not None
+
+from infrastructure.persistence.binary_scan_export_port import ROW_COLUMNS, encode_header
+
+if HAS_NUMPY:
+    import numpy as np
+    from tool.post_processing_kernels import (
+        build_grid,
+        calibrate_phase,
+        load_scan,
+        load_scan_binary,
+        load_scan_csv,
+        magnitude_phase,
+        rotate_frame,
+        rotation_matrix,
+        rotation_quaternion,
+        subtract_primary,
+    )
+if HAS_H5PY:
+    import h5py
+    from tool.batch_post_process import BatchParameters, content_key, discover_scans, run_batch
+
+HEADER = (
+    "scan_id,point_index,x,y,"
+    "voltage_x_in_phase,voltage_x_quadrature,voltage_y_in_phase,voltage_y_quadrature,"
+    "voltage_z_in_phase,voltage_z_quadrature,"
+    "std_dev_x_in_phase,std_dev_x_quadrature,std_dev_y_in_phase,std_dev_y_quadrature,"
+    "std_dev_z_in_phase,std_dev_z_quadrature"
+)
+
+
+def write_scan_csv(path: Path, points, skip=()):
+    """3 x 2 grid (x: 0, 10, 20; y: 5, 15), point values derived from the indices."""
+    lines = [HEADER]
+    for index, (x, y, values) in enumerate(points):
+        if index in skip:
+            continue
+        fields = ["89662a7d-54eb-4a0e-bca9-4bb58c0801b1", str(index), str(x), str(y)]
+        fields += [repr(v) for v in values] + ["1e-05"] * 6
+        lines.append(",".join(fields))
+    path.write_text("\n".join(lines) + "\n", encoding="utf-8")
+
+
+def write_scan_binary(path: Path, points, skip=(), levels=None):
+    """Same points as write_scan_csv, in the BinaryScanExportPort layout (level 0 unless given)."""
+    row = struct.Struct(f"<{ROW_COLUMNS}d")
+    with open(path, "wb") as f:
+        f.write(encode_header({"scan_id": "89662a7d-54eb-4a0e-bca9-4bb58c0801b1"}))
+        for index, (x, y, values) in enumerate(points):
+            if index not in skip:
+                level = levels[index] if levels else 0
+                f.write(row.pack(index, x, y, *values, *([1e-05] * 6), 10, level))
+
+
+def grid_points():
+    points = []
+    for row, y in enumerate((5.0, 15.0)):
+        for col, x in enumerate((0.0, 10.0, 20.0)):
+            base = 1.0 + row * 3 + col
+            points.append((x, y, [base, 0.5 * base, -base, 0.25 * base, 2.0 * base, -0.5 * base]))
+    return points
+
+
+@unittest.skipUnless(HAS_NUMPY, "numpy not installed")
+class TestPostProcessingKernels(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.csv = Path(self.tmp.name) / "scan.csv"
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def test_grid_is_square_and_nan_padded(self):
+        points = grid_points()
+        write_scan_csv(self.csv, list(reversed(points)), skip={0})  # Rows order must not matter
+        grid, metadata = build_grid(*load_scan_csv(self.csv))
+
+        self.assertEqual(grid.shape, (3, 3, 6))
+        self.assertEqual(metadata["original_nx"], 3)
+        self.assertEqual(metadata["original_ny"], 2)
+        self.assertEqual(metadata["valid_points"], 5)  # 6 points, last one skipped
+        self.assertTrue(np.isnan(grid[2]).all())  # Padding row
+        self.assertTrue(np.isnan(grid[1, 2]).all())  # Skipped point (x=20, y=15)
+        np.testing.assert_allclose(grid[1, 0], points[3][2])
+        self.assertEqual(metadata["extent"], [-5.0, 25.0, 0.0, 30.0])
+
+    def test_phase_calibration_zeroes_reference_quadrature_and_keeps_sign(self):
+        write_scan_csv(self.csv, grid_points())
+        grid, _ = build_grid(*load_scan_csv(self.csv))
+        calibrated, phases = calibrate_phase(grid, (0, 0))
+
+        ref_before, ref_after = grid[0, 0], calibrated[0, 0]
+        np.testing.assert_allclose(ref_after[[1, 3, 5]], 0.0, atol=1e-12)
+        np.testing.assert_allclose(np.sign(ref_after[[0, 2, 4]]), np.sign(ref_before[[0, 2, 4]]))
+        np.testing.assert_allclose(np.abs(ref_after[[0, 2, 4]]),
+                                   np.hypot(ref_before[[0, 2, 4]], ref_before[[1, 3, 5]]))
+        self.assertAlmostEqual(phases["x"], math.atan2(0.5, 1.0))
+        self.assertEqual(phases["reference_used"], (0, 0))
+
+    def test_invalid_reference_falls_back_to_nearest_valid_point(self):
+        write_scan_csv(self.csv, grid_points(), skip={0})
+        grid, _ = build_grid(*load_scan_csv(self.csv))
+        _, phases = calibrate_phase(grid, (0, 0))
+        self.assertEqual(phases["reference_used"], (0, 1))
+
+    def test_primary_subtraction_zeroes_reference(self):
+        write_scan_csv(self.csv, grid_points())
+        grid, _ = build_grid(*load_scan_csv(self.csv))
+        subtracted, primary = subtract_primary(grid, (0, 0))
+        np.testing.assert_allclose(subtracted[0, 0], 0.0)
+        np.testing.assert_allclose(primary, grid[0, 0])
+
+    def test_rotation_matches_single_axis_and_composition_order(self):
+        np.testing.assert_allclose(rotation_matrix((0, 0, 90)) @ [1, 0, 0], [0, 1, 0], atol=1e-12)
+        np.testing.assert_allclose(rotation_matrix((90, 0, 0)) @ [0, 1, 0], [0, 0, 1], atol=1e-12)
+        angles = (35.26, -45.0, -7.2)
+        m = rotation_matrix(angles)
+        np.testing.assert_allclose(m, rotation_matrix((35.26, 0, 0)) @ rotation_matrix((0, -45.0, 0))
+                                   @ rotation_matrix((0, 0, -7.2)))
+        np.testing.assert_allclose(m @ m.T, np.eye(3), atol=1e-12)
+
+        x, y, z, w = rotation_quaternion(angles)
+        from_quaternion = np.array([
+            [1 - 2 * (y * y + z * z), 2 * (x * y - z * w), 2 * (x * z + y * w)],
+            [2 * (x * y + z * w), 1 - 2 * (x * x + z * z), 2 * (y * z - x * w)],
+            [2 * (x * z - y * w), 2 * (y * z + x * w), 1 - 2 * (x * x + y * y)],
+        ])
+        np.testing.assert_allclose(from_quaternion, m, atol=1e-12)
+
+    def test_rotation_applies_to_in_phase_and_quadrature_triples(self):
+        grid = np.arange(2 * 2 * 6, dtype=float).reshape(2, 2, 6)
+        m = rotation_matrix((10.0, 20.0, 30.0))
+        rotated = rotate_frame(grid, m)
+        pixel = grid[1, 0]
+        np.testing.assert_allclose(rotated[1, 0, [0, 2, 4]], m @ pixel[[0, 2, 4]])
+        np.testing.assert_allclose(rotated[1, 0, [1, 3, 5]], m @ pixel[[1, 3, 5]])
+
+    def test_magnitude_phase(self):
+        grid = np.array([[[3.0, 4.0, 0.0, -2.0, -1.0, 0.0]]])
+        np.testing.assert_allclose(magnitude_phase(grid)[0, 0],
+                                   [5.0, math.atan2(4, 3), 2.0, -math.pi / 2, 1.0, math.pi])
+
+    def test_binary_scan_loads_like_csv(self):
+        binary = Path(self.tmp.name) / "scan.aefscan"
+        write_scan_csv(self.csv, grid_points(), skip={2})
+        write_scan_binary(binary, grid_points(), skip={2})
+        for expected, actual in zip(load_scan_csv(self.csv), load_scan(binary)):
+            np.testing.assert_array_equal(actual, expected)
+            self.assertTrue(actual.flags["C_CONTIGUOUS"])
+
+        write_scan_binary(binary, [])
+        with self.assertRaises(ValueError):
+            load_scan_binary(binary)
+
+    def test_refined_scan_is_resampled_onto_finest_lattice(self):
+        binary = Path(self.tmp.name) / "scan.aefscan"
+        coarse = [(x, y) for y in (0.0, 4.0) for x in (0.0, 4.0, 8.0)]
+        points = [(x, y, [float(i)] * 6) for i, (x, y) in enumerate(coarse)]
+        points += [(2.0, 0.0, [10.0] * 6), (1.0, 0.0, [20.0] * 6)]  # Levels 1 and 2
+        write_scan_binary(binary, points, levels=[0] * 6 + [1, 2])
+        grid, metadata = build_grid(*load_scan(binary))
+
+        # Coarse step 4, subdivision 2 over 2 levels: fine step 1, 9 x 5 lattice
+        self.assertEqual(grid.shape, (9, 9, 6))
+        self.assertEqual((metadata["original_nx"], metadata["original_ny"]), (9, 5))
+        self.assertEqual(metadata["refinement_subdivision"], 2)
+        self.assertEqual(metadata["extent"], [-0.5, 8.5, -0.5, 8.5])
+        self.assertEqual(list(grid[0, :4, 0]), [0.0, 20.0, 10.0, 1.0])
+        self.assertEqual(grid[1, 1, 0], 0.0)  # Coarse block kept around the refined cells
+        self.assertEqual(grid[1, 2, 0], 1.0)
+        self.assertEqual(grid[4, 8, 0], 5.0)
+        self.assertTrue(np.isnan(grid[5:]).all())
+
+        points[7] = (1.3, 0.0, [20.0] * 6)
+        write_scan_binary(binary, points, levels=[0] * 6 + [1, 2])
+        with self.assertRaises(ValueError):
+            build_grid(*load_scan(binary))
+
+    def test_missing_columns_and_empty_scan_are_rejected(self):
+        self.csv.write_text("x,y,voltage_x_in_phase\n0,0,1\n", encoding="utf-8")
+        with self.assertRaises(ValueError):
+            load_scan_csv(self.csv)
+        self.csv.write_text(HEADER + "\n", encoding="utf-8")
+        with self.assertRaises(ValueError):
+            load_scan_csv(self.csv)
+
+
+@unittest.skipUnless(HAS_H5PY, "numpy / h5py not installed")
+class TestBatchPostProcess(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.raw = Path(self.tmp.name) / "raw_data"
+        self.out = Path(self.tmp.name) / "processed_data"
+        self.raw.mkdir()
+        for name in ("a_stepScanResults", "b_stepScanResults"):
+            write_scan_csv(self.raw / f"{name}.csv", grid_points())
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def _run(self, parameters=None, force=False, jobs=1):
+        with redirect_stdout(io.StringIO()):
+            results = run_batch(sorted(self.raw.glob("*.csv")), self.out,
+                                parameters or BatchParameters(), jobs=jobs, force=force)
+        return {r["scan"]: r["status"] for r in results}
+
+    def test_output_layout(self):
+        self.assertEqual(self._run(), {"a_stepScanResults": "processed", "b_stepScanResults": "processed"})
+        with h5py.File(self.out / "a_stepScanResults.h5", "r") as f:
+            self.assertEqual(
+                set(f.keys()),
+                {"preprocessed", "phase_calibrated", "amplitude_subtracted", "rotated_frame", "magnitude_phase"},
+            )
+            dataset = f["rotated_frame/data"]
+            self.assertEqual(dataset.shape, (3, 3, 6))
+            self.assertEqual(dataset.compression, "gzip")
+            self.assertTrue(dataset.shuffle)
+            self.assertIsNotNone(dataset.chunks)
+            self.assertEqual(json.loads(f["preprocessed"].attrs["channel_names"])[0], "voltage_x_in_phase")
+            self.assertIn("x", json.loads(f["phase_calibrated"].attrs["phase_angles"]))
+            self.assertEqual(f["rotated_frame"].attrs["rotation_matrix"].shape, (3, 3))
+            self.assertEqual(len(f.attrs["processing_history"]), 5)
+            self.assertEqual(f.attrs["content_sha256"],
+                             content_key(self.raw / "a_stepScanResults.csv", BatchParameters()))
+        self.assertEqual(list(self.out.glob("*.tmp")), [])
+
+    def test_up_to_date_scans_are_skipped_by_content(self):
+        self._run()
+        self.assertEqual(set(self._run().values()), {"up_to_date"})
+
+        points = grid_points()
+        points[4] = (10.0, 15.0, [9.0] * 6)
+        write_scan_csv(self.raw / "b_stepScanResults.csv", points)
+        self.assertEqual(self._run(), {"a_stepScanResults": "up_to_date", "b_stepScanResults": "processed"})
+
+        self.assertEqual(set(self._run(BatchParameters(rotation_angles=None)).values()), {"processed"})
+        self.assertEqual(set(self._run(BatchParameters(rotation_angles=None), force=True).values()), {"processed"})
+
+    def test_without_rotation_magnitude_comes_from_subtracted_step(self):
+        self._run(BatchParameters(rotation_angles=None))
+        with h5py.File(self.out / "a_stepScanResults.h5", "r") as f:
+            self.assertNotIn("rotated_frame", f)
+            self.assertEqual(f["magnitude_phase"].attrs["source_step"], "amplitude_subtracted")
+
+    def test_failed_scan_does_not_stop_batch(self):
+        (self.raw / "c_stepScanResults.csv").write_text(HEADER + "\n", encoding="utf-8")
+        statuses = self._run()
+        self.assertEqual(statuses["c_stepScanResults"], "failed")
+        self.assertEqual(statuses["a_stepScanResults"], "processed")
+
+    def test_binary_scans_are_discovered_and_preferred_over_csv(self):
+        write_scan_binary(self.raw / "b_stepScanResults.aefscan", grid_points())
+        write_scan_binary(self.raw / "c_stepScanResults.aefscan", grid_points())
+        self.assertEqual([p.name for p in discover_scans(self.raw)],
+                         ["a_stepScanResults.csv", "b_stepScanResults.aefscan", "c_stepScanResults.aefscan"])
+
+        with redirect_stdout(io.StringIO()):
+            results = run_batch(discover_scans(self.raw), self.out, jobs=1)
+        self.assertEqual({r["status"] for r in results}, {"processed"})
+        with h5py.File(self.out / "a_stepScanResults.h5", "r") as csv_output, \
+                h5py.File(self.out / "c_stepScanResults.h5", "r") as binary_output:
+            self.assertTrue(binary_output.attrs["source_csv"].endswith(".aefscan"))
+            np.testing.assert_array_equal(binary_output["rotated_frame/data"][()],
+                                          csv_output["rotated_frame/data"][()])
+
+    def test_worker_processes(self):
+        self.assertEqual(set(self._run(jobs=2).values()), {"processed"})
+        self.assertTrue((self.out / "b_stepScanResults.h5").exists())
+
+
+if __name__ == "__main__":
+    unittest.main()
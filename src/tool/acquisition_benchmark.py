@@ -0,0 +1,273 @@
+"""
+CLI tool to benchmark the acquisition stack on mock / simulated backends.
+
+Usage:
+    python -m tool.acquisition_benchmark                      # all scenarios, compare to baseline
+    python -m tool.acquisition_benchmark --quick step_scan    # smaller sizes, one scenario
+    python -m tool.acquisition_benchmark --update-baseline    # run and store as the new baseline
+    python -m tool.acquisition_benchmark --backend sim step_scan --param points=900
+
+Responsibility:
+- Run the scenarios of `tool.benchmark_scenarios` (6400-point step scan,
+  10-minute continuous acquisition, CSV/binary/HDF5 export, signal
+  processing per-sample cost, event bus fan-out).
+- Report throughput, p50/p99 latencies and peak RSS of each scenario.
+- Compare with a stored baseline and exit with status 1 on regression.
+
+Design:
+- Each scenario runs in its own spawned process: peak RSS is that of the
+  scenario alone, and no thread or bus subscription leaks between scenarios.
+  The scenarios print a lot (mock ports): their stdout goes to /dev/null.
+- Baseline: JSON file, one entry per scenario and metric. A metric regresses
+  when it is worse than the baseline by more than max(tolerance * |baseline|,
+  metric floor). Baselines are machine specific: create one per bench PC
+  with --update-baseline (default location under .aefi_acquisition/benchmarks).
+"""
+
+from __future__ import annotations
+
+import argparse
+import concurrent.futures
+import contextlib
+import inspect
+import json
+import multiprocessing
+import os
+import platform
+import sys
+from dataclasses import asdict, dataclass
+from datetime import datetime
+from pathlib import Path
+from typing import Any, Dict, List, Optional, Sequence
+
+from tool.benchmark_scenarios import QUICK_PARAMETERS, SCENARIOS, ScenarioResult
+
+# Project root = parent of "src" directory (this file is under src/tool/)
+PROJECT_ROOT = Path(__file__).resolve().parents[2]
+DEFAULT_BASELINE = PROJECT_ROOT / ".aefi_acquisition" / "benchmarks" / "baseline.json"
+DEFAULT_TOLERANCE = 0.2
+
+
+@dataclass(frozen=True)
+class Regression:
+    scenario: str
+    metric: str
+    baseline: float
+    value: float
+    unit: str
+    better: str
+
+    def describe(self) -> str:
+        change = (self.value - self.baseline) / abs(self.baseline) * 100 if self.baseline else float("inf")
+        return (f"{self.scenario}.{self.metric}: {self.value:.4g} {self.unit} "
+                f"vs baseline {self.baseline:.4g} ({change:+.1f}%, {self.better} is better)")
+
+
+# ============================================================================
+# RUNNING
+# ============================================================================
+
+def peak_rss_mb() -> Optional[float]:
+    """Peak resident set size of the current process, in MB (None if unknown)."""
+    try:
+        import resource
+    except ImportError:
+        return _peak_working_set_mb()
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Linux reports kB, macOS bytes
+    return peak / (1024.0 * 1024.0) if sys.platform == "darwin" else peak / 1024.0
+
+
+def _peak_working_set_mb() -> Optional[float]:
+    """Windows: PeakWorkingSetSize from GetProcessMemoryInfo."""
+    try:
+        import ctypes
+        from ctypes import wintypes
+
+        class PROCESS_MEMORY_COUNTERS(ctypes.Structure):
+            _fields_ = [
+                ("cb", wintypes.DWORD),
+                ("PageFaultCount", wintypes.DWORD),
+                ("PeakWorkingSetSize", ctypes.c_size_t),
+                ("WorkingSetSize", ctypes.c_size_t),
+                ("QuotaPeakPagedPoolUsage", ctypes.c_size_t),
+                ("QuotaPagedPoolUsage", ctypes.c_size_t),
+                ("QuotaPeakNonPagedPoolUsage", ctypes.c_size_t),
+                ("QuotaNonPagedPoolUsage", ctypes.c_size_t),
+                ("PagefileUsage", ctypes.c_size_t),
+                ("PeakPagefileUsage", ctypes.c_size_t),
+            ]
+
+        counters = PROCESS_MEMORY_COUNTERS()
+        counters.cb = ctypes.sizeof(counters)
+        process = ctypes.windll.kernel32.GetCurrentProcess()
+        if not ctypes.windll.psapi.GetProcessMemoryInfo(process, ctypes.byref(counters), counters.cb):
+            return None
+        return counters.PeakWorkingSetSize / (1024.0 * 1024.0)
+    except (AttributeError, OSError):
+        return None
+
+
+def run_scenario(name: str, params: Optional[Dict[str, Any]] = None, quiet: bool = True) -> ScenarioResult:
+    """Run one scenario in the current process and add its peak RSS."""
+    scenario = SCENARIOS[name]
+    params = dict(params or {})
+    if quiet:
+        with open(os.devnull, "w") as devnull, contextlib.redirect_stdout(devnull):
+            result = scenario(**params)
+    else:
+        result = scenario(**params)
+    rss = peak_rss_mb()
+    if rss is not None:
+        result.add("peak_rss_mb", rss, "MB", "lower", 5.0)
+    return result
+
+
+def run_isolated(name: str, params: Optional[Dict[str, Any]] = None) -> ScenarioResult:
+    """Run one scenario in a fresh spawned process."""
+    context = multiprocessing.get_context("spawn")
+    with concurrent.futures.ProcessPoolExecutor(max_workers=1, mp_context=context) as pool:
+        return pool.submit(run_scenario, name, params).result()
+
+
+# ============================================================================
+# BASELINE
+# ============================================================================
+
+def load_baseline(path: Path) -> Dict[str, Dict[str, Dict[str, Any]]]:
+    """{scenario: {metric: {"value", "unit", "better", "floor"}}} ({} if no file)."""
+    if not path.exists():
+        return {}
+    with path.open("r", encoding="utf-8") as f:
+        return json.load(f).get("scenarios", {})
+
+
+def save_baseline(path: Path, results: Sequence[ScenarioResult], previous: Optional[Dict] = None) -> None:
+    """Store `results`, keeping the baseline of scenarios that were not run."""
+    scenarios = dict(previous or {})
+    for result in results:
+        scenarios[result.name] = {key: asdict(metric) for key, metric in result.metrics.items()}
+    path.parent.mkdir(parents=True, exist_ok=True)
+    payload = {
+        "created": datetime.now().isoformat(timespec="seconds"),
+        "machine": {"platform": platform.platform(), "python": platform.python_version(),
+                    "processor": platform.processor(), "cpu_count": os.cpu_count()},
+        "scenarios": scenarios,
+    }
+    with path.open("w", encoding="utf-8") as f:
+        json.dump(payload, f, indent=2, sort_keys=True)
+
+
+def compare(result: ScenarioResult, baseline: Dict[str, Dict[str, Any]], tolerance: float) -> List[Regression]:
+    """Metrics of `result` worse than `baseline` beyond the tolerance (directional metrics only)."""
+    regressions = []
+    for key, metric in result.metrics.items():
+        reference = baseline.get(key)
+        if metric.better is None or reference is None:
+            continue
+        base = float(reference["value"])
+        worse_by = metric.value - base if metric.better == "lower" else base - metric.value
+        allowed = max(tolerance * abs(base), float(reference.get("floor", metric.floor)))
+        if worse_by > allowed:
+            regressions.append(Regression(result.name, key, base, metric.value, metric.unit, metric.better))
+    return regressions
+
+
+# ============================================================================
+# REPORT
+# ============================================================================
+
+def format_result(result: ScenarioResult, baseline: Optional[Dict[str, Dict[str, Any]]] = None) -> str:
+    lines = [f"== {result.name}"]
+    for key, metric in result.metrics.items():
+        line = f"  {key:<36} {metric.value:>14.4g} {metric.unit}"
+        reference = (baseline or {}).get(key)
+        if reference is not None and reference.get("value"):
+            change = (metric.value - reference["value"]) / abs(reference["value"]) * 100
+            line += f"   ({change:+.1f}% vs baseline)"
+        lines.append(line)
+    lines += [f"  skipped: {reason}" for reason in result.skipped]
+    return "\n".join(lines)
+
+
+def _parse_params(items: Sequence[str]) -> Dict[str, Any]:
+    """key=value pairs; values parsed as JSON when possible (numbers, booleans)."""
+    params = {}
+    for item in items:
+        key, sep, value = item.partition("=")
+        if not sep:
+            raise argparse.ArgumentTypeError(f"--param expects key=value, got '{item}'")
+        try:
+            params[key] = json.loads(value)
+        except json.JSONDecodeError:
+            params[key] = value
+    return params
+
+
+def main(argv: Optional[Sequence[str]] = None) -> int:
+    parser = argparse.ArgumentParser(description="Benchmark the acquisition stack on mock / simulated backends.")
+    parser.add_argument("scenarios", nargs="*", metavar="scenario",
+                        help=f"Scenarios to run (default: all). Choices: {', '.join(SCENARIOS)}.")
+    parser.add_argument("--quick", action="store_true", help="Smaller sizes (smoke test).")
+    parser.add_argument("--backend", choices=("mock", "sim"), default="mock",
+                        help="step_scan backend: mock ports or simulated Performax / MCU devices.")
+    parser.add_argument("--param", action="append", default=[], metavar="KEY=VALUE",
+                        help="Scenario parameter (applied to every selected scenario that accepts it).")
+    parser.add_argument("--baseline", type=Path, default=DEFAULT_BASELINE, help="Baseline JSON file.")
+    parser.add_argument("--update-baseline", action="store_true", help="Store the results as the new baseline.")
+    parser.add_argument("--tolerance", type=float, default=DEFAULT_TOLERANCE,
+                        help="Allowed relative degradation before failing (default: 0.2).")
+    parser.add_argument("--in-process", action="store_true", help="Do not spawn a process per scenario.")
+    parser.add_argument("-o", "--output", type=Path, help="Also write the results as JSON.")
+    args = parser.parse_args(argv)
+    unknown = [name for name in args.scenarios if name not in SCENARIOS]
+    if unknown:
+        parser.error(f"unknown scenario(s): {', '.join(unknown)} (choices: {', '.join(SCENARIOS)})")
+
+    names = args.scenarios or list(SCENARIOS)
+    # Quick and full runs are not comparable: separate baselines
+    baseline_path = args.baseline.with_name(args.baseline.stem + "_quick" + args.baseline.suffix) if args.quick else args.baseline
+    baselines = load_baseline(baseline_path)
+    extra = _parse_params(args.param)
+
+    results: List[ScenarioResult] = []
+    regressions: List[Regression] = []
+    for name in names:
+        params = dict(QUICK_PARAMETERS.get(name, {})) if args.quick else {}
+        if name == "step_scan":
+            params["backend"] = args.backend
+        accepted = inspect.signature(SCENARIOS[name]).parameters
+        params.update({k: v for k, v in extra.items() if k in accepted})
+
+        print(f"[AcquisitionBenchmark] Running {name} {params or ''}".rstrip(), flush=True)
+        result = run_scenario(name, params) if args.in_process else run_isolated(name, params)
+        results.append(result)
+        baseline = baselines.get(name, {})
+        print(format_result(result, baseline), flush=True)
+        if not args.update_baseline:
+            regressions += compare(result, baseline, args.tolerance)
+
+    if args.output:
+        args.output.parent.mkdir(parents=True, exist_ok=True)
+        with args.output.open("w", encoding="utf-8") as f:
+            json.dump({r.name: {"metrics": {k: asdict(m) for k, m in r.metrics.items()}, "skipped": r.skipped}
+                       for r in results}, f, indent=2)
+
+    if args.update_baseline:
+        save_baseline(baseline_path, results, baselines)
+        print(f"[AcquisitionBenchmark] Baseline written: {baseline_path}")
+        return 0
+    if not baselines:
+        print(f"[AcquisitionBenchmark] No baseline at {baseline_path} (create one with --update-baseline)")
+        return 0
+    if regressions:
+        print(f"[AcquisitionBenchmark] {len(regressions)} regression(s) beyond {args.tolerance:.0%}:")
+        for regression in regressions:
+            print(f"  - {regression.describe()}")
+        return 1
+    print("[AcquisitionBenchmark] No regression against baseline.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
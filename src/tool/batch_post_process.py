@@ -0,0 +1,314 @@
+"""
+CLI tool to (re)process a campaign of step scans: raw_data scans -> processed_data HDF5.
+
+Usage:
+    python -m tool.batch_post_process [files ...] [-j N] [--force]
+        [--angles TX TY TZ | --no-rotation] [--reference ROW COL]
+        [--raw-dir DIR] [--out-dir DIR] [--compression 0-9]
+
+Responsibility:
+- Process every `*.aefscan` (binary, default export format) and `*.csv`
+  of the raw_data repository (or the given files), one scan per worker
+  process. When both exist for a stem (CSV converted from the binary
+  file), only the binary file is processed.
+- Write `<processed_dir>/<scan stem>.h5` in the layout of
+  `external_modules/post_processor_module` (groups `preprocessed`,
+  `phase_calibrated`, `amplitude_subtracted`, `rotated_frame`, each with a
+  `data` dataset and step metadata), plus `magnitude_phase`.
+- Skip the scans whose output is up to date.
+
+Design:
+- Kernels: tool/post_processing_kernels.py (whole-array numpy steps).
+- Up to date = the output's `content_sha256` attribute equals the SHA-256
+  of the raw file bytes + processing parameters + PIPELINE_VERSION. Timestamps
+  are not used: copying a campaign does not trigger a rerun, changing
+  the angles does.
+- Datasets are chunked and gzip-compressed with shuffle. Outputs are written
+  to a temporary file then renamed: an interrupted batch never leaves a file
+  that looks up to date.
+- Workers are spawned (same behaviour on Windows and Linux); failures are
+  reported per scan and do not stop the batch.
+"""
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import json
+import os
+import time
+from concurrent.futures import ProcessPoolExecutor, as_completed
+from dataclasses import asdict, dataclass
+from datetime import datetime
+from multiprocessing import get_context
+from pathlib import Path
+from typing import Dict, Iterable, List, Optional, Sequence, Tuple
+
+import h5py
+import numpy as np
+
+from tool.post_processing_kernels import (
+    MAGNITUDE_PHASE_NAMES,
+    build_grid,
+    SCAN_SUFFIXES,
+    calibrate_phase,
+    load_scan,
+    magnitude_phase,
+    rotate_frame,
+    rotation_matrix,
+    rotation_quaternion,
+    subtract_primary,
+)
+
+# Bump when a kernel change alters the outputs (forces a campaign rerun)
+PIPELINE_VERSION = 2
+# Bench sensor mounting (post_processor_module composition root)
+DEFAULT_ROTATION_ANGLES = (35.26, -45.00, -7.20)
+CHUNK_EDGE = 64  # Grid points per chunk side
+
+
+@dataclass(frozen=True)
+class BatchParameters:
+    rotation_angles: Optional[Tuple[float, float, float]] = DEFAULT_ROTATION_ANGLES  # None: no rotation
+    reference_point: Tuple[int, int] = (0, 0)  # (row, col) of the primary field reference
+    compression_level: int = 4
+
+    def fingerprint(self) -> str:
+        """Parameters that change the outputs (compression does not)."""
+        values = asdict(self)
+        values.pop("compression_level")
+        values["pipeline_version"] = PIPELINE_VERSION
+        return json.dumps(values, sort_keys=True)
+
+
+def discover_scans(raw_dir: Path) -> List[Path]:
+    """Raw scan files of `raw_dir`, one per stem (binary preferred over CSV), sorted by name."""
+    by_stem: Dict[str, Path] = {}
+    for suffix in reversed(SCAN_SUFFIXES):  # Preferred suffix last: it overwrites
+        for path in Path(raw_dir).glob(f"*{suffix}"):
+            by_stem[path.stem] = path
+    return [by_stem[stem] for stem in sorted(by_stem)]
+
+
+def content_key(scan_path: Path, parameters: BatchParameters) -> str:
+    """SHA-256 of the raw file content and of the processing parameters."""
+    digest = hashlib.sha256()
+    with open(scan_path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            digest.update(chunk)
+    digest.update(parameters.fingerprint().encode("utf-8"))
+    return digest.hexdigest()
+
+
+def is_up_to_date(output_path: Path, key: str) -> bool:
+    if not output_path.exists():
+        return False
+    try:
+        with h5py.File(output_path, "r") as f:
+            return f.attrs.get("content_sha256") == key
+    except OSError:
+        return False
+
+
+# ============================================================================
+# ONE SCAN (worker)
+# ============================================================================
+
+def process_scan(scan_path: Path, output_path: Path, parameters: BatchParameters, key: str) -> int:
+    """Run every step on one raw scan and write its HDF5; returns the number of points."""
+    x, y, values, level = load_scan(scan_path)
+    reference = parameters.reference_point
+
+    grid, grid_metadata = build_grid(x, y, values, level)
+    steps: List[Tuple[str, np.ndarray, Dict]] = [("preprocessed", grid, grid_metadata)]
+
+    calibrated, phase_angles = calibrate_phase(grid, reference)
+    steps.append(("phase_calibrated", calibrated, {"phase_angles": phase_angles, "reference_point": reference}))
+
+    subtracted, primary = subtract_primary(calibrated, reference)
+    steps.append(("amplitude_subtracted", subtracted, {"mean_amplitudes": primary}))
+
+    final_step, final = "amplitude_subtracted", subtracted
+    if parameters.rotation_angles is not None:
+        matrix = rotation_matrix(parameters.rotation_angles)
+        final_step, final = "rotated_frame", rotate_frame(subtracted, matrix)
+        steps.append((final_step, final, {
+            "rotation_angles": parameters.rotation_angles,
+            "quaternion": rotation_quaternion(parameters.rotation_angles),
+            "rotation_matrix": matrix,
+        }))
+
+    steps.append(("magnitude_phase", magnitude_phase(final), {
+        "source_step": final_step,
+        "channel_names": list(MAGNITUDE_PHASE_NAMES),
+        "phase_unit": "rad",
+    }))
+
+    write_processed_file(output_path, scan_path, steps, key, parameters.compression_level)
+    return len(x)
+
+
+def write_processed_file(
+    output_path: Path,
+    scan_path: Path,
+    steps: Sequence[Tuple[str, np.ndarray, Dict]],
+    key: str,
+    compression_level: int,
+) -> None:
+    output_path.parent.mkdir(parents=True, exist_ok=True)
+    tmp_path = output_path.with_name(output_path.name + ".tmp")
+    history = []
+    with h5py.File(tmp_path, "w") as f:
+        f.attrs["source_csv"] = str(scan_path)  # Attribute name of DataHandler, whatever the format
+        f.attrs["load_timestamp"] = datetime.now().isoformat()
+        for name, data, metadata in steps:
+            group = f.create_group(name)
+            group.create_dataset(
+                "data", data=data, chunks=_chunks(data.shape),
+                compression="gzip", compression_opts=compression_level, shuffle=True,
+            )
+            timestamp = datetime.now().isoformat()
+            group.attrs["timestamp"] = timestamp
+            group.attrs["step_name"] = name
+            group.attrs["data_shape"] = data.shape
+            group.attrs["data_dtype"] = str(data.dtype)
+            for attr, value in metadata.items():
+                group.attrs[attr] = _attribute(value)
+            history.append(f"{name} @ {timestamp}")
+        f.attrs["processing_history"] = history
+        f.attrs["pipeline_version"] = PIPELINE_VERSION
+        f.attrs["content_sha256"] = key  # Last: marks the file complete
+    os.replace(tmp_path, output_path)
+
+
+def _chunks(shape: Tuple[int, ...]) -> Tuple[int, ...]:
+    """Square tiles of whole pixels (all channels of a pixel in the same chunk)."""
+    return tuple(min(edge, CHUNK_EDGE) for edge in shape[:2]) + tuple(shape[2:])
+
+
+def _attribute(value):
+    """Attribute encoding of DataHandler.save_step: dicts and string lists as JSON, numbers as arrays."""
+    if isinstance(value, dict):
+        return json.dumps({k: _plain(v) for k, v in value.items()})
+    if isinstance(value, (list, tuple)) and value and isinstance(value[0], str):
+        return json.dumps(list(value))
+    if isinstance(value, (list, tuple, np.ndarray)):
+        return np.asarray(value)
+    if isinstance(value, np.generic):
+        return value.item()
+    return value
+
+
+def _plain(value):
+    if isinstance(value, np.ndarray):
+        return value.tolist()
+    if isinstance(value, np.generic):
+        return value.item()
+    if isinstance(value, tuple):
+        return [_plain(v) for v in value]
+    return value
+
+
+def _run_one(scan_path: str, output_path: str, parameters: BatchParameters, force: bool) -> Dict:
+    """Worker entry point: never raises, returns a result row."""
+    scan_file, output_file = Path(scan_path), Path(output_path)
+    start = time.perf_counter()
+    result = {"scan": scan_file.stem, "output": output_path}
+    try:
+        key = content_key(scan_file, parameters)
+        if not force and is_up_to_date(output_file, key):
+            result["status"] = "up_to_date"
+        else:
+            result["points"] = process_scan(scan_file, output_file, parameters, key)
+            result["status"] = "processed"
+    except Exception as e:
+        result["status"] = "failed"
+        result["error"] = f"{type(e).__name__}: {e}"
+    result["seconds"] = time.perf_counter() - start
+    return result
+
+
+# ============================================================================
+# BATCH
+# ============================================================================
+
+def run_batch(
+    scan_files: Iterable[Path],
+    output_dir: Path,
+    parameters: BatchParameters = BatchParameters(),
+    jobs: Optional[int] = None,
+    force: bool = False,
+) -> List[Dict]:
+    """
+    Process `scan_files` (.aefscan or .csv) into `output_dir` on `jobs` processes
+    (default: all cores, 1 = in this process). Results are returned in completion order.
+    """
+    tasks = [(str(path), str(Path(output_dir) / f"{Path(path).stem}.h5")) for path in scan_files]
+    jobs = min(jobs or os.cpu_count() or 1, max(1, len(tasks)))
+    results = []
+    if jobs == 1:
+        for scan_path, output_path in tasks:
+            results.append(_report(_run_one(scan_path, output_path, parameters, force)))
+        return results
+
+    with ProcessPoolExecutor(max_workers=jobs, mp_context=get_context("spawn")) as pool:
+        futures = [pool.submit(_run_one, scan_path, output_path, parameters, force) for scan_path, output_path in tasks]
+        for future in as_completed(futures):
+            results.append(_report(future.result()))
+    return results
+
+
+def _report(result: Dict) -> Dict:
+    status = result["status"]
+    if status == "processed":
+        print(f"  processed  {result['scan']} ({result['points']} points, {result['seconds']:.2f} s)")
+    elif status == "failed":
+        print(f"  FAILED     {result['scan']}: {result['error']}")
+    else:
+        print(f"  up to date {result['scan']}")
+    return result
+
+
+def main() -> None:
+    # Project root = parent of "src" directory (this file is under src/tool/)
+    scans_dir = Path(__file__).resolve().parents[2] / ".aefi_acquisition" / "scans"
+
+    parser = argparse.ArgumentParser(description="Batch post-processing of step scans (.aefscan / CSV -> HDF5).")
+    parser.add_argument("files", nargs="*",
+                        help="Scan files (default: every *.aefscan and *.csv of --raw-dir).")
+    parser.add_argument("--raw-dir", default=str(scans_dir / "raw_data"))
+    parser.add_argument("--out-dir", default=str(scans_dir / "processed_data"))
+    parser.add_argument("-j", "--jobs", type=int, default=None, help="Worker processes (default: all cores).")
+    parser.add_argument("--force", action="store_true", help="Reprocess up-to-date scans.")
+    rotation = parser.add_mutually_exclusive_group()
+    rotation.add_argument("--angles", type=float, nargs=3, metavar=("TX", "TY", "TZ"),
+                          default=DEFAULT_ROTATION_ANGLES, help="Sensor -> EF sources rotation (degrees).")
+    rotation.add_argument("--no-rotation", action="store_true", help="Skip the rotated_frame step.")
+    parser.add_argument("--reference", type=int, nargs=2, metavar=("ROW", "COL"), default=(0, 0),
+                        help="Grid point of the primary field reference.")
+    parser.add_argument("--compression", type=int, default=4, choices=range(10), metavar="0-9",
+                        help="gzip level of the datasets.")
+    args = parser.parse_args()
+
+    scan_files = [Path(p) for p in args.files] or discover_scans(Path(args.raw_dir))
+    if not scan_files:
+        print(f"No scan file (*.aefscan, *.csv) found in {args.raw_dir}")
+        return
+    parameters = BatchParameters(
+        rotation_angles=None if args.no_rotation else tuple(args.angles),
+        reference_point=tuple(args.reference),
+        compression_level=args.compression,
+    )
+
+    print(f"Post-processing {len(scan_files)} scan(s) -> {args.out_dir}")
+    start = time.perf_counter()
+    results = run_batch(scan_files, Path(args.out_dir), parameters, jobs=args.jobs, force=args.force)
+    counts = {status: sum(r["status"] == status for r in results) for status in ("processed", "up_to_date", "failed")}
+    print(f"Done in {time.perf_counter() - start:.2f} s: {counts['processed']} processed, "
+          f"{counts['up_to_date']} up to date, {counts['failed']} failed")
+    if counts["failed"]:
+        raise SystemExit(1)
+
+
+if __name__ == "__main__":
+    main()
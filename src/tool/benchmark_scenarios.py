@@ -0,0 +1,633 @@
+"""
+Benchmark scenarios run by `tool.acquisition_benchmark`.
+
+Responsibility:
+- Drive the real application stack (ScanApplicationService, StepScanExecutor,
+  ScanExportService, ContinuousAcquisitionExecutor, event buses, signal
+  processing) on mock or simulated backends, and measure it.
+- Each scenario returns a ScenarioResult: named metrics, each with the
+  direction that counts as better, so a baseline can be compared.
+
+Design:
+- Instrumentation by proxies at the port boundaries (motion, acquisition,
+  export): the services and the executor are not modified.
+- PointTimeline splits every scan point into move (move command -> arrival),
+  settle (arrival -> first sample, includes the stabilization delay and the
+  executor's wait loop), acquire (first -> last sample) and export
+  (write_row of the point, on the pipeline stage when pipelined).
+- Optional dependencies (numpy, h5py, scipy) only remove the metrics that
+  need them; the reason is reported in ScenarioResult.skipped.
+"""
+
+from __future__ import annotations
+
+import math
+import os
+import sys
+import tempfile
+import threading
+import time
+from dataclasses import dataclass, field
+from typing import Any, Callable, Dict, List, Optional, Sequence
+
+
+# ============================================================================
+# RESULTS
+# ============================================================================
+
+@dataclass(frozen=True)
+class Metric:
+    """
+    One measured value.
+
+    - better: "higher", "lower" or None (reported, never compared).
+    - floor: absolute change ignored by the baseline comparison (noise of
+      very small timings), same unit as value.
+    """
+    value: float
+    unit: str
+    better: Optional[str] = None
+    floor: float = 0.0
+
+
+@dataclass
+class ScenarioResult:
+    name: str
+    metrics: Dict[str, Metric] = field(default_factory=dict)
+    skipped: List[str] = field(default_factory=list)  # Parts not run, with reason
+
+    def add(self, key: str, value: float, unit: str, better: Optional[str] = None, floor: float = 0.0) -> None:
+        self.metrics[key] = Metric(float(value), unit, better, floor)
+
+    def add_latency(self, stage: str, durations_s: Sequence[float], floor_ms: float = 0.05) -> None:
+        """p50 / p99 / max of a list of durations, in ms (lower is better)."""
+        if not durations_s:
+            return
+        self.add(f"{stage}_p50_ms", percentile(durations_s, 50) * 1e3, "ms", "lower", floor_ms)
+        self.add(f"{stage}_p99_ms", percentile(durations_s, 99) * 1e3, "ms", "lower", floor_ms)
+        self.add(f"{stage}_max_ms", max(durations_s) * 1e3, "ms")
+
+
+def percentile(values: Sequence[float], q: float) -> float:
+    """q-th percentile (0-100), linear interpolation between closest ranks."""
+    ordered = sorted(values)
+    if not ordered:
+        raise ValueError("percentile of an empty sequence")
+    rank = (len(ordered) - 1) * q / 100.0
+    low = math.floor(rank)
+    high = min(low + 1, len(ordered) - 1)
+    return ordered[low] + (ordered[high] - ordered[low]) * (rank - low)
+
+
+# ============================================================================
+# INSTRUMENTATION
+# ============================================================================
+
+class PointTimeline:
+    """
+    Per-point move / settle / acquire durations from hook timestamps.
+
+    Hooks: move_started() when a move is commanded (move_to, or release of
+    the previous point of a planned trajectory), arrived() when the stage
+    reports the point, sample(t0, t1) around every acquire_sample().
+    A point is closed by the next move_started() or by finish().
+    """
+
+    def __init__(self, clock: Callable[[], float] = time.perf_counter):
+        self._clock = clock
+        self._lock = threading.Lock()
+        self.move: List[float] = []
+        self.settle: List[float] = []
+        self.acquire: List[float] = []
+        self.point: List[float] = []
+        self.export: List[float] = []
+        self.samples = 0
+        self._move_start: Optional[float] = None
+        self._arrival: Optional[float] = None
+        self._first: Optional[float] = None
+        self._last: Optional[float] = None
+
+    def move_started(self) -> None:
+        now = self._clock()
+        with self._lock:
+            self._close()
+            self._move_start = now
+
+    def arrived(self) -> None:
+        now = self._clock()
+        with self._lock:
+            if self._arrival is None:
+                self._arrival = now
+
+    def sample(self, t0: float, t1: float) -> None:
+        with self._lock:
+            self.samples += 1
+            if self._arrival is None:
+                return  # Not inside a point (e.g. warm-up read)
+            if self._first is None:
+                self._first = t0
+            self._last = t1
+
+    def exported(self, duration_s: float) -> None:
+        with self._lock:
+            self.export.append(duration_s)
+
+    def finish(self) -> None:
+        with self._lock:
+            self._close()
+
+    def _close(self) -> None:
+        if self._move_start is None or self._arrival is None or self._first is None:
+            self._arrival = self._first = self._last = None
+            return
+        self.move.append(self._arrival - self._move_start)
+        self.settle.append(self._first - self._arrival)
+        self.acquire.append(self._last - self._first)
+        self.point.append(self._last - self._move_start)
+        self._arrival = self._first = self._last = None
+
+
+class _TimedRun:
+    """IPlannedTrajectoryRun proxy: arrival and release hooks."""
+
+    def __init__(self, run, timeline: PointTimeline):
+        self._run = run
+        self._timeline = timeline
+
+    def wait_for_arrival(self, timeout: float):
+        arrival = self._run.wait_for_arrival(timeout)
+        if arrival is not None:
+            self._timeline.arrived()
+        return arrival
+
+    def release(self) -> None:
+        self._timeline.move_started()
+        self._run.release()
+
+    def __getattr__(self, name):
+        return getattr(self._run, name)
+
+
+class TimedMotionPort:
+    """IMotionPort proxy feeding a PointTimeline (arrival of point-by-point moves comes from MotionCompleted)."""
+
+    def __init__(self, port, timeline: PointTimeline):
+        self._port = port
+        self._timeline = timeline
+
+    def move_to(self, position):
+        self._timeline.move_started()
+        return self._port.move_to(position)
+
+    def start_planned_trajectory(self, points, on_arrived=None):
+        self._timeline.move_started()
+        return _TimedRun(self._port.start_planned_trajectory(points, on_arrived), self._timeline)
+
+    def __getattr__(self, name):
+        return getattr(self._port, name)
+
+
+class TimedAcquisitionPort:
+    """IAcquisitionPort proxy timing every acquire_sample()."""
+
+    def __init__(self, port, timeline: PointTimeline):
+        self._port = port
+        self._timeline = timeline
+
+    def acquire_sample(self):
+        t0 = time.perf_counter()
+        sample = self._port.acquire_sample()
+        self._timeline.sample(t0, time.perf_counter())
+        return sample
+
+    def __getattr__(self, name):
+        return getattr(self._port, name)
+
+
+class TimedExportPort:
+    """IScanExportPort proxy timing every write_row()."""
+
+    def __init__(self, port, on_row: Callable[[float], None]):
+        self._port = port
+        self._on_row = on_row
+
+    def write_row(self, row) -> None:
+        t0 = time.perf_counter()
+        self._port.write_row(row)
+        self._on_row(time.perf_counter() - t0)
+
+    def __getattr__(self, name):
+        return getattr(self._port, name)
+
+
+# ============================================================================
+# BACKENDS
+# ============================================================================
+
+class _Backend:
+    """Motion and acquisition ports of a scenario, with their lifecycle."""
+
+    def __init__(self, motion, acquisition, lifecycles=()):
+        self.motion = motion
+        self.acquisition = acquisition
+        self._lifecycles = list(lifecycles)
+
+    def close(self) -> None:
+        for lifecycle in self._lifecycles:
+            lifecycle.close_all()
+
+
+def _make_backend(kind: str, event_bus, planned: bool, motion_delay_ms: float) -> _Backend:
+    """
+    - mock: MockMotionPort (motion_delay_ms per point) + RandomNoiseAcquisitionPort.
+    - sim: ArcusCompositionRoot on SimulatedPerformaxLib + MCUCompositionRoot
+      on SimulatedMcuSerial (ADS131 adapter: needs numpy).
+    """
+    if kind == "mock":
+        from infrastructure.mocks.adapter_mock_i_acquisition_port import RandomNoiseAcquisitionPort
+        from infrastructure.mocks.adapter_mock_i_motion_port import MockMotionPort
+
+        motion = MockMotionPort(event_bus=event_bus, motion_delay_ms=motion_delay_ms, planned_trajectory=planned)
+        return _Backend(motion, RandomNoiseAcquisitionPort(noise_std=0.01, seed=0))
+
+    if kind == "sim":
+        # pyserial is not needed behind the simulated port
+        import types
+        sys.modules.setdefault("serial", types.ModuleType("serial"))
+        from infrastructure.hardware.arcus_performax_4EX.composition_root_arcus import ArcusCompositionRoot
+        from infrastructure.hardware.micro_controller.mcu_composition_root import MCUCompositionRoot
+        from infrastructure.hardware.simulation.simulated_mcu_serial import SimulatedMcuSerial
+        from infrastructure.hardware.simulation.simulated_performax_lib import SimulatedPerformaxLib
+        from infrastructure.hardware.simulation.simulation_profile import SimulationProfile
+
+        profile = SimulationProfile(sample_rate_hz=4000.0, latency_s=0.0005, jitter_s=0.0005, seed=0)
+        arcus_root = ArcusCompositionRoot(event_bus=event_bus, backend="native",
+                                          performax_lib=SimulatedPerformaxLib(profile=profile))
+        mcu_root = MCUCompositionRoot(event_bus=event_bus, serial_factory=SimulatedMcuSerial.factory(profile=profile))
+        arcus_root.lifecycle.initialize_all()
+        mcu_root.lifecycle.initialize_all()
+        return _Backend(arcus_root.motion, mcu_root.acquisition, [mcu_root.lifecycle, arcus_root.lifecycle])
+
+    raise ValueError(f"Unknown backend '{kind}' (expected 'mock' or 'sim')")
+
+
+def _missing(module: str) -> Optional[str]:
+    """Reason string if `module` cannot be imported, else None."""
+    try:
+        __import__(module)
+    except ImportError as exc:
+        return f"{module} not available ({exc})"
+    return None
+
+
+def _measurement(i: int):
+    from domain.value_objects.acquisition.voltage_measurement import VoltageMeasurement
+    from datetime import datetime
+
+    v = 1e-3 * (i % 97)
+    return VoltageMeasurement(
+        voltage_x_in_phase=v, voltage_x_quadrature=-v, voltage_y_in_phase=2 * v,
+        voltage_y_quadrature=0.5 * v, voltage_z_in_phase=-2 * v, voltage_z_quadrature=v,
+        timestamp=datetime.now(),
+    )
+
+
+# ============================================================================
+# SCENARIOS
+# ============================================================================
+
+def step_scan(
+    points: int = 6400,
+    averaging: int = 10,
+    backend: str = "mock",
+    planned: bool = True,
+    pipelined: bool = True,
+    motion_delay_ms: float = 0.0,
+    stabilization_delay_ms: int = 0,
+    export_format: str = "BINARY",
+    pitch_mm: float = 0.5,
+) -> ScenarioResult:
+    """
+    Full step scan through ScanApplicationService with export enabled.
+
+    The grid is the largest square with at most `points` points.
+    """
+    from application.dtos.scan_dtos import ExportConfigDTO, Scan2DConfigDTO
+    from application.services.scan_application_service.scan_application_service import ScanApplicationService
+    from application.services.scan_application_service.scan_export_service import ScanExportService
+    from domain.events.event_topics import MOTION_COMPLETED, SCAN_CANCELLED, SCAN_COMPLETED, SCAN_FAILED
+    from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+    from infrastructure.execution.step_scan_executor import StepScanExecutor
+    from infrastructure.persistence.binary_scan_export_port import BinaryScanExportPort
+    from infrastructure.persistence.csv_scan_export_port import CsvScanExportPort
+
+    result = ScenarioResult("step_scan")
+    export_format = export_format.upper()
+    hdf5_port = None
+    if export_format == "HDF5":
+        reason = _missing("h5py") or _missing("numpy")
+        if reason:
+            result.skipped.append(f"hdf5 export: {reason}")
+            return result
+        from infrastructure.persistence.hdf5_scan_export_port import Hdf5ScanExportPort
+        hdf5_port = Hdf5ScanExportPort()
+    if backend == "sim":
+        reason = _missing("numpy")
+        if reason:
+            result.skipped.append(f"sim backend (ADS131 adapter): {reason}")
+            return result
+
+    side = max(2, math.isqrt(points))
+    timeline = PointTimeline()
+    event_bus = InMemoryEventBus()
+    hw = _make_backend(backend, event_bus, planned, motion_delay_ms)
+    try:
+        motion = TimedMotionPort(hw.motion, timeline)
+        acquisition = TimedAcquisitionPort(hw.acquisition, timeline)
+        executor = StepScanExecutor(motion, acquisition, event_bus, use_planned_trajectory=planned, pipelined=pipelined)
+        service = ScanApplicationService(motion, acquisition, event_bus, executor)
+        export = ScanExportService(
+            event_bus,
+            csv_export_port=TimedExportPort(CsvScanExportPort(), timeline.exported),
+            hdf5_export_port=TimedExportPort(hdf5_port, timeline.exported) if hdf5_port else None,
+            binary_export_port=TimedExportPort(BinaryScanExportPort(), timeline.exported),
+        )
+        if not planned:
+            event_bus.subscribe(MOTION_COMPLETED, lambda _event: timeline.arrived())
+
+        done = threading.Event()
+        outcome: Dict[str, Any] = {}
+
+        def _on_finished(event) -> None:
+            outcome["event"] = type(event).__name__
+            done.set()
+
+        # Subscribed after ScanExportService: the export file is closed when this runs
+        for topic in (SCAN_COMPLETED, SCAN_FAILED, SCAN_CANCELLED):
+            event_bus.subscribe(topic, _on_finished)
+
+        with tempfile.TemporaryDirectory(prefix="aefi_bench_") as output_dir:
+            export.configure_export(ExportConfigDTO(
+                enabled=True, output_directory=output_dir, filename_base="benchmark", format=export_format))
+            scan_dto = Scan2DConfigDTO(
+                x_min=0.0, x_max=(side - 1) * pitch_mm, y_min=0.0, y_max=(side - 1) * pitch_mm,
+                x_nb_points=side, y_nb_points=side, scan_pattern="SERPENTINE",
+                stabilization_delay_ms=stabilization_delay_ms, averaging_per_position=averaging,
+                uncertainty_volts=1e-3,
+            )
+            t0 = time.perf_counter()
+            if not service.execute_scan(scan_dto):
+                raise RuntimeError("step scan did not start")
+            done.wait()
+            elapsed = time.perf_counter() - t0
+            timeline.finish()
+            export_bytes = sum(
+                os.path.getsize(os.path.join(root, name))
+                for root, _dirs, names in os.walk(output_dir) for name in names
+            )
+    finally:
+        hw.close()
+
+    if outcome.get("event") != "ScanCompleted":
+        raise RuntimeError(f"step scan ended with {outcome.get('event')}")
+
+    n_points = side * side
+    result.add("points", n_points, "points")
+    result.add("samples", timeline.samples, "samples")
+    result.add("export_kb", export_bytes / 1024.0, "kB")
+    result.add("elapsed_s", elapsed, "s")
+    result.add("points_per_s", n_points / elapsed, "points/s", "higher")
+    result.add("samples_per_s", timeline.samples / elapsed, "samples/s", "higher")
+    for stage in ("move", "settle", "acquire", "export", "point"):
+        result.add_latency(stage, getattr(timeline, stage))
+    return result
+
+
+def continuous_acquisition(
+    duration_s: float = 600.0,
+    sample_rate_hz: float = 1000.0,
+    drain_period_s: float = 0.05,
+) -> ScenarioResult:
+    """
+    ContinuousAcquisitionService on ContinuousAcquisitionExecutor (deadline
+    pacing) and RandomNoiseAcquisitionPort, drained like the UI does.
+
+    Long runs expose buffer growth: compare peak RSS with the short run.
+    """
+    result = ScenarioResult("continuous_acquisition")
+    reason = _missing("numpy")
+    if reason:
+        result.skipped.append(f"ContinuousSampleBuffer: {reason}")
+        return result
+
+    from application.services.continuous_acquisition_service.continuous_acquisition_service import (
+        ContinuousAcquisitionService,
+    )
+    from application.services.continuous_acquisition_service.dtos.continuous_acquisition_dtos import (
+        ContinuousAcquisitionConfig,
+    )
+    from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+    from infrastructure.execution.continuous_acquisition_executor import ContinuousAcquisitionExecutor
+    from infrastructure.mocks.adapter_mock_i_acquisition_port import RandomNoiseAcquisitionPort
+
+    executor = ContinuousAcquisitionExecutor(InMemoryEventBus())
+    service = ContinuousAcquisitionService(executor, RandomNoiseAcquisitionPort(noise_std=0.01, seed=0))
+
+    received = 0
+    drain_latency: List[float] = []
+    t0 = time.perf_counter()
+    service.start_acquisition(ContinuousAcquisitionConfig(sample_rate_hz=sample_rate_hz, max_duration_s=duration_s))
+    try:
+        while time.perf_counter() - t0 < duration_s:
+            time.sleep(drain_period_s)
+            d0 = time.perf_counter()
+            received += len(service.drain_samples())
+            drain_latency.append(time.perf_counter() - d0)
+    finally:
+        service.stop_acquisition()
+    received += len(service.drain_samples())
+    elapsed = time.perf_counter() - t0
+
+    result.add("duration_s", elapsed, "s")
+    result.add("samples", received, "samples")
+    result.add("samples_per_s", received / elapsed, "samples/s", "higher")
+    result.add("sample_overruns", service.get_sample_overruns(), "samples")
+    result.add_latency("drain", drain_latency)
+    stats = service.get_timing_stats()
+    if stats is not None:
+        result.add("achieved_rate_hz", stats.achieved_rate_hz, "Hz", "higher")
+        result.add("skipped_ticks", stats.skipped_ticks, "ticks")
+        result.add("jitter_mean_us", stats.jitter_mean_us, "us", "lower", 50.0)
+        result.add("jitter_max_us", stats.jitter_max_us, "us")
+    return result
+
+
+def export(rows: int = 100_000, formats: Sequence[str] = ("CSV", "BINARY", "HDF5")) -> ScenarioResult:
+    """write_row throughput and latency of each scan export port, N rows."""
+    from application.services.scan_application_service.i_scan_export_port import ScanPointRow
+    from infrastructure.persistence.binary_scan_export_port import BinaryScanExportPort
+    from infrastructure.persistence.csv_scan_export_port import CsvScanExportPort
+
+    result = ScenarioResult("export")
+    ports: Dict[str, Callable[[], Any]] = {"CSV": CsvScanExportPort, "BINARY": BinaryScanExportPort}
+    reason = _missing("h5py") or _missing("numpy")
+    if reason is None:
+        from infrastructure.persistence.hdf5_scan_export_port import Hdf5ScanExportPort
+        ports["HDF5"] = Hdf5ScanExportPort
+
+    row_data = [
+        ScanPointRow(
+            scan_id="benchmark", point_index=i, x=0.5 * (i % 80), y=0.5 * (i // 80),
+            voltages=tuple(1e-3 * ((i + k) % 97) for k in range(6)),
+            std_devs=tuple(1e-5 * (k + 1) for k in range(6)), sample_count=10,
+        )
+        for i in range(rows)
+    ]
+    with tempfile.TemporaryDirectory(prefix="aefi_bench_") as output_dir:
+        for fmt in formats:
+            fmt = fmt.upper()
+            if fmt not in ports:
+                result.skipped.append(f"{fmt.lower()} export: {reason or 'unknown format'}")
+                continue
+            port = ports[fmt]()
+            port.configure(output_dir, f"benchmark_{fmt.lower()}", {"scan_id": "benchmark"})
+            write_latency = []
+            t0 = time.perf_counter()
+            port.start()
+            for row in row_data:
+                w0 = time.perf_counter()
+                port.write_row(row)
+                write_latency.append(time.perf_counter() - w0)
+            port.stop()
+            elapsed = time.perf_counter() - t0
+
+            name = fmt.lower()
+            result.add(f"{name}_rows_per_s", rows / elapsed, "rows/s", "higher")
+            result.add(f"{name}_write_row_p50_us", percentile(write_latency, 50) * 1e6, "us", "lower", 2.0)
+            result.add(f"{name}_write_row_p99_us", percentile(write_latency, 99) * 1e6, "us", "lower", 5.0)
+    return result
+
+
+def signal_processing(samples: int = 50_000) -> ScenarioResult:
+    """
+    Per-sample cost of the display chain: SignalPostProcessor (all corrections
+    enabled) then TransformationService (sensor -> source rotation).
+    """
+    from interface.presenters.signal_processor import AXES, SignalPostProcessor
+
+    result = ScenarioResult("signal_processing")
+    processor = SignalPostProcessor()
+    state = processor.state
+    for k, axis in enumerate(AXES):
+        state.noise_offset[axis] = (1e-4 * (k + 1), -1e-4)
+        state.phase_angles[axis] = 0.1 * (k + 1)
+        state.primary_offset[axis] = (1e-3, 2e-3)
+    state.noise_correction_enabled = state.phase_correction_enabled = state.primary_correction_enabled = True
+
+    raw = [
+        {f"{axis} {part}": 1e-3 * ((i + 2 * k + p) % 97 - 48) for k, axis in enumerate(AXES)
+         for p, part in enumerate(("In-Phase", "Quadrature"))}
+        for i in range(min(samples, 4096))
+    ]
+    t0 = time.perf_counter()
+    for i in range(samples):
+        processed = processor.process_sample(raw[i % len(raw)])
+    per_sample = (time.perf_counter() - t0) / samples
+    result.add("post_processor_us", per_sample * 1e6, "us/sample", "lower", 0.5)
+    result.add("post_processor_samples_per_s", 1.0 / per_sample, "samples/s", "higher")
+
+    reason = _missing("numpy")
+    if reason:
+        result.skipped.append(f"process_block: {reason}")
+    else:
+        import numpy as np
+        block = np.array([[s[f"{a} {p}"] for a in AXES for p in ("In-Phase", "Quadrature")] for s in raw])
+        repeat = max(1, samples // len(block))
+        t0 = time.perf_counter()
+        for _ in range(repeat):
+            processor.process_block(block)
+        result.add("post_processor_block_us", (time.perf_counter() - t0) / (repeat * len(block)) * 1e6,
+                   "us/sample", "lower", 0.05)
+
+    reason = _missing("scipy") or _missing("numpy")
+    if reason:
+        result.skipped.append(f"TransformationService: {reason}")
+        return result
+    from application.services.transformation_service.transformation_service import TransformationService
+
+    transformation = TransformationService()
+    transformation.set_rotation_angles(10.0, 20.0, 30.0)
+    transformation.set_enabled(True)
+    vectors = [(s["Ux In-Phase"], s["Uy In-Phase"], s["Uz In-Phase"]) for s in raw]
+    t0 = time.perf_counter()
+    for i in range(samples):
+        transformation.transform_sensor_to_source(vectors[i % len(vectors)])
+    transform_s = (time.perf_counter() - t0) / samples
+    result.add("transformation_us", transform_s * 1e6, "us/sample", "lower", 0.5)
+    result.add("chain_us", (per_sample + 2 * transform_s) * 1e6, "us/sample", "lower", 1.0)  # I and Q vectors
+    return result
+
+
+def event_fanout(events: int = 20_000, subscriber_counts: Sequence[int] = (1, 8, 32)) -> ScenarioResult:
+    """
+    publish() cost and end-to-end delivery rate for N subscribers of one topic,
+    on InMemoryEventBus (synchronous) and AsyncEventBus (one queue per subscriber).
+    """
+    from domain.events.event_topics import SCAN_POINT_ACQUIRED
+    from infrastructure.events.async_event_bus import AsyncEventBus, BackpressurePolicy, SubscriptionOptions
+    from infrastructure.events.in_memory_event_bus import InMemoryEventBus
+
+    result = ScenarioResult("event_fanout")
+    payload = _measurement(1)
+
+    for n in subscriber_counts:
+        counter = [0] * n
+        handlers = [(lambda k: (lambda _event: counter.__setitem__(k, counter[k] + 1)))(k) for k in range(n)]
+
+        bus = InMemoryEventBus()
+        for handler in handlers:
+            bus.subscribe(SCAN_POINT_ACQUIRED, handler)
+        t0 = time.perf_counter()
+        for _ in range(events):
+            bus.publish(SCAN_POINT_ACQUIRED, payload)
+        elapsed = time.perf_counter() - t0
+        result.add(f"in_memory_{n}subs_publish_us", elapsed / events * 1e6, "us/event", "lower", 0.5)
+        result.add(f"in_memory_{n}subs_deliveries_per_s", sum(counter) / elapsed, "deliveries/s", "higher")
+
+        counter[:] = [0] * n
+        # BLOCK: nothing is dropped, so every subscriber sees every event
+        bus = AsyncEventBus(default_options=SubscriptionOptions(capacity=4096, policy=BackpressurePolicy.BLOCK))
+        try:
+            for handler in handlers:
+                bus.subscribe(SCAN_POINT_ACQUIRED, handler)
+            t0 = time.perf_counter()
+            for _ in range(events):
+                bus.publish(SCAN_POINT_ACQUIRED, payload)
+            publish_s = time.perf_counter() - t0
+            bus.flush(timeout=60.0)
+            elapsed = time.perf_counter() - t0
+        finally:
+            bus.shutdown()
+        if sum(counter) != n * events:
+            raise RuntimeError(f"AsyncEventBus delivered {sum(counter)} of {n * events} events")
+        result.add(f"async_{n}subs_publish_us", publish_s / events * 1e6, "us/event", "lower", 1.0)
+        result.add(f"async_{n}subs_deliveries_per_s", sum(counter) / elapsed, "deliveries/s", "higher")
+    return result
+
+
+SCENARIOS: Dict[str, Callable[..., ScenarioResult]] = {
+    "step_scan": step_scan,
+    "continuous_acquisition": continuous_acquisition,
+    "export": export,
+    "signal_processing": signal_processing,
+    "event_fanout": event_fanout,
+}
+
+# Parameters of --quick runs (smoke test / CI): same code paths, smaller sizes
+QUICK_PARAMETERS: Dict[str, Dict[str, Any]] = {
+    "step_scan": {"points": 400, "averaging": 4},
+    "continuous_acquisition": {"duration_s": 5.0},
+    "export": {"rows": 5_000},
+    "signal_processing": {"samples": 5_000},
+    "event_fanout": {"events": 2_000},
+}
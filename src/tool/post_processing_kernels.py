@@ -0,0 +1,339 @@
+"""
+Vectorized kernels of the scan post-processing (raw_data scan -> processed_data HDF5).
+
+Responsibility:
+- Load the voltage columns (and resolution level) of a raw scan once, into
+  contiguous arrays: binary `.aefscan` (memory-mapped, the default export
+  format) or CSV.
+- Same steps and conventions as `external_modules/post_processor_module`:
+  square NaN-padded grid, phase calibration on a reference point (Q = 0,
+  sign of I kept), primary field subtraction, sensor -> EF sources rotation
+  (intrinsic 'XYZ' Euler angles, as TransformationService).
+- Derived magnitude / phase maps per axis.
+
+Design:
+- Grids are (H, W, 6) float64 in CSV channel order [Ux I, Ux Q, Uy I, Uy Q, Uz I, Uz Q].
+- Multi-resolution scans (points with level > 0) are resampled onto the
+  finest lattice: a level-L point fills the subdivision**(levels - L) block
+  centred on it (as the live scan map), coordinates off that lattice are
+  rejected.
+- Every step works on whole channel planes: no per-row or per-pixel Python
+  loop (the grid is filled with one fancy-index assignment, one per block
+  offset and level for refined scans; the rotation is one matmul over the I
+  triples and one over the Q triples).
+- Pure functions, no I/O besides the `load_scan*` loaders: usable from worker processes.
+"""
+
+from __future__ import annotations
+
+import math
+from pathlib import Path
+from typing import Dict, Optional, Tuple
+
+import numpy as np
+
+from infrastructure.persistence import binary_scan_export_port
+
+CHANNEL_NAMES = (
+    "voltage_x_in_phase", "voltage_x_quadrature",
+    "voltage_y_in_phase", "voltage_y_quadrature",
+    "voltage_z_in_phase", "voltage_z_quadrature",
+)
+MAGNITUDE_PHASE_NAMES = (
+    "magnitude_x", "phase_x",
+    "magnitude_y", "phase_y",
+    "magnitude_z", "phase_z",
+)
+AXES = ("x", "y", "z")
+_I = np.array([0, 2, 4])
+_Q = np.array([1, 3, 5])
+SCAN_SUFFIXES = (binary_scan_export_port.FILE_EXTENSION, ".csv")  # Preference order for a same stem
+
+
+def load_scan(path: Path) -> Tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+    """Dispatch on the file extension: `.aefscan` -> load_scan_binary, anything else -> load_scan_csv."""
+    if Path(path).suffix == binary_scan_export_port.FILE_EXTENSION:
+        return load_scan_binary(path)
+    return load_scan_csv(path)
+
+
+def load_scan_binary(path: Path) -> Tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+    """
+    Read x, y, the six voltage columns and the level of a BinaryScanExportPort file.
+
+    The rows are memory-mapped (no parsing); only the used columns are copied.
+
+    Returns:
+        (x (n,), y (n,), values (n, 6), level (n,)), C-contiguous; level is
+        0 for files written before the level column existed.
+    """
+    _metadata, rows = binary_scan_export_port.open_memmap(path)
+    if rows.shape[0] == 0:
+        raise ValueError(f"{Path(path).name}: no data points")
+    names = binary_scan_export_port.COLUMN_NAMES
+    channels = [names.index(name) for name in CHANNEL_NAMES]
+    level_column = names.index("level")
+    if rows.shape[1] > level_column:
+        level = np.nan_to_num(rows[:, level_column]).astype(np.int64)
+    else:
+        level = np.zeros(rows.shape[0], dtype=np.int64)
+    return (
+        np.ascontiguousarray(rows[:, names.index("x")], dtype=np.float64),
+        np.ascontiguousarray(rows[:, names.index("y")], dtype=np.float64),
+        np.ascontiguousarray(rows[:, channels], dtype=np.float64),
+        level,
+    )
+
+
+def load_scan_csv(path: Path) -> Tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+    """
+    Read x, y, the six voltage columns and the level of a CsvScanExportPort file.
+
+    Returns:
+        (x (n,), y (n,), values (n, 6), level (n,)), C-contiguous; level is
+        0 when the file has no level column.
+    """
+    with open(path, "r", encoding="utf-8") as f:
+        header = f.readline().strip().split(",")
+        has_rows = bool(f.readline().strip())
+    missing = [name for name in ("x", "y") + CHANNEL_NAMES if name not in header]
+    if missing:
+        raise ValueError(f"{Path(path).name}: missing columns {missing}")
+    if not has_rows:
+        raise ValueError(f"{Path(path).name}: no data points")
+
+    names = ("x", "y") + CHANNEL_NAMES + (("level",) if "level" in header else ())
+    columns = [header.index(name) for name in names]
+    table = np.loadtxt(path, delimiter=",", skiprows=1, usecols=columns, dtype=np.float64, ndmin=2)
+    n_values = 2 + len(CHANNEL_NAMES)
+    if table.shape[1] > n_values:
+        level = table[:, n_values].astype(np.int64)
+    else:
+        level = np.zeros(table.shape[0], dtype=np.int64)
+    return (
+        np.ascontiguousarray(table[:, 0]),
+        np.ascontiguousarray(table[:, 1]),
+        np.ascontiguousarray(table[:, 2:n_values]),
+        level,
+    )
+
+
+def build_grid(
+    x: np.ndarray,
+    y: np.ndarray,
+    values: np.ndarray,
+    level: Optional[np.ndarray] = None,
+    grid_size: Optional[int] = None,
+) -> Tuple[np.ndarray, Dict]:
+    """
+    Square grid (N, N, C), N = max(nx, ny), NaN where no point was measured.
+
+    With refined points (level > 0), nx / ny are those of the finest lattice
+    (see _refined_layout).
+
+    Returns:
+        (grid, metadata) with the keys of DataPreProcessor.create_square_grid.
+
+    Raises:
+        ValueError: If refined points are not on the lattice of the coarse grid.
+    """
+    refined = level is not None and bool(np.any(level > 0))
+    if refined:
+        x_coords, y_coords, x_step, y_step, subdivision, levels = _refined_layout(x, y, level)
+        n_x, n_y = len(x_coords), len(y_coords)
+    else:
+        x_coords = np.unique(x)
+        y_coords = np.unique(y)
+        n_x, n_y = len(x_coords), len(y_coords)
+        x_step = float((x_coords[-1] - x_coords[0]) / (n_x - 1)) if n_x > 1 else 1.0
+        y_step = float((y_coords[-1] - y_coords[0]) / (n_y - 1)) if n_y > 1 else 1.0
+    size = grid_size if grid_size is not None else max(n_x, n_y)
+
+    num_channels = values.shape[1]
+    grid = np.full((size, size, num_channels), np.nan)
+    if refined:
+        lattice = (x_coords[0], y_coords[0], x_step, y_step, n_x, n_y)
+        _fill_refined(grid, x, y, values, level, lattice, subdivision, levels)
+    else:
+        # Row order does not matter; a repeated (x, y) keeps its last row
+        grid[np.searchsorted(y_coords, y), np.searchsorted(x_coords, x)] = values
+
+    x_min, y_min = float(x_coords[0]), float(y_coords[0])
+    metadata = {
+        "extent": [
+            x_min - x_step / 2,
+            x_min + (size - 1) * x_step + x_step / 2,
+            y_min - y_step / 2,
+            y_min + (size - 1) * y_step + y_step / 2,
+        ],
+        "x_coords": x_coords,
+        "y_coords": y_coords,
+        "x_step": x_step,
+        "y_step": y_step,
+        "grid_size": size,
+        "original_nx": n_x,
+        "original_ny": n_y,
+        "num_channels": num_channels,
+        "channel_names": list(CHANNEL_NAMES[:num_channels]),
+        "valid_points": int(np.count_nonzero(~np.isnan(grid[:, :, 0]))),
+        "total_points": size * size,
+    }
+    if refined:
+        metadata["refinement_levels"] = levels
+        metadata["refinement_subdivision"] = subdivision
+    return grid, metadata
+
+
+def _refined_layout(x: np.ndarray, y: np.ndarray, level: np.ndarray):
+    """
+    Finest lattice of a multi-resolution scan.
+
+    The coarse grid (level 0) is uniform; the subdivision is inferred from
+    the finest pitch and the deepest level present (pitch = coarse step /
+    subdivision**levels), so CSV files without refinement metadata work too.
+
+    Returns:
+        (x_coords, y_coords, x_step, y_step, subdivision, levels)
+    """
+    coarse = level == 0
+    levels = int(level.max())
+    origins, coarse_steps, scale = [], [], 1.0
+    for axis in (x, y):
+        coords = np.unique(axis[coarse])
+        if len(coords) < 2:
+            raise ValueError("Refined scan without a coarse grid of at least 2 x 2 points")
+        coarse_step = (coords[-1] - coords[0]) / (len(coords) - 1)
+        pitch = np.diff(np.unique(axis)).min()
+        origins.append(coords[0])
+        coarse_steps.append((coarse_step, len(coords)))
+        scale = max(scale, coarse_step / pitch)
+    subdivision = max(2, int(round(scale ** (1.0 / levels))))
+    scale = subdivision ** levels
+
+    axes = []
+    for origin, (coarse_step, n_coarse) in zip(origins, coarse_steps):
+        step = coarse_step / scale
+        axes.append((origin + step * np.arange((n_coarse - 1) * scale + 1), float(step)))
+    (x_coords, x_step), (y_coords, y_step) = axes
+    return x_coords, y_coords, x_step, y_step, subdivision, levels
+
+
+def _fill_refined(grid, x, y, values, level, lattice, subdivision: int, levels: int) -> None:
+    """Paint each point's block, coarse levels first (finer points overwrite them)."""
+    x0, y0, x_step, y_step, width, height = lattice
+    fx, fy = (x - x0) / x_step, (y - y0) / y_step
+    cols, rows = np.rint(fx).astype(np.int64), np.rint(fy).astype(np.int64)
+    off = (np.abs(fx - cols) > 0.25) | (np.abs(fy - rows) > 0.25)
+    if off.any():
+        i = int(np.argmax(off))
+        raise ValueError(f"Point ({x[i]}, {y[i]}) of level {level[i]} is off the refinement lattice")
+
+    # Blocks are clipped to the scanned area, not to the square padding
+    for current in range(levels + 1):
+        mask = level == current
+        if not mask.any():
+            continue
+        edge = subdivision ** (levels - current)
+        half = edge // 2
+        r, c, v = rows[mask], cols[mask], values[mask]
+        for dy in range(-half, edge - half):
+            for dx in range(-half, edge - half):
+                rr, cc = r + dy, c + dx
+                inside = (rr >= 0) & (rr < height) & (cc >= 0) & (cc < width)
+                grid[rr[inside], cc[inside]] = v[inside]
+
+
+def nearest_valid_point(grid: np.ndarray, reference: Tuple[int, int]) -> Tuple[int, int]:
+    """Closest (row, col) to `reference` with no NaN channel (reference itself if valid)."""
+    y0, x0 = reference
+    valid = ~np.isnan(grid).any(axis=2)
+    if valid[y0, x0]:
+        return (y0, x0)
+    rows, cols = np.nonzero(valid)
+    if rows.size == 0:
+        return (y0, x0)
+    i = int(np.argmin((rows - y0) ** 2 + (cols - x0) ** 2))
+    return (int(rows[i]), int(cols[i]))
+
+
+def calibrate_phase(grid: np.ndarray, reference: Tuple[int, int] = (0, 0)) -> Tuple[np.ndarray, Dict]:
+    """
+    Rotate each axis (I, Q) by -theta_ref so that Q = 0 at the reference
+    point, then flip the axis when I_ref < 0 (sign of the in-phase kept).
+
+    Returns:
+        (calibrated grid, {"x": theta, "y": theta, "z": theta, "reference_used": (row, col)})
+    """
+    used = nearest_valid_point(grid, reference)
+    ref = grid[used[0], used[1]]
+    ref_i, ref_q = ref[_I], ref[_Q]
+    undefined = np.isnan(ref_i) | np.isnan(ref_q)
+    theta = np.where(undefined, 0.0, np.arctan2(ref_q, ref_i))
+    sign = np.where(~undefined & (ref_i < 0), -1.0, 1.0)
+    cos_t, sin_t = np.cos(theta), np.sin(theta)
+
+    i, q = grid[..., _I], grid[..., _Q]
+    calibrated = np.empty_like(grid)
+    calibrated[..., _I] = (i * cos_t + q * sin_t) * sign
+    calibrated[..., _Q] = (q * cos_t - i * sin_t) * sign
+
+    phases = {axis: float(t) for axis, t in zip(AXES, theta)}
+    phases["reference_used"] = used
+    return calibrated, phases
+
+
+def subtract_primary(grid: np.ndarray, reference: Tuple[int, int] = (0, 0)) -> Tuple[np.ndarray, np.ndarray]:
+    """Subtract the reference point vector everywhere (NaN reference channels subtract 0)."""
+    ref = np.nan_to_num(grid[reference[0], reference[1]], nan=0.0)
+    return grid - ref, ref
+
+
+def rotation_matrix(angles_deg: Tuple[float, float, float]) -> np.ndarray:
+    """3x3 matrix of the intrinsic 'XYZ' rotation (Rx @ Ry @ Rz), v_source = M @ v_sensor."""
+    ax, ay, az = (math.radians(a) for a in angles_deg)
+    cx, sx, cy, sy, cz, sz = math.cos(ax), math.sin(ax), math.cos(ay), math.sin(ay), math.cos(az), math.sin(az)
+    rx = np.array([[1.0, 0.0, 0.0], [0.0, cx, -sx], [0.0, sx, cx]])
+    ry = np.array([[cy, 0.0, sy], [0.0, 1.0, 0.0], [-sy, 0.0, cy]])
+    rz = np.array([[cz, -sz, 0.0], [sz, cz, 0.0], [0.0, 0.0, 1.0]])
+    return rx @ ry @ rz
+
+
+def rotation_quaternion(angles_deg: Tuple[float, float, float]) -> np.ndarray:
+    """Unit quaternion [x, y, z, w] (scalar last, scipy convention) of rotation_matrix(angles)."""
+    q = np.array([1.0, 0.0, 0.0, 0.0])  # [w, x, y, z]
+    for axis, angle in enumerate(angles_deg):
+        half = math.radians(angle) / 2
+        r = np.zeros(4)
+        r[0], r[axis + 1] = math.cos(half), math.sin(half)
+        q = _hamilton(q, r)
+    if q[0] < 0:
+        q = -q
+    return np.array([q[1], q[2], q[3], q[0]])
+
+
+def _hamilton(q1: np.ndarray, q2: np.ndarray) -> np.ndarray:
+    w1, x1, y1, z1 = q1
+    w2, x2, y2, z2 = q2
+    return np.array([
+        w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2,
+        w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+        w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+        w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2,
+    ])
+
+
+def rotate_frame(grid: np.ndarray, matrix: np.ndarray) -> np.ndarray:
+    """Apply `matrix` to the (Ux, Uy, Uz) in-phase triples and to the quadrature triples."""
+    rotated = np.empty_like(grid)
+    rotated[..., _I] = grid[..., _I] @ matrix.T
+    rotated[..., _Q] = grid[..., _Q] @ matrix.T
+    return rotated
+
+
+def magnitude_phase(grid: np.ndarray) -> np.ndarray:
+    """(H, W, 6) [|Ux|, phase Ux, |Uy|, phase Uy, |Uz|, phase Uz], phases in radians."""
+    i, q = grid[..., _I], grid[..., _Q]
+    result = np.empty_like(grid)
+    result[..., 0::2] = np.hypot(i, q)
+    result[..., 1::2] = np.arctan2(q, i)
+    return result
@@ -0,0 +1,64 @@
+"""
+CLI tool to convert a binary scan export (.aefscan) to CSV, on demand.
+
+Usage:
+    python -m tool.scan_binary_to_csv path/to/scan.aefscan [-o out.csv]
+
+Responsibility:
+- Print the scan metadata stored in the file header.
+- Write the CSV layout of `CsvScanExportPort` (one row per point).
+"""
+
+from __future__ import annotations
+
+import argparse
+from pathlib import Path
+
+from infrastructure.persistence.binary_scan_export_port import (
+    convert_to_csv,
+    read_layout,
+    row_count,
+)
+
+
+def scan_binary_to_csv(path: str, output: str = None) -> None:
+    """Convert `path` (relative paths resolved under the raw_data repository first)."""
+    raw_path = Path(path)
+
+    # Project root = parent of "src" directory (this file is under src/tool/)
+    project_root = Path(__file__).resolve().parents[2]
+    data_repo = project_root / ".aefi_acquisition" / "scans" / "raw_data"
+
+    file_path = raw_path
+    if not raw_path.is_absolute() and (data_repo / raw_path).exists():
+        file_path = data_repo / raw_path
+
+    if not file_path.exists():
+        print(f"Error: file not found: {file_path}")
+        return
+
+    try:
+        metadata, header_size, columns = read_layout(file_path)
+    except ValueError as exc:
+        print(f"Error: {exc}")
+        return
+
+    print(f"Binary scan file: {file_path}")
+    for key, value in metadata.items():
+        print(f"  - {key}: {value}")
+    print(f"Points: {row_count(file_path, header_size, columns)}")
+
+    csv_path = convert_to_csv(file_path, Path(output) if output else None)
+    print(f"CSV written: {csv_path}")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Convert a binary scan export to CSV.")
+    parser.add_argument("file", help="Path to the .aefscan file.")
+    parser.add_argument("-o", "--output", help="Destination CSV (default: same name, .csv).")
+    args = parser.parse_args()
+    scan_binary_to_csv(args.file, args.output)
+
+
+if __name__ == "__main__":
+    main()